@@ -2,11 +2,8 @@ struct PSInput
 {
   float4 position : SV_POSITION;
   float4 color : COLOR0;
-  float4 subColor : COLOR1;
   float2 texcoord : TEXCOORD;
   uint texID : TEXID;
-  float thickness : THICKNESS;
-  float outline : OUTLINE;
 };
 
 cbuffer ConstantData : register(b0)
@@ -14,6 +11,14 @@ cbuffer ConstantData : register(b0)
   float4x4 matVP;
 };
 
+// `ݒ(`施߂Ƃɋ)
+cbuffer StyleData : register(b1)
+{
+  float4 subColor;
+  float thickness;
+  float outline;
+};
+
 struct FontInfo
 {
   uint page;
@@ -23,18 +28,26 @@ struct FontInfo
 };
 StructuredBuffer<FontInfo> fontInfos : register(t0);
 
-struct Character
+// f[^()
+struct Glyph
 {
-  float2 position;
+  float2 offset;
+  uint fontIndex;
+  uint run;
+};
+StructuredBuffer<Glyph> glyphs : register(t1);
+
+// f[^(񂲂)
+struct GlyphRun
+{
+  float2 origin;
   float2 scale;
   float4 color;
-  float4 subColor;
-  float thickness;
-  float outline;
-  uint fontIndex;
 };
-StructuredBuffer<Character> characters : register(t1);
+StructuredBuffer<GlyphRun> runs : register(t2);
 
+// tHg摜(y[W). ǂݍ܂ĂȂy[Wnullr[ɂȂĂ
+// y[W͕`撆ɓǂݍ݁AĵŁAfXNv^e[uDESCRIPTORS_VOLATILEɂĂ
 Texture2D tex[2] : register(t0);
 SamplerState sampler0 : register(s0);
 
@@ -44,8 +57,10 @@ SamplerState sampler0 : register(s0);
 "   DENY_HULL_SHADER_ROOT_ACCESS )," \
 "RootConstants(num32BitConstants=16, b0)," \
 "DescriptorTable(SRV(t0, numDescriptors = 1), visibility = SHADER_VISIBILITY_VERTEX)," \
-"DescriptorTable(SRV(t1, numDescriptors = 1), visibility = SHADER_VISIBILITY_VERTEX)," \
-"DescriptorTable(SRV(t0, numDescriptors = 2), visibility = SHADER_VISIBILITY_PIXEL)," \
+"SRV(t1, visibility = SHADER_VISIBILITY_VERTEX)," \
+"DescriptorTable(SRV(t0, numDescriptors = 2, flags = DESCRIPTORS_VOLATILE), visibility = SHADER_VISIBILITY_PIXEL)," \
+"SRV(t2, visibility = SHADER_VISIBILITY_VERTEX)," \
+"RootConstants(num32BitConstants=6, b1, visibility = SHADER_VISIBILITY_PIXEL)," \
 "StaticSampler(s0," \
 "   filter = FILTER_MIN_MAG_MIP_LINEAR," \
 "   addressU = TEXTURE_ADDRESS_CLAMP," \
@@ -60,23 +75,21 @@ PSInput VSMain(uint vertID : SV_VertexID, uint instID : SV_InstanceID)
   // |\|
   // 0-1
 
-  Character chr = characters[instID];
-  FontInfo font= fontInfos[chr.fontIndex];
-  float2 size = font.size * chr.scale;
-  float2 offset = font.offset * chr.scale;
+  Glyph glyph = glyphs[instID];
+  GlyphRun run = runs[glyph.run];
+  FontInfo font= fontInfos[glyph.fontIndex];
+  float2 size = font.size * run.scale;
+  float2 offset = font.offset * run.scale + glyph.offset + run.origin;
 
   PSInput result;
   float x = float(vertID & 1);
   float y = float((vertID >> 1) & 1);
-  float px = x * size.x + chr.position.x + offset.x;
-  float py = y * size.y + chr.position.y + offset.y;
+  float px = x * size.x + offset.x;
+  float py = y * size.y + offset.y;
   result.position = mul(float4(px, py, 100.0f, 1.0f), matVP);
-  result.color = chr.color;
-  result.subColor = chr.subColor;
+  result.color = run.color;
   result.texcoord = float2(font.uv[int(x)].x, font.uv[1 - int(y)].y);
   result.texID = font.page;
-  result.thickness = chr.thickness;
-  result.outline = chr.outline;
   return result;
 }
 
@@ -86,9 +99,9 @@ float4 PSMain(PSInput input) : SV_TARGET
   const float smoothing = 1.0f / 16.0f;
   float distance = tex[NonUniformResourceIndex(input.texID)].Sample(sampler0, input.texcoord).r;
   //return float4(1, 1, 1, distance);
-  float outline = smoothstep(input.thickness - smoothing, input.thickness + smoothing, distance);
-  float4 color = lerp(input.subColor, input.color, outline);
-  color.a *= smoothstep(input.outline - smoothing, input.outline + smoothing, distance);
+  float inner = smoothstep(thickness - smoothing, thickness + smoothing, distance);
+  float4 color = lerp(subColor, input.color, inner);
+  color.a *= smoothstep(outline - smoothing, outline + smoothing, distance);
   color.a = clamp(color.a, 0.0f, 1.0f);
   return color;
 }
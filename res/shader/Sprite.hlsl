@@ -11,17 +11,20 @@ cbuffer ConstantData : register(b0)
   float4x4 matVP;
 };
 
+// Sprite.cppSpriteInShaderƈv邱(24oCg)
 struct Sprite
 {
-  uint texID;
-  float3 position;
-  float rotation;
-  float2 scale;
-  float4 color;
+  uint position;         // xx2
+  uint scale;            // xx2
+  uint rotationAndTexID; // 16bit=](0-655350-2), 16bit=eNX`ԍ
+  uint color;            // RGBA8
+  uint2 uvRect;          // 16bitx4. eNX`͈̔(, , E, )
 };
 StructuredBuffer<Sprite> sprites : register(t0);
 
-Texture2D tex0[1023] : register(t0);
+// foCX̃q[vŜeNX`e[uƂĎg(Device::bindlessDescriptorCountƈv邱)
+// eNX`̓ǂݍ݂AgX̊gŁA`撆ɂe[ûŁADESCRIPTORS_VOLATILEɂĂ
+Texture2D tex0[1024] : register(t0);
 SamplerState sampler0 : register(s0);
 
 [RootSignature("RootFlags( ALLOW_INPUT_ASSEMBLER_INPUT_LAYOUT |" \
@@ -29,8 +32,8 @@ SamplerState sampler0 : register(s0);
 "   DENY_GEOMETRY_SHADER_ROOT_ACCESS |" \
 "   DENY_HULL_SHADER_ROOT_ACCESS )," \
 "RootConstants(num32BitConstants=16, b0)," \
-"DescriptorTable(SRV(t0, numDescriptors = 1), visibility = SHADER_VISIBILITY_VERTEX)," \
-"DescriptorTable(SRV(t0, numDescriptors = 1023), visibility = SHADER_VISIBILITY_PIXEL)," \
+"SRV(t0, visibility = SHADER_VISIBILITY_VERTEX)," \
+"DescriptorTable(SRV(t0, numDescriptors = 1024, flags = DESCRIPTORS_VOLATILE), visibility = SHADER_VISIBILITY_PIXEL)," \
 "StaticSampler(s0," \
 "   filter = FILTER_MIN_MAG_MIP_LINEAR," \
 "   addressU = TEXTURE_ADDRESS_CLAMP," \
@@ -46,16 +49,25 @@ PSInput VSMain(uint vertID : SV_VertexID, uint instID : SV_InstanceID)
   // 0-1
   PSInput result;
   Sprite sprite = sprites[instID];
+  float2 position = f16tof32(uint2(sprite.position, sprite.position >> 16));
+  float2 scale = f16tof32(uint2(sprite.scale, sprite.scale >> 16));
+  float rotation = float(sprite.rotationAndTexID & 0xffff) * (6.28318531f / 65536.0f);
+  float4 color = float4(sprite.color & 0xff, (sprite.color >> 8) & 0xff,
+    (sprite.color >> 16) & 0xff, sprite.color >> 24) * (1.0f / 255.0f);
+  float4 uvRect = float4(sprite.uvRect.x & 0xffff, sprite.uvRect.x >> 16,
+    sprite.uvRect.y & 0xffff, sprite.uvRect.y >> 16) * (1.0f / 65535.0f);
+
   float x = float(vertID & 1);
   float y = float((vertID >> 1) & 1);
-  float2 v = float2(x - 0.5f, y - 0.5f) * sprite.scale;
-  float s = sin(sprite.rotation);
-  float c = cos(sprite.rotation);
+  float2 v = float2(x - 0.5f, y - 0.5f) * scale;
+  float s = sin(rotation);
+  float c = cos(rotation);
   float2 p = float2(c * v.x + -s * v.y, s * v.x + c * v.y);
-  result.position = mul(float4(p + sprite.position.xy, sprite.position.z, 1.0f), matVP);
-  result.color = float4(sprite.color);
-  result.texcoord = float2(x, 1.0f - y);
-  result.texID = sprite.texID;
+  // [xeXg͎g킸`揇őO߂̂ŁAZW͌Œlł悢
+  result.position = mul(float4(p + position, 100.0f, 1.0f), matVP);
+  result.color = color;
+  result.texcoord = lerp(uvRect.xy, uvRect.zw, float2(x, 1.0f - y));
+  result.texID = sprite.rotationAndTexID >> 16;
   return result;
 }
 
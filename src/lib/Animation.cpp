@@ -0,0 +1,228 @@
+/**
+* @file Animation.cpp
+*/
+#include "Animation.h"
+#include <algorithm>
+
+namespace EasyLib {
+
+/**
+* Aj[VVXe
+*
+* @param maxInstanceCount ɍĐłCX^X̍ő吔(ő65536)
+*/
+bool AnimationSystem::Init(uint32_t maxInstanceCount)
+{
+  clips.clear();
+  imageTable.clear();
+  if (!slots.Init(maxInstanceCount)) {
+    return false;
+  }
+  denseIndices.assign(maxInstanceCount, 0);
+  instanceHandles.clear();
+  instanceClips.clear();
+  instanceTicks.clear();
+  instanceImages.clear();
+  instanceHandles.reserve(maxInstanceCount);
+  instanceClips.reserve(maxInstanceCount);
+  instanceTicks.reserve(maxInstanceCount);
+  instanceImages.reserve(maxInstanceCount);
+  return true;
+}
+
+/**
+* Nbv쐬
+*
+* @param images    摜̔z
+* @param durations 摜Ƃ̕\Ԃ̔z(0̉摜͕\Ȃ)
+* @param count     z̒
+* @param mode      Đ@
+*
+* @return Nbvԍ. 쐬łȂꍇinvalidClip
+*/
+uint32_t AnimationSystem::CreateClip(const uint32_t* images, const uint32_t* durations, size_t count, LoopMode mode)
+{
+  uint64_t totalTicks = 0;
+  for (size_t i = 0; i < count; ++i) {
+    totalTicks += durations[i];
+  }
+  // PingPong͗[ċtɂǂ镪\ɓALoopƓ]ň悤ɂ
+  if (mode == LoopMode::PingPong) {
+    for (size_t i = 1; i + 1 < count; ++i) {
+      totalTicks += durations[i];
+    }
+  }
+  if (totalTicks == 0 || totalTicks > UINT32_MAX - imageTable.size()) {
+    return invalidClip;
+  }
+
+  // oߎԂ璼ډ摜悤ɁAƂ̕\
+  const Clip clip = { static_cast<uint32_t>(imageTable.size()), static_cast<uint32_t>(totalTicks), mode };
+  for (size_t i = 0; i < count; ++i) {
+    imageTable.insert(imageTable.end(), durations[i], images[i]);
+  }
+  if (mode == LoopMode::PingPong) {
+    for (size_t i = count - 1; i-- > 1;) {
+      imageTable.insert(imageTable.end(), durations[i], images[i]);
+    }
+  }
+  clips.push_back(clip);
+  return static_cast<uint32_t>(clips.size() - 1);
+}
+
+/**
+* Nbv̍ĐJn
+*
+* @param clip Nbvԍ
+*
+* @return CX^X̃nh. ĐłȂꍇinvalidHandle
+*/
+uint32_t AnimationSystem::Play(uint32_t clip)
+{
+  if (clip >= clips.size()) {
+    return invalidHandle;
+  }
+  const uint32_t handle = slots.Allocate();
+  if (handle == invalidHandle) {
+    return invalidHandle;
+  }
+  denseIndices[DX12::SlotAllocator::GetIndex(handle)] = static_cast<uint32_t>(instanceHandles.size());
+  instanceHandles.push_back(handle);
+  instanceClips.push_back(clip);
+  instanceTicks.push_back(0);
+  instanceImages.push_back(imageTable[clips[clip].tableOffset]);
+  return handle;
+}
+
+/**
+* ĐNbvύX
+*
+* Nbvw肵ꍇ͉Ȃ(ŏĐȂ)
+*
+* @param handle CX^X̃nh
+* @param clip   Nbvԍ
+*
+* @retval true  ύX
+* @retval false nhNbvԍ
+*/
+bool AnimationSystem::Change(uint32_t handle, uint32_t clip)
+{
+  if (!slots.IsValid(handle) || clip >= clips.size()) {
+    return false;
+  }
+  const uint32_t i = denseIndices[DX12::SlotAllocator::GetIndex(handle)];
+  if (instanceClips[i] != clip) {
+    instanceClips[i] = clip;
+    instanceTicks[i] = 0;
+    instanceImages[i] = imageTable[clips[clip].tableOffset];
+  }
+  return true;
+}
+
+/**
+* ĐIăCX^Xj
+*
+* @param handle CX^X̃nh
+*
+* @retval true  j
+* @retval false nh
+*/
+bool AnimationSystem::Stop(uint32_t handle)
+{
+  if (!slots.Free(handle)) {
+    return false;
+  }
+  // ̃CX^X󂢂ʒuɈڂāAzl߂܂܂ɂ
+  const uint32_t i = denseIndices[DX12::SlotAllocator::GetIndex(handle)];
+  const uint32_t last = static_cast<uint32_t>(instanceHandles.size() - 1);
+  if (i != last) {
+    instanceHandles[i] = instanceHandles[last];
+    instanceClips[i] = instanceClips[last];
+    instanceTicks[i] = instanceTicks[last];
+    instanceImages[i] = instanceImages[last];
+    denseIndices[DX12::SlotAllocator::GetIndex(instanceHandles[i])] = i;
+  }
+  instanceHandles.pop_back();
+  instanceClips.pop_back();
+  instanceTicks.pop_back();
+  instanceImages.pop_back();
+  return true;
+}
+
+/**
+* CX^X݂̌̉摜擾
+*
+* @param handle CX^X̃nh
+*
+* @return 摜. nhȂ0
+*/
+uint32_t AnimationSystem::GetImage(uint32_t handle) const
+{
+  if (!slots.IsValid(handle)) {
+    return 0;
+  }
+  return instanceImages[denseIndices[DX12::SlotAllocator::GetIndex(handle)]];
+}
+
+/**
+* ĐIׂ
+*
+* LoopMode::OncełȂNbvIsFinishedł͏IȂ
+*
+* @param handle CX^X̃nh
+*
+* @retval true  Ō܂ōĐA܂̓nh
+* @retval false Đ
+*/
+bool AnimationSystem::IsFinished(uint32_t handle) const
+{
+  if (!slots.IsValid(handle)) {
+    return true;
+  }
+  const uint32_t i = denseIndices[DX12::SlotAllocator::GetIndex(handle)];
+  const Clip& clip = clips[instanceClips[i]];
+  return clip.mode == LoopMode::Once && instanceTicks[i] >= clip.totalTicks - 1;
+}
+
+/**
+* ׂẴCX^X̎Ԃi߂
+*
+* SetFinishCallbackŊ֐ݒ肵Ă΁ANbv̏IɒBCX^XƂɁA
+* ׂẴCX^Xi߂ƂŌĂяo(֐̒StopPlayĂł悢)
+*
+* @param ticks i߂鎞
+*/
+void AnimationSystem::Update(uint32_t ticks)
+{
+  const Clip* pClips = clips.data();
+  const uint32_t* pTable = imageTable.data();
+  const uint32_t* pClipIndices = instanceClips.data();
+  uint32_t* pTicks = instanceTicks.data();
+  uint32_t* pImages = instanceImages.data();
+  const size_t count = instanceClips.size();
+  const bool needFinished = static_cast<bool>(finishCallback);
+  finishedHandles.clear();
+  for (size_t i = 0; i < count; ++i) {
+    const Clip& clip = pClips[pClipIndices[i]];
+    const uint32_t prev = pTicks[i];
+    uint32_t t = prev + ticks;
+    bool finished;
+    if (clip.mode == LoopMode::Once) {
+      finished = prev < clip.totalTicks - 1 && t >= clip.totalTicks - 1;
+      t = std::min(t, clip.totalTicks - 1);
+    } else {
+      finished = t >= clip.totalTicks;
+      t %= clip.totalTicks;
+    }
+    pTicks[i] = t;
+    pImages[i] = pTable[clip.tableOffset + t];
+    if (needFinished && finished) {
+      finishedHandles.push_back(instanceHandles[i]);
+    }
+  }
+  for (uint32_t handle : finishedHandles) {
+    finishCallback(handle);
+  }
+}
+
+} // namespace EasyLib
@@ -0,0 +1,84 @@
+/**
+* @file Animation.h
+*/
+#ifndef EASYLIB_ANIMATION_H
+#define EASYLIB_ANIMATION_H
+#include "SlotAllocator.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <functional>
+#include <vector>
+
+namespace EasyLib {
+
+/**
+* 摜؂ւAj[V̊ǗNX
+*
+* Nbv́u摜(eNX`nh)ƕ\Ԃ̕сvŁA쐬ɎƂ̉摜̕\Ă
+* CX^X͍Đ̃NbvƌoߎԂAvfƂ̔z(SoA)ɋl߂Ċi[
+* Update͑SCX^XЂƂ̃[vŐi߂̂ŁACX^X炠Ăy
+* Ԃ̒PʂUpdateɓnlƓ(ʏ̓t[)
+* GPUɂ͈ؐGȂ̂ŁAP̂ŃeXgx`}[Nł
+*/
+class AnimationSystem
+{
+public:
+  static constexpr uint32_t invalidClip = UINT32_MAX;
+  static constexpr uint32_t invalidHandle = DX12::SlotAllocator::invalidHandle;
+
+  // Đ@
+  enum class LoopMode : uint8_t {
+    Loop,     // Ō܂ōĐŏɖ߂
+    Once,     // Ō̉摜Ŏ~܂
+    PingPong, // Ō܂ōĐtɖ߂AJԂ
+  };
+
+  // Nbv̏IɒBCX^X󂯎֐
+  // Once ͍Ō̉摜ɒBƂALoop  PingPong 1邽тɌĂ΂
+  using FinishCallback = std::function<void(uint32_t handle)>;
+
+  AnimationSystem() = default;
+  ~AnimationSystem() = default;
+
+  bool Init(uint32_t maxInstanceCount);
+
+  // Nbv
+  uint32_t CreateClip(const uint32_t* images, const uint32_t* durations, size_t count, LoopMode mode);
+  size_t GetClipCount() const { return clips.size(); }
+
+  // CX^X
+  uint32_t Play(uint32_t clip);
+  bool Change(uint32_t handle, uint32_t clip);
+  bool Stop(uint32_t handle);
+  bool IsValid(uint32_t handle) const { return slots.IsValid(handle); }
+  uint32_t GetImage(uint32_t handle) const;
+  bool IsFinished(uint32_t handle) const;
+  size_t GetInstanceCount() const { return instanceClips.size(); }
+
+  void SetFinishCallback(FinishCallback callback) { finishCallback = std::move(callback); }
+  void Update(uint32_t ticks);
+
+private:
+  struct Clip {
+    uint32_t tableOffset; // imageTable̐擪ʒu
+    uint32_t totalTicks;  // 1̒
+    LoopMode mode;
+  };
+  std::vector<Clip> clips;
+  std::vector<uint32_t> imageTable; // NbvƁAƂ̉摜
+
+  // CX^X(Đ̂̂l߂Ċi[)
+  DX12::SlotAllocator slots;
+  std::vector<uint32_t> denseIndices;    // Xbgԍ -> z̈ʒu
+  std::vector<uint32_t> instanceHandles; // z̈ʒu -> nh
+  std::vector<uint32_t> instanceClips;
+  std::vector<uint32_t> instanceTicks;
+  std::vector<uint32_t> instanceImages; // Updateŋ߂݂̉摜
+
+  FinishCallback finishCallback;
+  std::vector<uint32_t> finishedHandles; // Update̒ŃNbv̏IɒBCX^X
+};
+
+} // namespace EasyLib
+
+#endif // EASYLIB_ANIMATION_H
@@ -0,0 +1,155 @@
+/**
+* @file AtlasPacker.cpp
+*/
+#include "AtlasPacker.h"
+#include <algorithm>
+
+namespace EasyLib {
+namespace DX12 {
+
+/**
+* pbJ[Ԃɖ߂
+*
+* @param width   AgX̕
+* @param height  AgX̍
+* @param padding `̎͂Ɋmۂ錄Ԃ̃sNZ
+*/
+void AtlasPacker::Reset(uint32_t width, uint32_t height, uint32_t padding)
+{
+  this->width = width;
+  this->height = height;
+  this->padding = padding;
+  usedArea = 0;
+  rectCount = 0;
+  skyline.clear();
+  skyline.push_back({ 0, 0, width });
+}
+
+/**
+* `AgXɔzu
+*
+* @param width  zu`̕
+* @param height zu`̍
+* @param rect   zuꂽ`i[ϐ(Ԃ͊܂܂Ȃ)
+*
+* @retval true  zu
+* @retval false 󂫂Ȃ
+*/
+bool AtlasPacker::Pack(uint32_t width, uint32_t height, AtlasRect& rect)
+{
+  const uint32_t w = width + padding * 2;
+  const uint32_t h = height + padding * 2;
+  if (width == 0 || height == 0 || w > this->width || h > this->height) {
+    return false;
+  }
+
+  // [łႭȂʒuT(Ȃ疳ʂɂȂ镝ق)
+  size_t bestIndex = skyline.size();
+  uint32_t bestY = UINT32_MAX;
+  uint32_t bestBottom = UINT32_MAX;
+  uint32_t bestWidth = UINT32_MAX;
+  for (size_t i = 0; i < skyline.size(); ++i) {
+    uint32_t y;
+    if (!Fit(i, w, h, y)) {
+      continue;
+    }
+    const uint32_t bottom = y + h;
+    if (bottom < bestBottom || (bottom == bestBottom && skyline[i].width < bestWidth)) {
+      bestIndex = i;
+      bestY = y;
+      bestBottom = bottom;
+      bestWidth = skyline[i].width;
+    }
+  }
+  if (bestIndex >= skyline.size()) {
+    return false;
+  }
+
+  // V}ẢɉB
+  const Segment segment = { skyline[bestIndex].x, bestBottom, w };
+  skyline.insert(skyline.begin() + bestIndex, segment);
+  for (size_t i = bestIndex + 1; i < skyline.size();) {
+    Segment& e = skyline[i];
+    const uint32_t right = segment.x + segment.width;
+    if (e.x >= right) {
+      break;
+    }
+    const uint32_t shrink = right - e.x;
+    if (e.width <= shrink) {
+      skyline.erase(skyline.begin() + i);
+      continue;
+    }
+    e.x += shrink;
+    e.width -= shrink;
+    break;
+  }
+  Merge();
+
+  rect.x = segment.x + padding;
+  rect.y = bestY + padding;
+  rect.width = width;
+  rect.height = height;
+  usedArea += static_cast<uint64_t>(w) * h;
+  ++rectCount;
+  return true;
+}
+
+/**
+* gpςݖʐς̊擾
+*
+* @return 0.0()`1.0(t)
+*/
+float AtlasPacker::GetOccupancy() const
+{
+  if (width == 0 || height == 0) {
+    return 0;
+  }
+  return static_cast<float>(static_cast<double>(usedArea) / (static_cast<double>(width) * height));
+}
+
+/**
+* indeẍʒuɋ`u邩ׂ
+*
+* @param index `̍[Ƃ̔ԍ
+* @param w     `̕
+* @param h     `̍
+* @param y     uꍇ͋`̏[YWi[
+*/
+bool AtlasPacker::Fit(size_t index, uint32_t w, uint32_t h, uint32_t& y) const
+{
+  const uint32_t x = skyline[index].x;
+  if (x + w > width) {
+    return false;
+  }
+  y = 0;
+  uint32_t remain = w;
+  for (size_t i = index; remain > 0; ++i) {
+    if (i >= skyline.size()) {
+      return false;
+    }
+    y = std::max(y, skyline[i].y);
+    if (y + h > height) {
+      return false;
+    }
+    remain -= std::min(remain, skyline[i].width);
+  }
+  return true;
+}
+
+/**
+* ŗׂ荇
+*/
+void AtlasPacker::Merge()
+{
+  for (size_t i = 0; i + 1 < skyline.size();) {
+    if (skyline[i].y == skyline[i + 1].y) {
+      skyline[i].width += skyline[i + 1].width;
+      skyline.erase(skyline.begin() + i + 1);
+    } else {
+      ++i;
+    }
+  }
+}
+
+} // namespace DX12
+} // namespace EasyLib
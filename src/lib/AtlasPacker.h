@@ -0,0 +1,67 @@
+/**
+* @file AtlasPacker.h
+*/
+#ifndef EASYLIB_DX12_ATLASPACKER_H
+#define EASYLIB_DX12_ATLASPACKER_H
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+namespace EasyLib {
+namespace DX12 {
+
+/**
+* AgX̋`(sNZP)
+*/
+struct AtlasRect
+{
+  uint32_t x = 0;
+  uint32_t y = 0;
+  uint32_t width = 0;
+  uint32_t height = 0;
+};
+
+/**
+* XJCC@ɂ`pbJ[
+*
+* GPUɂ͈ؐGȂ̂ŁAP̂ŃeXgx`}[Nł
+* `̊Ԃɂ padding Ŏw肵sNŽԂmۂ
+*/
+class AtlasPacker
+{
+public:
+  AtlasPacker() = default;
+  AtlasPacker(uint32_t width, uint32_t height, uint32_t padding) { Reset(width, height, padding); }
+  ~AtlasPacker() = default;
+
+  void Reset(uint32_t width, uint32_t height, uint32_t padding);
+  bool Pack(uint32_t width, uint32_t height, AtlasRect& rect);
+
+  uint32_t GetWidth() const { return width; }
+  uint32_t GetHeight() const { return height; }
+  uint32_t GetPadding() const { return padding; }
+  size_t GetRectCount() const { return rectCount; }
+  float GetOccupancy() const;
+
+private:
+  // XJCC̐Ȑ
+  struct Segment {
+    uint32_t x;
+    uint32_t y;
+    uint32_t width;
+  };
+  bool Fit(size_t index, uint32_t w, uint32_t h, uint32_t& y) const;
+  void Merge();
+
+  std::vector<Segment> skyline;
+  uint32_t width = 0;
+  uint32_t height = 0;
+  uint32_t padding = 0;
+  uint64_t usedArea = 0;
+  size_t rectCount = 0;
+};
+
+} // namespace DX12
+} // namespace EasyLib
+
+#endif // EASYLIB_DX12_ATLASPACKER_H
@@ -0,0 +1,85 @@
+/**
+* @file BlockPool.cpp
+*/
+#include "BlockPool.h"
+
+namespace EasyLib {
+namespace DX12 {
+
+/**
+* y[WׂĔjď
+*
+* @param blocksPerPage y[W̃ubN
+* @param reuseDelay    ubNėp܂ł̃t[
+*/
+void BlockPool::Init(uint32_t blocksPerPage, uint32_t reuseDelay)
+{
+  this->blocksPerPage = blocksPerPage > 0 ? blocksPerPage : 1;
+  this->reuseDelay = reuseDelay;
+  retiredBlocks.clear();
+  freeBlocks.clear();
+  pageCount = 0;
+  usedCount = 0;
+  frame = 0;
+}
+
+/**
+* y[WǉāÃubNmۂł悤ɂ
+*/
+void BlockPool::AddPage()
+{
+  // 擪̃ubNg悤ɁAtɐς
+  const uint32_t first = pageCount * blocksPerPage;
+  for (uint32_t i = blocksPerPage; i > 0; --i) {
+    freeBlocks.push_back(first + i - 1);
+  }
+  ++pageCount;
+}
+
+/**
+* ubNm
+*
+* @return mۂubNԍ. 󂫂ȂinvalidBlock
+*/
+uint32_t BlockPool::Allocate()
+{
+  // ėpł悤ɂȂubN󂫂ɖ߂
+  while (!retiredBlocks.empty() && retiredBlocks.front().frame + reuseDelay <= frame) {
+    freeBlocks.push_back(retiredBlocks.front().block);
+    retiredBlocks.pop_front();
+  }
+  if (freeBlocks.empty()) {
+    return invalidBlock;
+  }
+  const uint32_t block = freeBlocks.back();
+  freeBlocks.pop_back();
+  ++usedCount;
+  return block;
+}
+
+/**
+* ubN
+*
+* reuseDelayt[o܂ŁÃubNAllocateŕԂȂ
+*
+* @param block ubNԍ(invalidBlockȂ牽Ȃ)
+*/
+void BlockPool::Free(uint32_t block)
+{
+  if (block == invalidBlock) {
+    return;
+  }
+  retiredBlocks.push_back({ block, frame });
+  --usedCount;
+}
+
+/**
+* t[i߂
+*/
+void BlockPool::NextFrame()
+{
+  ++frame;
+}
+
+} // namespace DX12
+} // namespace EasyLib
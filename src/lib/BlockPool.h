@@ -0,0 +1,60 @@
+/**
+* @file BlockPool.h
+*/
+#ifndef EASYLIB_DX12_BLOCKPOOL_H
+#define EASYLIB_DX12_BLOCKPOOL_H
+#include <stdint.h>
+#include <deque>
+#include <vector>
+
+namespace EasyLib {
+namespace DX12 {
+
+/**
+* 傫̃ubNAy[WPʂł܂Ƃ߂Ċmۂ̈悩؂oǗNX
+*
+* ubNԍ́uy[Wԍ * y[W̃ubN + y[Ẅʒuv
+* ubŃAreuseDelayt[o܂ōėpȂ(GPUgp̉\邽)
+* 󂫂ȂAllocate͎ŝŁAĂяoŃy[Ẅ̗ĂAddPageĂ
+* GPUɂ͈ؐGȂ̂ŁAP̂ŃeXgł
+*/
+class BlockPool
+{
+public:
+  static constexpr uint32_t invalidBlock = UINT32_MAX;
+
+  BlockPool() = default;
+  ~BlockPool() = default;
+
+  void Init(uint32_t blocksPerPage, uint32_t reuseDelay);
+  void AddPage();
+  uint32_t Allocate();
+  void Free(uint32_t block);
+  void NextFrame();
+
+  uint32_t GetBlocksPerPage() const { return blocksPerPage; }
+  uint32_t GetPageCount() const { return pageCount; }
+  uint32_t GetUsedCount() const { return usedCount; }
+  uint32_t GetPage(uint32_t block) const { return block / blocksPerPage; }
+  uint32_t GetIndexInPage(uint32_t block) const { return block % blocksPerPage; }
+
+private:
+  // āAėpłt[҂ĂubN
+  struct RetiredBlock {
+    uint32_t block;
+    uint64_t frame; // t[
+  };
+  std::deque<RetiredBlock> retiredBlocks;
+  std::vector<uint32_t> freeBlocks;
+
+  uint32_t blocksPerPage = 1;
+  uint32_t reuseDelay = 0;
+  uint32_t pageCount = 0;
+  uint32_t usedCount = 0;
+  uint64_t frame = 0;
+};
+
+} // namespace DX12
+} // namespace EasyLib
+
+#endif // EASYLIB_DX12_BLOCKPOOL_H
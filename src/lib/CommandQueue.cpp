@@ -68,6 +68,15 @@ void CommandQueue::WaitForFence(uint64_t fenceValue)
   }
 }
 
+/**
+* GPUtFXl擾
+*/
+uint64_t CommandQueue::GetCompletedFenceValue()
+{
+  completedFenceValue = std::max<UINT64>(completedFenceValue, fence->GetCompletedValue());
+  return completedFenceValue;
+}
+
 /**
 * R}hL[̎sҋ@
 */
@@ -19,6 +19,7 @@ public:
   uint64_t ExecuteCommandList(ID3D12CommandList* commandList);
   uint64_t ExecuteCommandLists(uint32_t count, ID3D12CommandList** commandLists);
   void WaitForFence(uint64_t fenceValue);
+  uint64_t GetCompletedFenceValue();
   bool WaitForIdle();
   ID3D12CommandQueue* GetQueue() const { return queue.Get(); }
 
@@ -0,0 +1,47 @@
+/**
+* @file CpuFeatures.cpp
+*/
+#include "CpuFeatures.h"
+#if defined(_M_X64) || defined(_M_IX86)
+#include <intrin.h>
+#endif
+
+namespace EasyLib {
+
+/**
+* AVX2F16Cg邩ׂ
+*
+* ĂяoтCPUɖ₢킹̂ŁAʂ͌ĂяoŕۑĂ
+*/
+bool HasAVX2()
+{
+#if defined(_M_X64) || defined(_M_IX86)
+  int info[4];
+  __cpuid(info, 0);
+  if (info[0] < 7) {
+    return false;
+  }
+  __cpuid(info, 1);
+  const bool hasSSE41 = (info[2] & (1 << 19)) != 0;
+  const bool hasOSXSAVE = (info[2] & (1 << 27)) != 0;
+  const bool hasAVX = (info[2] & (1 << 28)) != 0;
+  const bool hasF16C = (info[2] & (1 << 29)) != 0;
+  if (!hasSSE41 || !hasOSXSAVE || !hasAVX || !hasF16C) {
+    return false;
+  }
+  // OSYMMWX^ۑ邩
+  if ((_xgetbv(0) & 6) != 6) {
+    return false;
+  }
+  __cpuidex(info, 7, 0);
+  return (info[1] & (1 << 5)) != 0;
+#elif defined(EASYLIB_X86_SIMD)
+  // OSYMMWX^ۑ邩܂߂ĒׂĂ
+  __builtin_cpu_init();
+  return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("f16c");
+#else
+  return false;
+#endif
+}
+
+} // namespace EasyLib
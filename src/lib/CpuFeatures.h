@@ -0,0 +1,23 @@
+/**
+* @file CpuFeatures.h
+*/
+#ifndef EASYLIB_CPUFEATURES_H
+#define EASYLIB_CPUFEATURES_H
+
+// x86SIMD߂gǂƁAAVX2g֐ɕt鑮
+// MSVC͎wȂAVX2̑gݍ݊֐g邪AGCCClang͊֐ƂɎg߂w肷
+#if defined(_M_X64) || defined(_M_IX86)
+#define EASYLIB_X86_SIMD
+#define EASYLIB_TARGET_AVX2
+#elif defined(__x86_64__)
+#define EASYLIB_X86_SIMD
+#define EASYLIB_TARGET_AVX2 __attribute__((target("avx2,f16c")))
+#endif
+
+namespace EasyLib {
+
+bool HasAVX2();
+
+} // namespace EasyLib
+
+#endif // EASYLIB_CPUFEATURES_H
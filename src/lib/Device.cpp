@@ -5,6 +5,7 @@
 #include "Texture.h"
 #include <d3dx12.h>
 #include <d3dcompiler.h>
+#include <algorithm>
 
 namespace EasyLib {
 namespace DX12 {
@@ -17,7 +18,7 @@ using Microsoft::WRL::ComPtr;
 Descriptor::~Descriptor()
 {
   if (device) {
-    device->DeallocateDescriptor(index);
+    device->DeallocateDescriptor(handle);
   }
 }
 
@@ -126,9 +127,19 @@ Device::Result Device::Initialize(uint64_t memoryReservation)
   heapNull = CreateDescriptorHeap(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV, 1, false);
   CreateShaderResourceView(nullptr, &nullDesc, heapNull.GetCPUDescriptorHandle(0));
 
-  heapCSU = CreateDescriptorHeap(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV, 1024, false);
-  heapAllocator.Init(1024);
+  heapCSU = CreateDescriptorHeap(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV, bindlessDescriptorCount, false);
+  heapBindless = CreateDescriptorHeap(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV, bindlessDescriptorCount, true);
+  descriptorSlots.Init(bindlessDescriptorCount);
 
+  // gp̔ԍNULLfXNv^ɂĂ(t[ƂɖߒKv͂Ȃ)
+  SetDescriptorsToNull(bindlessDescriptorCount, heapCSU.GetCPUDescriptorHandle(0));
+  SetDescriptorsToNull(bindlessDescriptorCount, heapBindless.GetCPUDescriptorHandle(0));
+
+  if (!uploadRing.Init(device.Get(), uploadRingInitialSize)) {
+    return Result::False;
+  }
+  textureRegistry.Init(textureRegistryCapacity);
+  workerPool.Init(WorkerPool::GetDefaultThreadCount());
 
   uploadCommandQueue = CreateCommandQueue();
 
@@ -199,6 +210,24 @@ uint64_t Device::GetCopyableFootPrint(
   return size;
 }
 
+/**
+* 擪̃Tu\[XRs[邽߂̃CAEgvZ
+*
+* @param desc           \[X
+* @param layout         Abv[hobt@̔zui[ϐ
+* @param numRows        si[ϐ
+* @param rowSizeInBytes 1s̃oCg(pfBO܂܂Ȃ)i[ϐ
+*
+* @return Rs[ɕKvȃoCg
+*/
+uint64_t Device::GetCopyableFootPrint(const D3D12_RESOURCE_DESC* desc,
+  D3D12_PLACED_SUBRESOURCE_FOOTPRINT& layout, UINT& numRows, UINT64& rowSizeInBytes)
+{
+  uint64_t size;
+  device->GetCopyableFootprints(desc, 0, 1, 0, &layout, &numRows, &rowSizeInBytes, &size);
+  return size;
+}
+
 /**
 * 2DeNX`p̃\[X쐬
 *
@@ -508,12 +537,24 @@ void Device::SetDescriptorsToNull(UINT size, D3D12_CPU_DESCRIPTOR_HANDLE destSta
 
 /**
 * fXNv^nhm
+*
+* @return mۂfXNv^. 󂫂Ȃnullptr
 */
 DescriptorPtr Device::AllocateDescriptor()
 {
+  uint32_t handle;
+  {
+    std::lock_guard<std::mutex> lock(descriptorMutex);
+    handle = descriptorSlots.Allocate();
+  }
+  if (handle == SlotAllocator::invalidHandle) {
+    return nullptr;
+  }
   auto p = std::make_shared<Descriptor>();
-  p->index = heapAllocator.Allocate();
+  p->handle = handle;
+  p->index = static_cast<int>(SlotAllocator::GetIndex(handle));
   p->handleCPU = heapCSU.GetCPUDescriptorHandle(p->index);
+  p->handleGPU = heapBindless.GetGPUDescriptorHandle(p->index);
   p->device = shared_from_this();
   return p;
 }
@@ -521,11 +562,71 @@ DescriptorPtr Device::AllocateDescriptor()
 /**
 * fXNv^nh
 *
-* @param n  nh̊Ǘԍ
+* s̃R}hXge[u̓ԍQƂĂ邩Ȃ̂ŁAɂ͉Ȃ
+* ݂̃t[GPȔIABeginFramenullr[ɂĔԍėpł悤ɂ
+*
+* @param handle  nh̊Ǘԍ
+*/
+void Device::DeallocateDescriptor(uint32_t handle)
+{
+  // IsValidBeginFrameFreeƓǗ\ǂނ̂ŁAbN̒Œׂ
+  std::lock_guard<std::mutex> lock(descriptorMutex);
+  if (descriptorSlots.IsValid(handle)) {
+    retiredDescriptors.push_back({ handle, UINT64_MAX });
+  }
+}
+
+/**
+* t[̊Jn
+*
+* GPUgIfXNv^nullr[ɂāAԍėpł悤ɂ
+*
+* @param completedFenceValue GPUtFXl
+*/
+void Device::BeginFrame(uint64_t completedFenceValue)
+{
+  uploadRing.BeginFrame(completedFenceValue);
+
+  std::lock_guard<std::mutex> lock(descriptorMutex);
+  const auto itr = std::partition(retiredDescriptors.begin(), retiredDescriptors.end(),
+    [completedFenceValue](const RetiredDescriptor& e) { return e.fenceValue > completedFenceValue; });
+  for (auto i = itr; i != retiredDescriptors.end(); ++i) {
+    // dɉꂽnhŁAėpς݂̔ԍȂ悤ɁAłƂnullɂ
+    if (descriptorSlots.Free(i->handle)) {
+      const UINT index = SlotAllocator::GetIndex(i->handle);
+      SetDescriptorsToNull(1, heapCSU.GetCPUDescriptorHandle(index));
+      SetDescriptorsToNull(1, heapBindless.GetCPUDescriptorHandle(index));
+    }
+  }
+  retiredDescriptors.erase(itr, retiredDescriptors.end());
+}
+
+/**
+* t[̏I
+*
+* @param fenceValue ̃t[̃R}hXgsƂ̃tFXl
+*/
+void Device::EndFrame(uint64_t fenceValue)
+{
+  uploadRing.EndFrame(fenceValue);
+
+  std::lock_guard<std::mutex> lock(descriptorMutex);
+  for (auto& e : retiredDescriptors) {
+    if (e.fenceValue == UINT64_MAX) {
+      e.fenceValue = fenceValue;
+    }
+  }
+}
+
+/**
+* Ɨpq[vɍ쐬r[AVF[_猩e[uɔf
+*
+* @param descriptor  ffXNv^
 */
-void Device::DeallocateDescriptor(int n)
+void Device::CommitDescriptor(const Descriptor& descriptor)
 {
-  heapAllocator.Deallocate(n);
+  device->CopyDescriptorsSimple(1, heapBindless.GetCPUDescriptorHandle(descriptor.index),
+    descriptor.handleCPU, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
 }
 
 /**
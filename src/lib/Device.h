@@ -1,11 +1,16 @@
 #ifndef EASYLIB_DX12_DEVICE_H
 #define EASYLIB_DX12_DEVICE_H
 #include "PSO.h"
+#include "SlotAllocator.h"
+#include "UploadRing.h"
+#include "TextureRegistry.h"
+#include "WorkerPool.h"
 #include <d3d12.h>
 #include <dxgi1_6.h>
 #include <wrl/client.h>
 #include <string>
 #include <memory>
+#include <mutex>
 #include <vector>
 
 namespace EasyLib {
@@ -39,6 +44,8 @@ struct IndexBuffer
 * \[XfXNv^̒ۉ
 *
 * Device::AllocateDescriptor Ŏ擾
+* GetIndex̓VF[_猩eNX`e[u(Device::GetBindlessHeap)ł̔ԍŁA
+* ܂ŕςȂ
 */
 class Descriptor
 {
@@ -49,10 +56,14 @@ public:
   ~Descriptor();
 
   D3D12_CPU_DESCRIPTOR_HANDLE GetCPUHandle() const { return handleCPU; }
+  D3D12_GPU_DESCRIPTOR_HANDLE GetGPUHandle() const { return handleGPU; }
+  int GetIndex() const { return index; }
 
 private:
   D3D12_CPU_DESCRIPTOR_HANDLE handleCPU;
+  D3D12_GPU_DESCRIPTOR_HANDLE handleGPU;
   DevicePtr device;
+  uint32_t handle = SlotAllocator::invalidHandle;
   int index;
 };
 using DescriptorPtr = std::shared_ptr<Descriptor>;
@@ -177,14 +188,35 @@ public:
   void CopyDescriptors(UINT size,
     D3D12_CPU_DESCRIPTOR_HANDLE destStart, D3D12_CPU_DESCRIPTOR_HANDLE srcStart, D3D12_DESCRIPTOR_HEAP_TYPE type);
   void SetDescriptorsToNull(UINT size, D3D12_CPU_DESCRIPTOR_HANDLE destStart);
+  const DescriptorHeap& GetBindlessHeap() const { return heapBindless; }
+  void CommitDescriptor(const Descriptor& descriptor);
+
+  // VF[_猩eNX`e[ȗ傫(VF[_numDescriptorsƈv邱)
+  static constexpr UINT bindlessDescriptorCount = 1024;
 
   GraphicsCommandContext& GetCommandContext(int frameIndex) { return context[frameIndex]; }
 
+  // t[̊JnƏI(Abv[hOƁAfXNv^̍ėpǗ)
+  void BeginFrame(uint64_t completedFenceValue);
+  void EndFrame(uint64_t fenceValue);
+
+  // t[Ƃ̓Iȃf[^̒uꏊ
+  UploadRing& GetUploadRing() { return uploadRing; }
+  static constexpr uint64_t uploadRingInitialSize = 4 * 1024 * 1024;
+
+  // R}hXg̋L^Ȃǂɍs߂̍ƗpXbh
+  WorkerPool& GetWorkerPool() { return workerPool; }
+
   // eNX`
+  TextureRegistry& GetTextureRegistry() { return textureRegistry; }
+  const TextureRegistry& GetTextureRegistry() const { return textureRegistry; }
+  static constexpr uint32_t textureRegistryCapacity = 4096;
   TexturePtr LoadTexture(const wchar_t* filename);
   TexturePtr LoadTexture(const char* filename);
   uint64_t GetCopyableFootPrint(
     const D3D12_RESOURCE_DESC* desc, uint32_t firstSubresoruce, uint32_t numSubresources, uint64_t baseOffset);
+  uint64_t GetCopyableFootPrint(const D3D12_RESOURCE_DESC* desc,
+    D3D12_PLACED_SUBRESOURCE_FOOTPRINT& layout, UINT& numRows, UINT64& rowSizeInBytes);
   Microsoft::WRL::ComPtr<ID3D12Resource> CreateUploadResource(const wchar_t* name, UINT64 byteSize);
   Microsoft::WRL::ComPtr<ID3D12Resource> CreateTexture2DResource(
     const wchar_t* name, DXGI_FORMAT format, uint32_t width, uint32_t height, D3D12_RESOURCE_STATES state);
@@ -196,7 +228,7 @@ public:
     D3D12_COMMAND_LIST_TYPE type, ID3D12CommandAllocator* allocator);
 
   DescriptorPtr AllocateDescriptor();
-  void DeallocateDescriptor(int n);
+  void DeallocateDescriptor(uint32_t handle);
 
 private:
   Microsoft::WRL::ComPtr<ID3D12Device> device;
@@ -208,28 +240,23 @@ private:
   DescriptorHeap slotDSV;
   DescriptorHeap heapNull;
 
-  struct HeapAllocator {
-    std::vector<int> freeHandles;
-
-    void Init(size_t size) {
-      freeHandles.resize(size);
-      for (int i = 0; i < static_cast<int>(size); i++) {
-        freeHandles[i] = i;
-      }
-    }
-
-    int Allocate() {
-      int a = freeHandles.back();
-      freeHandles.pop_back();
-      return a;
-    }
-
-    void Deallocate(int a) {
-      freeHandles.push_back(a);
-    }
-  };
+  // heapCSUCPU̍ƗpAheapBindless̓VF[_猩e[uŁAԍɓr[u
   DescriptorHeap heapCSU;
-  HeapAllocator heapAllocator;
+  DescriptorHeap heapBindless;
+  SlotAllocator descriptorSlots;
+
+  // fXNv^. s̃R}hXgQƂĂ邩Ȃ̂ŁA
+  // GPUgIĂnullr[ɂĔԍėp
+  struct RetiredDescriptor {
+    uint32_t handle;
+    uint64_t fenceValue; // ̃tFXlɒBėpł(EndFrame܂łUINT64_MAX)
+  };
+  std::vector<RetiredDescriptor> retiredDescriptors;
+  std::mutex descriptorMutex; // descriptorSlotsretiredDescriptors̔rp
+
+  UploadRing uploadRing;
+  TextureRegistry textureRegistry;
+  WorkerPool workerPool;
 
   CommandQueuePtr uploadCommandQueue;
 
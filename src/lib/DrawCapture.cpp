@@ -0,0 +1,482 @@
+/**
+* @file DrawCapture.cpp
+*/
+#include "DrawCapture.h"
+#include "Utf8.h"
+#include <string.h>
+
+namespace EasyLib {
+namespace DX12 {
+
+namespace /* unnamed */ {
+
+/**
+* ȂϒŒǉ
+*/
+void PutVarint(std::vector<uint8_t>& buf, uint64_t value)
+{
+  while (value >= 0x80) {
+    buf.push_back(static_cast<uint8_t>(value | 0x80));
+    value >>= 7;
+  }
+  buf.push_back(static_cast<uint8_t>(value));
+}
+
+/**
+* _ǉ
+*/
+void PutFloat(std::vector<uint8_t>& buf, float value)
+{
+  uint8_t bytes[sizeof(float)];
+  memcpy(bytes, &value, sizeof(bytes));
+  buf.insert(buf.end(), bytes, bytes + sizeof(bytes));
+}
+
+/**
+* 𒷂UTF-16Œǉ
+*/
+void PutString(std::vector<uint8_t>& buf, const std::wstring& str)
+{
+  PutVarint(buf, str.size());
+  for (const wchar_t c : str) {
+    const uint16_t u = static_cast<uint16_t>(c);
+    buf.push_back(static_cast<uint8_t>(u));
+    buf.push_back(static_cast<uint8_t>(u >> 8));
+  }
+}
+
+/**
+* 𒷂UTF-8Œǉ
+*/
+void PutString(std::vector<uint8_t>& buf, const std::string& str)
+{
+  PutVarint(buf, str.size());
+  buf.insert(buf.end(), str.begin(), str.end());
+}
+
+/**
+* oCg擪ǂݏo߂̕⏕NX
+*
+* ͈͊OǂƂƎsԂɂȂAȌ̓ǂݏoׂ͂0Ԃ
+*/
+struct Cursor
+{
+  const uint8_t* p;
+  const uint8_t* end;
+  bool failed = false;
+
+  uint8_t Byte() {
+    if (p >= end) {
+      failed = true;
+      return 0;
+    }
+    return *p++;
+  }
+
+  uint64_t Varint() {
+    uint64_t value = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+      const uint8_t b = Byte();
+      value |= static_cast<uint64_t>(b & 0x7f) << shift;
+      if (!(b & 0x80)) {
+        return value;
+      }
+    }
+    failed = true;
+    return 0;
+  }
+
+  float Float() {
+    if (end - p < static_cast<ptrdiff_t>(sizeof(float))) {
+      failed = true;
+      p = end;
+      return 0;
+    }
+    float value;
+    memcpy(&value, p, sizeof(value));
+    p += sizeof(value);
+    return value;
+  }
+
+  void String(std::wstring& str) {
+    const uint64_t length = Varint();
+    if (static_cast<uint64_t>(end - p) < length * 2) {
+      failed = true;
+      p = end;
+      str.clear();
+      return;
+    }
+    str.resize(static_cast<size_t>(length));
+    for (auto& c : str) {
+      c = static_cast<wchar_t>(p[0] | (p[1] << 8));
+      p += 2;
+    }
+  }
+
+  void String(std::string& str) {
+    const uint64_t length = Varint();
+    if (static_cast<uint64_t>(end - p) < length) {
+      failed = true;
+      p = end;
+      str.clear();
+      return;
+    }
+    str.assign(reinterpret_cast<const char*>(p), static_cast<size_t>(length));
+    p += length;
+  }
+
+  // o[W1UTF-16̕UTF-8ɕϊēǂݏo
+  void Utf16String(std::string& str) {
+    std::wstring utf16;
+    String(utf16);
+    str.clear();
+    str.reserve(utf16.size());
+    for (size_t i = 0; i < utf16.size(); ++i) {
+      char32_t c = static_cast<uint16_t>(utf16[i]);
+      if (c >= 0xd800 && c <= 0xdbff && i + 1 < utf16.size()) {
+        const char32_t low = static_cast<uint16_t>(utf16[i + 1]);
+        if (low >= 0xdc00 && low <= 0xdfff) {
+          c = 0x10000 + ((c - 0xd800) << 10) + (low - 0xdc00);
+          ++i;
+        }
+      }
+      AppendUtf8(str, c);
+    }
+  }
+};
+
+bool IsWhite(const DirectX::XMFLOAT4& color)
+{
+  return color.x == 1 && color.y == 1 && color.z == 1 && color.w == 1;
+}
+
+} // unnamed namespace
+
+/**
+* Lv`t@C쐬
+*
+* @param filename t@C
+* @param width    ʂ̕
+* @param height   ʂ̍
+* @param resolver eNX`nh疼O߂֐
+*/
+bool DrawCaptureWriter::Open(const char* filename, float width, float height, const NameResolver& resolver)
+{
+  Close();
+  fp.reset(fopen(filename, "wb"));
+  if (!fp) {
+    return false;
+  }
+  DrawCaptureFormat::Header header = {};
+  memcpy(header.magic, DrawCaptureFormat::magic, sizeof(header.magic));
+  header.version = DrawCaptureFormat::version;
+  header.width = width;
+  header.height = height;
+  if (fwrite(&header, sizeof(header), 1, fp.get()) != 1) {
+    fp.reset();
+    return false;
+  }
+  this->resolver = resolver;
+  statistics = {};
+  statistics.byteCount = sizeof(header);
+  return true;
+}
+
+/**
+* Lv`t@C
+*/
+void DrawCaptureWriter::Close()
+{
+  fp.reset();
+  handleToIndex.clear();
+  nameToIndex.clear();
+}
+
+/**
+* eNX`ԍ擾
+*
+* ߂ēoꂵOȂԍ蓖āAeNX`R[hǉ
+* 摜o^ănhςĂAOȂ瓯ԍɂȂ
+*
+* @return eNX`ԍ. ȃnhȂ0
+*/
+uint32_t DrawCaptureWriter::InternTexture(TextureHandle handle)
+{
+  if (handle == invalidTextureHandle) {
+    return 0;
+  }
+  const auto itr = handleToIndex.find(handle);
+  if (itr != handleToIndex.end()) {
+    return itr->second;
+  }
+  std::wstring name = resolver ? resolver(handle) : std::wstring();
+  auto itrName = nameToIndex.find(name);
+  if (itrName == nameToIndex.end()) {
+    const uint32_t index = static_cast<uint32_t>(nameToIndex.size() + 1);
+    textureRecords.push_back(DrawCaptureFormat::recordTexture);
+    PutString(textureRecords, name);
+    itrName = nameToIndex.emplace(std::move(name), index).first;
+    ++statistics.textureCount;
+  }
+  handleToIndex.emplace(handle, itrName->second);
+  return itrName->second;
+}
+
+/**
+* 1t[̕`f[^
+*
+* @param pSprite     XvCgz
+* @param spriteCount XvCg̐
+* @param pText       z
+* @param textCount   ̐
+*/
+bool DrawCaptureWriter::WriteFrame(const Sprite* pSprite, size_t spriteCount, const Text* pText, size_t textCount)
+{
+  if (!fp) {
+    return false;
+  }
+  using namespace DrawCaptureFormat;
+
+  textureRecords.clear();
+  frameRecord.clear();
+  frameRecord.push_back(recordFrame);
+  PutVarint(frameRecord, spriteCount);
+  PutVarint(frameRecord, textCount);
+
+  for (size_t i = 0; i < spriteCount; ++i) {
+    const Sprite& e = pSprite[i];
+    uint8_t flags = static_cast<uint8_t>(e.blendMode) & spriteBlendMask;
+    flags |= e.position.z != 0 ? spriteHasDepth : 0;
+    flags |= e.rotation != 0 ? spriteHasRotation : 0;
+    flags |= !IsWhite(e.color) ? spriteHasColor : 0;
+    PutVarint(frameRecord, InternTexture(e.texture));
+    frameRecord.push_back(e.layer);
+    frameRecord.push_back(flags);
+    PutFloat(frameRecord, e.position.x);
+    PutFloat(frameRecord, e.position.y);
+    if (flags & spriteHasDepth) {
+      PutFloat(frameRecord, e.position.z);
+    }
+    if (flags & spriteHasRotation) {
+      PutFloat(frameRecord, e.rotation);
+    }
+    PutFloat(frameRecord, e.scale.x);
+    PutFloat(frameRecord, e.scale.y);
+    if (flags & spriteHasColor) {
+      PutFloat(frameRecord, e.color.x);
+      PutFloat(frameRecord, e.color.y);
+      PutFloat(frameRecord, e.color.z);
+      PutFloat(frameRecord, e.color.w);
+    }
+  }
+
+  for (size_t i = 0; i < textCount; ++i) {
+    const Text& e = pText[i];
+    uint8_t flags = 0;
+    flags |= (e.scale.x != 1 || e.scale.y != 1) ? textHasScale : 0;
+    flags |= !IsWhite(e.color) ? textHasColor : 0;
+    frameRecord.push_back(flags);
+    PutString(frameRecord, e.text);
+    PutFloat(frameRecord, e.position.x);
+    PutFloat(frameRecord, e.position.y);
+    if (flags & textHasScale) {
+      PutFloat(frameRecord, e.scale.x);
+      PutFloat(frameRecord, e.scale.y);
+    }
+    if (flags & textHasColor) {
+      PutFloat(frameRecord, e.color.x);
+      PutFloat(frameRecord, e.color.y);
+      PutFloat(frameRecord, e.color.z);
+      PutFloat(frameRecord, e.color.w);
+    }
+    statistics.rawByteCount += e.text.size();
+  }
+
+  // VeNX`̓t[ɏ
+  if (fwrite(textureRecords.data(), 1, textureRecords.size(), fp.get()) != textureRecords.size() ||
+    fwrite(frameRecord.data(), 1, frameRecord.size(), fp.get()) != frameRecord.size()) {
+    Close();
+    return false;
+  }
+  ++statistics.frameCount;
+  statistics.byteCount += textureRecords.size() + frameRecord.size();
+  statistics.rawByteCount += spriteCount * sizeof(Sprite) + textCount * sizeof(Text);
+  return true;
+}
+
+/**
+* Lv`t@Cǂݍ
+*
+* @param filename t@C
+*
+* @retval true  ǂݍ߂
+* @retval false t@CȂA܂͌`Ȃ
+*
+* Q[rŏIꍇȂǁAŌ̃R[hr؂ĂȂO܂łǂݍ
+*/
+bool DrawCaptureReader::Load(const char* filename)
+{
+  data.clear();
+  frameOffsets.clear();
+  textureNames.clear();
+  textureHandles.clear();
+
+  const std::unique_ptr<FILE, decltype(&fclose)> fp(fopen(filename, "rb"), fclose);
+  if (!fp) {
+    return false;
+  }
+  uint8_t buf[64 * 1024];
+  for (;;) {
+    const size_t n = fread(buf, 1, sizeof(buf), fp.get());
+    if (n == 0) {
+      break;
+    }
+    data.insert(data.end(), buf, buf + n);
+  }
+
+  if (data.size() < sizeof(header)) {
+    return false;
+  }
+  memcpy(&header, data.data(), sizeof(header));
+  if (memcmp(header.magic, DrawCaptureFormat::magic, sizeof(header.magic)) != 0 ||
+    header.version < DrawCaptureFormat::utf16TextVersion || header.version > DrawCaptureFormat::version) {
+    return false;
+  }
+
+  // R[hɂǂāAeNX`ƃt[̈ʒuW߂
+  std::vector<Sprite> sprites;
+  std::vector<Text> texts;
+  size_t offset = sizeof(header);
+  while (offset < data.size()) {
+    const uint8_t type = data[offset++];
+    if (type == DrawCaptureFormat::recordTexture) {
+      Cursor cursor = { data.data() + offset, data.data() + data.size() };
+      std::wstring name;
+      cursor.String(name);
+      if (cursor.failed) {
+        break;
+      }
+      offset = cursor.p - data.data();
+      textureNames.push_back(std::move(name));
+      textureHandles.push_back(static_cast<TextureHandle>(textureNames.size()));
+    } else if (type == DrawCaptureFormat::recordFrame) {
+      frameOffsets.push_back(offset);
+      if (!DecodeFrame(offset, sprites, texts)) {
+        frameOffsets.pop_back();
+        break;
+      }
+    } else {
+      break;
+    }
+  }
+  return true;
+}
+
+/**
+* eNX`ԍɑΉnhݒ肷
+*
+* Đŉ摜ǂݍ񂾏ꍇAReadFrameԂXvCg̃eNX`ۂ̃nhɂł
+*
+* @param textureIndex eNX`ԍ(1ȏ)
+* @param handle       ReadFrameŐݒ肷nh
+*/
+void DrawCaptureReader::SetTextureHandle(uint32_t textureIndex, TextureHandle handle)
+{
+  if (textureIndex >= 1 && textureIndex <= textureHandles.size()) {
+    textureHandles[textureIndex - 1] = handle;
+  }
+}
+
+/**
+* t[WJ
+*
+* @param index   t[ԍ
+* @param sprites XvCgi[z
+* @param texts   i[z
+*/
+bool DrawCaptureReader::ReadFrame(size_t index, std::vector<Sprite>& sprites, std::vector<Text>& texts) const
+{
+  if (index >= frameOffsets.size()) {
+    return false;
+  }
+  size_t offset = frameOffsets[index];
+  return DecodeFrame(offset, sprites, texts);
+}
+
+/**
+* t[R[h̓eWJ
+*
+* @param offset  t[R[h̓ëʒu. ƃR[h̎̈ʒuɂȂ
+* @param sprites XvCgi[z
+* @param texts   i[z
+*/
+bool DrawCaptureReader::DecodeFrame(size_t& offset, std::vector<Sprite>& sprites, std::vector<Text>& texts) const
+{
+  using namespace DrawCaptureFormat;
+
+  Cursor cursor = { data.data() + offset, data.data() + data.size() };
+  const uint64_t spriteCount = cursor.Varint();
+  const uint64_t textCount = cursor.Varint();
+  // ꂽt@CŋȔzmۂȂ悤ɁAc̃oCgŏmF
+  // (XvCg͍ŏ11oCgA͍ŏ10oCg)
+  const uint64_t remaining = static_cast<uint64_t>(cursor.end - cursor.p);
+  if (cursor.failed || spriteCount > remaining / 11 || textCount > remaining / 10) {
+    return false;
+  }
+
+  sprites.resize(static_cast<size_t>(spriteCount));
+  for (Sprite& e : sprites) {
+    const uint64_t texture = cursor.Varint();
+    e.texture = (texture >= 1 && texture <= textureHandles.size()) ?
+      textureHandles[static_cast<size_t>(texture - 1)] : invalidTextureHandle;
+    e.layer = cursor.Byte();
+    const uint8_t flags = cursor.Byte();
+    e.blendMode = static_cast<BlendMode>(flags & spriteBlendMask);
+    e.position.x = cursor.Float();
+    e.position.y = cursor.Float();
+    e.position.z = (flags & spriteHasDepth) ? cursor.Float() : 0;
+    e.rotation = (flags & spriteHasRotation) ? cursor.Float() : 0;
+    e.scale.x = cursor.Float();
+    e.scale.y = cursor.Float();
+    e.color = DirectX::XMFLOAT4(1, 1, 1, 1);
+    if (flags & spriteHasColor) {
+      e.color.x = cursor.Float();
+      e.color.y = cursor.Float();
+      e.color.z = cursor.Float();
+      e.color.w = cursor.Float();
+    }
+  }
+
+  texts.resize(static_cast<size_t>(textCount));
+  for (Text& e : texts) {
+    const uint8_t flags = cursor.Byte();
+    if (header.version <= DrawCaptureFormat::utf16TextVersion) {
+      cursor.Utf16String(e.text);
+    } else {
+      cursor.String(e.text);
+    }
+    e.position.x = cursor.Float();
+    e.position.y = cursor.Float();
+    e.scale = DirectX::XMFLOAT2(1, 1);
+    if (flags & textHasScale) {
+      e.scale.x = cursor.Float();
+      e.scale.y = cursor.Float();
+    }
+    e.color = DirectX::XMFLOAT4(1, 1, 1, 1);
+    if (flags & textHasColor) {
+      e.color.x = cursor.Float();
+      e.color.y = cursor.Float();
+      e.color.z = cursor.Float();
+      e.color.w = cursor.Float();
+    }
+  }
+
+  if (cursor.failed) {
+    return false;
+  }
+  offset = cursor.p - data.data();
+  return true;
+}
+
+} // namespace DX12
+} // namespace EasyLib
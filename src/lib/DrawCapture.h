@@ -0,0 +1,149 @@
+/**
+* @file DrawCapture.h
+*/
+#ifndef EASYLIB_DX12_DRAWCAPTURE_H
+#define EASYLIB_DX12_DRAWCAPTURE_H
+#include "DrawData.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace EasyLib {
+namespace DX12 {
+
+/**
+* `f[^̃Lv`t@C`
+*
+* t@C̐擪 HeaderǍɃR[h
+* R[h1oCg̎ނ̌ɓe. ͉ϒ(LEB128)A_̓gGfBA32bit
+*
+* - Texture: O̒AO(UTF-16)
+*   eNX`͏߂Ďgꂽt[̒OɈx܂Aoꏇ1ԍt
+* - Frame: XvCgA񐔁AXvCg̔zA̔z
+*   XvCg: eNX`ԍ(0͖)AC[AtOAxAyA[[x]A[]]AAA[F]
+*   : tOAA(UTF-8)AxAyA[g嗦]A[F]
+*   []̒l̓tOĂƂ܂(l0܂1)
+*
+* o[W1͕̕UTF-16ŏł(16bitP). ǂݍ݂͂ǂɂΉ
+*/
+namespace DrawCaptureFormat {
+
+struct Header {
+  char magic[4];  // "EDCP"
+  uint32_t version;
+  float width;    // ʂ̕
+  float height;   // ʂ̍
+};
+
+constexpr char magic[4] = { 'E', 'D', 'C', 'P' };
+constexpr uint32_t version = 2;
+constexpr uint32_t utf16TextVersion = 1; // UTF-16ŏłŌ̃o[W
+
+constexpr uint8_t recordTexture = 1;
+constexpr uint8_t recordFrame = 2;
+
+// XvCg̃tO(2bit̓uh[h)
+constexpr uint8_t spriteBlendMask = 0x03;
+constexpr uint8_t spriteHasDepth = 0x04;
+constexpr uint8_t spriteHasRotation = 0x08;
+constexpr uint8_t spriteHasColor = 0x10;
+
+// ̃tO
+constexpr uint8_t textHasScale = 0x01;
+constexpr uint8_t textHasColor = 0x02;
+
+} // namespace DrawCaptureFormat
+
+/**
+* Lv`̓v
+*/
+struct DrawCaptureStatistics
+{
+  size_t frameCount = 0;   // 񂾃t[
+  size_t textureCount = 0; // 񂾃eNX`̐
+  uint64_t byteCount = 0;  // 񂾃oCg
+  uint64_t rawByteCount = 0; // SpriteATextẑ܂܏ꍇ̃oCg
+};
+
+/**
+* t[̃XvCgƕt@CɏoNX
+*
+* eNX`̓nhł͂ȂOŋL^̂ŁAʂ̎sœǂݍł摜w
+* t[͓̃obt@ɂ܂Ƃ߂Ă1ŏ
+*/
+class DrawCaptureWriter
+{
+public:
+  // eNX`nh疼O߂֐
+  using NameResolver = std::function<std::wstring(TextureHandle)>;
+
+  DrawCaptureWriter() = default;
+  ~DrawCaptureWriter() = default;
+  DrawCaptureWriter(const DrawCaptureWriter&) = delete;
+  DrawCaptureWriter& operator=(const DrawCaptureWriter&) = delete;
+
+  bool Open(const char* filename, float width, float height, const NameResolver& resolver);
+  void Close();
+  bool IsOpen() const { return fp != nullptr; }
+
+  bool WriteFrame(const Sprite* pSprite, size_t spriteCount, const Text* pText, size_t textCount);
+
+  const DrawCaptureStatistics& GetStatistics() const { return statistics; }
+
+private:
+  uint32_t InternTexture(TextureHandle handle);
+
+  std::unique_ptr<FILE, decltype(&fclose)> fp{ nullptr, fclose };
+  NameResolver resolver;
+  std::unordered_map<TextureHandle, uint32_t> handleToIndex; // nheNX`ԍ
+  std::unordered_map<std::wstring, uint32_t> nameToIndex;    // OeNX`ԍ
+  std::vector<uint8_t> textureRecords; // ̃t[ŐVoꂵeNX`̃R[h
+  std::vector<uint8_t> frameRecord;
+  DrawCaptureStatistics statistics;
+};
+
+/**
+* Lv`t@CǂݍރNX
+*
+* t@CŜɓǂݍ݁At[̈ʒu𒲂ׂĂ
+* ReadFrame̓t[WJ邾Ȃ̂ŁAxłJԂǂ߂
+*/
+class DrawCaptureReader
+{
+public:
+  DrawCaptureReader() = default;
+  ~DrawCaptureReader() = default;
+  DrawCaptureReader(const DrawCaptureReader&) = delete;
+  DrawCaptureReader& operator=(const DrawCaptureReader&) = delete;
+
+  bool Load(const char* filename);
+
+  float GetWidth() const { return header.width; }
+  float GetHeight() const { return header.height; }
+  size_t GetFrameCount() const { return frameOffsets.size(); }
+  size_t GetByteCount() const { return data.size(); }
+
+  // eNX`(Y̓eNX`ԍ-1)
+  const std::vector<std::wstring>& GetTextureNames() const { return textureNames; }
+  void SetTextureHandle(uint32_t textureIndex, TextureHandle handle);
+
+  bool ReadFrame(size_t index, std::vector<Sprite>& sprites, std::vector<Text>& texts) const;
+
+private:
+  bool DecodeFrame(size_t& offset, std::vector<Sprite>& sprites, std::vector<Text>& texts) const;
+
+  std::vector<uint8_t> data;
+  DrawCaptureFormat::Header header = {};
+  std::vector<size_t> frameOffsets; // t[R[h̓ëʒu
+  std::vector<std::wstring> textureNames;
+  std::vector<TextureHandle> textureHandles; // eNX`ԍnh(ł͔ԍ̂)
+};
+
+} // namespace DX12
+} // namespace EasyLib
+
+#endif // EASYLIB_DX12_DRAWCAPTURE_H
@@ -0,0 +1,63 @@
+/**
+* @file DrawData.h
+*/
+#ifndef EASYLIB_DX12_DRAWDATA_H
+#define EASYLIB_DX12_DRAWDATA_H
+#include "TextureRegistry.h"
+#include "PortableMath.h"
+#include <stdint.h>
+#include <string>
+#include <type_traits>
+
+namespace EasyLib {
+namespace DX12 {
+
+/**
+* `̎wɎgf[^^
+*
+* D3D12ɈˑȂ̂ŁA\tgEFA_[c[g
+*/
+
+enum class BlendMode {
+  Opaque,
+  Multiply,
+  Addition,
+  Subtraction,
+};
+
+/**
+* XvCg
+*
+* eNX`TextureRegistrỹnhŎw肷
+* t[ʂɃRs[̂ŁAQƃJEgȂǂȂPȍ\̂ɂĂ
+*
+* `揇layeȑAC[̒łposition.z([x)̑傫
+* C[Ɛ[xȂ`wɂȂ(SortByTextureLȏꍇ̓eNX`)
+*/
+struct Sprite
+{
+  TextureHandle texture;
+  DirectX::XMFLOAT3 position; // z̓C[̐[x(傫قǉ)
+  float rotation;
+  DirectX::XMFLOAT2 scale;
+  DirectX::XMFLOAT4 color;
+  uint8_t layer = 0; // 傫قǎO
+  BlendMode blendMode = BlendMode::Multiply;
+};
+static_assert(std::is_trivially_copyable<Sprite>::value, "Sprite must be trivially copyable");
+
+/**
+* 
+*/
+struct Text
+{
+  std::string text; // UTF-8
+  DirectX::XMFLOAT2 position;
+  DirectX::XMFLOAT2 scale;
+  DirectX::XMFLOAT4 color;
+};
+
+} // namespace DX12
+} // namespace EasyLib
+
+#endif // EASYLIB_DX12_DRAWDATA_H
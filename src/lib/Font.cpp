@@ -3,12 +3,15 @@
 */
 #define NOMINMAX
 #include "Font.h"
+#include "FontData.h"
 #include "Device.h"
 #include "PSO.h"
 #include "Log.h"
 #include <d3dx12.h>
+#include <algorithm>
 #include <iostream>
 #include <stdio.h>
+#include <string.h>
 
 namespace EasyLib {
 namespace DX12 {
@@ -17,42 +20,18 @@ using namespace DirectX;
 using namespace DirectX::PackedVector;
 using Microsoft::WRL::ComPtr;
 
-/**
-* VF[_ptHgf[^
-*/
-struct FontInfoInShader
-{
-  uint32_t page;
-  XMFLOAT2 uv[2];
-  XMFLOAT2 size;
-  XMFLOAT2 offset;
-};
-
-struct CharacterInShader
-{
-  XMFLOAT2 position;
-  XMFLOAT2 scale;
-  XMFLOAT4 color;
-  XMFLOAT4 subColor;
-  float thickness;
-  float outline;
-  uint32_t fontIndex;
-};
-
 /**
 * tHg`IuWFNg
 *
 * @param devide            D3D12foCX
 * @param framebufferCount  `obt@̐
-* @param capacity          ő`敶
 *
 * @retval true  
 * @retval false s
 */
-bool FontRenderer::Initialize(DevicePtr device, size_t framebufferCount, size_t capacity)
+bool FontRenderer::Initialize(DevicePtr device, size_t framebufferCount)
 {
   this->framebufferCount = framebufferCount;
-  this->capacity = capacity;
   this->device = device;
 
 	pso = device->CreatePipelineState(L"res/shader/Font.hlsl", L"res/shader/Font.hlsl",
@@ -66,24 +45,16 @@ bool FontRenderer::Initialize(DevicePtr device, size_t framebufferCount, size_t
 		return false;
 	}
 
+	// q[v0Ԗڂɂ̓tHgobt@蓖Ă
+	// 1Ԗڈȍ~͕`掞̃eNX`蓖Ă
+	// f[^̓t[ƂɃfoCX̃Abv[hOmۂ
 	for (int i = 0; i < static_cast<int>(framebufferCount); i++) {
-		wchar_t bufferName[] = L"Font Character Buffer 0";
-		bufferName[std::size(bufferName) - 1] += static_cast<wchar_t>(i);
-		commandContexts[i].characterBuffer = device->CreateUploadResource(bufferName, sizeof(CharacterInShader) * capacity);
 		commandContexts[i].allocator = device->CreateCommandAllocator(D3D12_COMMAND_LIST_TYPE_DIRECT);
 		commandContexts[i].list = device->CreateCommandList(D3D12_COMMAND_LIST_TYPE_DIRECT, commandContexts[i].allocator.Get());
 
-		if (!commandContexts[i].characterBuffer || !commandContexts[i].allocator || !commandContexts[i].list) {
+		if (!commandContexts[i].allocator || !commandContexts[i].list) {
 			return false;
 		}
-
-		// q[v0Ԗڂɂ̓tHgobt@蓖Ă
-		// q[v1-3Ԗڂɂ͕obt@蓖Ă
-		// 4Ԗڈȍ~͕`掞̃eNX`蓖Ă
-		D3D12_SHADER_RESOURCE_VIEW_DESC view = 
-			CD3DX12_SHADER_RESOURCE_VIEW_DESC::StructuredBuffer(static_cast<UINT>(capacity), sizeof(CharacterInShader));
-		D3D12_CPU_DESCRIPTOR_HANDLE heapHandle = heap.GetCPUDescriptorHandle(HeapID_Character0 + i);
-		device->CreateShaderResourceView(commandContexts[i].characterBuffer.Get(), &view, heapHandle);
 	}
 
 	indexBuffer = device->CreateUploadResource(L"Font Index Buffer", sizeof(uint16_t) * 6);
@@ -104,14 +75,12 @@ bool FontRenderer::Initialize(DevicePtr device, size_t framebufferCount, size_t
 	viewIB.Format = DXGI_FORMAT_R16_UINT;
 	viewIB.SizeInBytes = sizeof(indices);
 
-	fontBuffer = device->CreateUploadResource(L"Font Buffer", sizeof(FontInfoInShader) * 65536);
-	if (!fontBuffer) {
-		return false;
-	}
-	D3D12_SHADER_RESOURCE_VIEW_DESC viewFont = 
-		CD3DX12_SHADER_RESOURCE_VIEW_DESC::StructuredBuffer(65536, sizeof(FontInfoInShader));
-	D3D12_CPU_DESCRIPTOR_HANDLE handleFont = heap.GetCPUDescriptorHandle(HeapID_FontInfo);
-	device->CreateShaderResourceView(fontBuffer.Get(), &viewFont, handleFont);
+	// tHgobt@́ALoadFromFileō쐬
+	device->SetDescriptorsToNull(1, heap.GetCPUDescriptorHandle(HeapID_FontInfo));
+	glyphList.assign(1, FontInfo());
+	glyphPageBits.assign(1, 0);
+	glyphTable.Clear();
+	UpdateTextLayout();
 
   return true;
 }
@@ -119,6 +88,10 @@ bool FontRenderer::Initialize(DevicePtr device, size_t framebufferCount, size_t
 /**
 * tHgt@Cǂݍ
 *
+* ꏊɕϊς݃t@C(.fntb)΂ǂݍ݁AȂ΃eLXg`ǂݍ
+* ϊς݃t@Ctools/font_convertō쐬
+* tHg摜͂ł͓ǂݍ܂Ả摜̕߂ĕ`悷Ƃɓǂݍ
+*
 * @param filename tHgt@C
 *
 * @retval true  ǂݍݐ
@@ -126,144 +99,447 @@ bool FontRenderer::Initialize(DevicePtr device, size_t framebufferCount, size_t
 */
 bool FontRenderer::LoadFromFile(const char* filename)
 {
-  const std::unique_ptr<FILE, decltype(&fclose)> fp(fopen(filename, "r"), fclose);
-  if (!fp) {
+  FontData data;
+  if (!data.Load(filename)) {
+    LOG("ERROR: %s̓ǂݍ݂Ɏs(line=%d)\n", filename, data.errorLine);
     return false;
   }
-
-  int line = 1;
-  float fontSize;
-  int ret = fscanf(fp.get(), "info face=%*s size=%f bold=%*d italic=%*d charset=%*s"
-    " unicode=%*d stretchH=%*d smooth=%*d aa=%*d padding=%d,%d,%d,%d spacing=%*d,%*d",
-    &fontSize, &paddingUp, &paddingRight, &paddingDown, &paddingLeft);
-  if (ret < 5) {
-    LOG("ERROR: %s̓ǂݍ݂Ɏs(line=%d)\n", filename, line);
+  paddingUp = data.paddingUp;
+  paddingRight = data.paddingRight;
+  paddingDown = data.paddingDown;
+  paddingLeft = data.paddingLeft;
+  fontHeight = data.fontSize + static_cast<float>(paddingUp + paddingDown + 4); // 4 = \̗](͋CŌ߂)
+
+  std::string directory = filename;
+  const size_t lastSlashIndex = directory.find_last_of('/', std::string::npos);
+  if (lastSlashIndex == std::string::npos) {
+    directory.clear();
+  } else {
+    directory.resize(lastSlashIndex + 1);
+  }
+  if (data.pages.size() > maxPageCount) {
+    LOG("ERROR: %s̉摜܂(%zu)\n", filename, data.pages.size());
     return false;
   }
-  fontHeight = fontSize + static_cast<float>(paddingUp + paddingDown + 4); // 4 = \̗](͋CŌ߂)
-  ++line;
-
-  XMFLOAT2 textureSize;
-  ret = fscanf(fp.get(), " common lineHeight=%*d base=%*d scaleW=%f scaleH=%f pages=%*d packed=%*d",
-    &textureSize.x, &textureSize.y);
-  if (ret < 2) {
-    LOG("ERROR: %s̓ǂݍ݂Ɏs(line=%d)\n", filename, line);
+
+  // ԍFontData̓Y+1ŁA0Ԃ͕ȂƂɎg̕
+  if (!glyphTable.Build(data.codePoints.data(), data.codePoints.size())) {
+    LOG("ERROR: %s̕܂\n", filename);
     return false;
   }
-  const XMFLOAT2 reciprocalTextureSize = XMFLOAT2(1.0f / textureSize.x, 1.0f / textureSize.y);
-  ++line;
-
-  std::vector<std::string> texNameList;
-  for (;;) {
-    char tex[128];
-    ret = fscanf(fp.get(), " page id=%*d file=%127s", tex);
-    if (ret < 1) {
-      break;
+  fixedAdvance = 0;
+  glyphList.assign(data.codePoints.size() + 1, FontInfo());
+  glyphPageBits.assign(data.codePoints.size() + 1, 0);
+  for (size_t i = 0; i < data.codePoints.size(); ++i) {
+    FontInfo& font = glyphList[i + 1];
+    font.size = data.glyphs[i].size;
+    font.xadvance = data.advances[i];
+    if (font.xadvance > fixedAdvance) {
+      fixedAdvance = font.xadvance;
     }
-    std::string texFilename = filename;
-    const size_t lastSlashIndex = texFilename.find_last_of('/', std::string::npos);
-    if (lastSlashIndex == std::string::npos) {
-      texFilename.clear();
-    } else {
-      texFilename.resize(lastSlashIndex + 1);
+    if (font.size.x && font.size.y && data.glyphs[i].page < maxPageCount) {
+      glyphPageBits[i + 1] = 1u << data.glyphs[i].page;
     }
-    texFilename.append(tex + 1); // ŏ́u"v𔲂Ēǉ.
-    texFilename.pop_back(); // Ṓu"v.
-    texNameList.push_back(texFilename);
-    ++line;
   }
-  if (texNameList.empty()) {
-    LOG("ERROR: %s̓ǂݍ݂Ɏs(line=%d)\n", filename, line);
+  UpdateTextLayout();
+
+  // VF[_ptHgf[^͎ۂ̕mۂAFontData̔ẑ܂܃Rs[
+  if (fontBuffer) {
+    device->GetUploadRing().DeferRelease(std::move(fontBuffer));
+  }
+  const size_t glyphCount = glyphList.size();
+  fontBuffer = device->CreateUploadResource(L"Font Buffer", sizeof(FontInfoInShader) * glyphCount);
+  if (!fontBuffer) {
     return false;
   }
+  D3D12_RANGE range = { 0, 0 };
+  void* p;
+  fontBuffer->Map(0, &range, &p);
+  memset(p, 0, sizeof(FontInfoInShader));
+  if (!data.glyphs.empty()) {
+    memcpy(static_cast<FontInfoInShader*>(p) + 1, data.glyphs.data(), data.glyphs.size() * sizeof(FontInfoInShader));
+  }
+  fontBuffer->Unmap(0, nullptr);
+  const D3D12_SHADER_RESOURCE_VIEW_DESC viewFont =
+    CD3DX12_SHADER_RESOURCE_VIEW_DESC::StructuredBuffer(static_cast<UINT>(glyphCount), sizeof(FontInfoInShader));
+  device->CreateShaderResourceView(fontBuffer.Get(), &viewFont, heap.GetCPUDescriptorHandle(HeapID_FontInfo));
 
-  int charCount;
-  ret = fscanf(fp.get(), " chars count=%d", &charCount);
-  if (ret < 1) {
-    LOG("ERROR: %s̓ǂݍ݂Ɏs(line=%d)\n", filename, line);
-    return false;
+  for (size_t i = 0; i < pages.size(); ++i) {
+    ReleasePage(i);
   }
-  ++line;
+  pages.assign(data.pages.size(), FontPage());
+  for (size_t i = 0; i < data.pages.size(); ++i) {
+    pages[i].filename = directory + data.pages[i];
+  }
+  device->SetDescriptorsToNull(static_cast<UINT>(maxPageCount), heap.GetCPUDescriptorHandle(HeapID_Texture0));
+  return true;
+}
 
-  std::vector<FontInfoInShader> shaderFonts;
-  shaderFonts.resize(65536);
+/**
+* f[^gĂy[W𒲂ׂ
+*
+* @return gĂy[W̃rbg̘_a
+*/
+uint32_t FontRenderer::CollectPages(const GlyphInShader* p, size_t count) const
+{
+  uint32_t pageMask = 0;
+  for (size_t i = 0; i < count; ++i) {
+    pageMask |= glyphPageBits[p[i].fontIndex];
+  }
+  return pageMask;
+}
 
-  fixedAdvance = 0;
-  fontList.resize(65536);
-  for (int i = 0; i < charCount; ++i) {
-    FontInfo font;
-    FontInfoInShader shaderFont;
-    XMFLOAT2 uv;
-    ret = fscanf(fp.get(), " char id=%d x=%f y=%f width=%f height=%f xoffset=%f yoffset=%f xadvance=%f page=%d chnl=%*d",
-      &font.id, &uv.x, &uv.y, &font.size.x, &font.size.y, &font.offset.x, &font.offset.y, &font.xadvance, &font.page);
-    if (ret < 8) {
-      LOG("ERROR: %s̓ǂݍ݂Ɏs(line=%d)\n", filename, line);
-      return false;
+/**
+* y[WgƂL^Aǂݍ܂ĂȂΓǂݍ
+*
+* @param pageMask gy[W̃rbg
+*/
+void FontRenderer::TouchPages(uint32_t pageMask)
+{
+  for (size_t i = 0; i < pages.size(); ++i) {
+    if (!(pageMask & (1u << i))) {
+      continue;
     }
-    if (ret < 9) {
-      font.page = 0;
+    FontPage& page = pages[i];
+    page.lastUsedFrame = frameCount;
+    if (!page.texture && !page.failed) {
+      LoadPage(i);
     }
-    //font.offset.y *= -1;
-    //uv.y = textureSize.y - uv.y - font.size.y;
-    font.uv[0].x = uv.x * reciprocalTextureSize.x;
-    font.uv[0].y = uv.y * reciprocalTextureSize.y;
-    font.uv[1].x = (uv.x + font.size.x) * reciprocalTextureSize.x;
-    font.uv[1].y = (uv.y + font.size.y) * reciprocalTextureSize.y;
-    shaderFont.page = font.page;
-    shaderFont.offset = font.offset;
-    shaderFont.size = font.size;
-    shaderFont.uv[0] = font.uv[0];
-    shaderFont.uv[1] = font.uv[1];
-    if (font.id < 65536) {
-      fontList[font.id] = font;
-      shaderFonts[font.id] = shaderFont;
-      if (font.xadvance > fixedAdvance) {
-        fixedAdvance = font.xadvance;
+  }
+}
+
+/**
+* ODrawŎgꂽy[Wǂݍ݁A\Z𒴂ĂΎgĂȂy[Wj
+*
+* Draw͍ƗpXbhŎŝŁAy[W̏Ԃɂ͐GꂸAgy[W̃rbgusedPageMaskɉ
+* y[W̎gpL^Aǂݍ݁Ajׂ͂Ă(CXbh)ōs
+* ǂݍ݂̓foCX̃eNX`쐬ƃAbv[hgA܂ő҂̂ŁA
+* Draw܂ޕ񏈗n߂OɌĂԂ
+*
+* Vy[WǵAgn߂t[ł͂̃y[W̕\ꂸÃt[\
+* (DrawŔzuď߂ĕKvȃy[W킩邽)
+* ŏ̃t[\́ABuildStaticLayerŐÓIC[ɂĂ΁A
+* 쐬Ƀy[W𒲂ׂ̂ŁA`OUpdatePagesœǂݍ܂
+*/
+void FontRenderer::UpdatePages()
+{
+  ++frameCount;
+  statistics.pageLoadCount = 0;
+  statistics.pageEvictCount = 0;
+  TouchPages(usedPageMask.exchange(0, std::memory_order_acquire));
+  EvictPages();
+  statistics.residentPageCount = 0;
+  for (const FontPage& page : pages) {
+    statistics.residentPageCount += page.texture ? 1 : 0;
+  }
+  statistics.residentPageBytes = residentPageBytes;
+}
+
+/**
+* y[Wǂݍ
+*
+* ǂݍ݂I܂ő҂̂ŁAy[Wǂݍރt[͏xȂ
+* VF[_̃eNX`e[uDESCRIPTORS_VOLATILEȂ̂ŁA
+* s̃R}hXgQƂĂȂꏊł΁Ar[Ă悢
+*
+* @param index y[Wԍ
+*
+* @retval true  ǂݍݐ
+* @retval false ǂݍݎs
+*/
+bool FontRenderer::LoadPage(size_t index)
+{
+  FontPage& page = pages[index];
+  page.texture = device->LoadTexture(page.filename.c_str());
+  if (!page.texture) {
+    LOG("ERROR: %s̓ǂݍ݂Ɏs\n", page.filename.c_str());
+    page.failed = true;
+    return false;
+  }
+  const D3D12_RESOURCE_DESC desc = page.texture->GetResource()->GetDesc();
+  page.byteSize = static_cast<size_t>(device->GetCopyableFootPrint(&desc, 0, desc.MipLevels, 0));
+  residentPageBytes += page.byteSize;
+  device->CopyDescriptors(1, heap.GetCPUDescriptorHandle(HeapID_Texture0 + index),
+    page.texture->GetCPUHandle(), D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+  ++statistics.pageLoadCount;
+  return true;
+}
+
+/**
+* y[Wj
+*
+* 摜GPUgIĂj
+*
+* @param index y[Wԍ
+*/
+void FontRenderer::ReleasePage(size_t index)
+{
+  FontPage& page = pages[index];
+  if (!page.texture) {
+    return;
+  }
+  device->SetDescriptorsToNull(1, heap.GetCPUDescriptorHandle(HeapID_Texture0 + index));
+  device->GetUploadRing().DeferRelease(page.texture->GetResource());
+  page.texture.reset();
+  residentPageBytes -= page.byteSize;
+  page.byteSize = 0;
+}
+
+/**
+* ǂݍݍς݂̃y[W\Z𒴂Ă΁A΂炭gĂȂy[WÂɔj
+*
+* s̃t[gĂy[WjȂ悤ɁA
+* gȂȂĂ班ȂƂt[obt@̐葽̃t[߂y[Wj
+*/
+void FontRenderer::EvictPages()
+{
+  const uint32_t keepFrames = std::max(pageKeepFrames, static_cast<uint32_t>(framebufferCount) + 1);
+  while (residentPageBytes > pageMemoryBudget) {
+    size_t oldest = pages.size();
+    uint32_t oldestAge = keepFrames;
+    for (size_t i = 0; i < pages.size(); ++i) {
+      const uint32_t age = frameCount - pages[i].lastUsedFrame;
+      if (pages[i].texture && age > oldestAge) {
+        oldest = i;
+        oldestAge = age;
       }
     }
-    ++line;
+    if (oldest >= pages.size()) {
+      break;
+    }
+    ReleasePage(oldest);
+    ++statistics.pageEvictCount;
   }
+}
 
-  D3D12_RANGE range = { 0, 0 };
-  void* p;
-  fontBuffer->Map(0, &range, &p);
-  memcpy(p, shaderFonts.data(), shaderFonts.size() * sizeof(FontInfoInShader));
-  fontBuffer->Unmap(0, nullptr);
+/**
+* ͂ދ`̑傫𒲂ׂ
+*
+* ʂLayoutƓۑ̂ŁAxׂĂvZ1ōς
+*/
+XMFLOAT2 FontRenderer::CalcStringSize(const char* str)
+{
+  return Layout(str, strlen(str), XMFLOAT2(1, 1), 0).size;
+}
+
+/**
+* ̉sʒuƑ傫𒲂ׂ
+*
+* @param text      UTF-8̕
+* @param length    ̃oCg
+* @param textScale ̊g嗦(ScaleŐݒ肵g嗦Ɋ|)
+* @param maxWidth  1s̍ő啝(0ȉȂ܂ԂȂ)
+*
+* @return zu. LayoutCalcStringSizeĂԂ܂ŗL
+*/
+const TextLayoutResult& FontRenderer::Layout(const char* text, size_t length,
+  const XMFLOAT2& textScale, float maxWidth)
+{
+  return textLayout.Layout(text, length, XMFLOAT2(scale.x * textScale.x, scale.y * textScale.y), maxWidth);
+}
 
-  texList.clear();
-  texList.reserve(texNameList.size());
-  D3D12_CPU_DESCRIPTOR_HANDLE handleTex = heap.GetCPUDescriptorHandle(HeapID_Texture0);
-  for (const auto& e : texNameList) {
-    TexturePtr tex = device->LoadTexture(e.c_str());
-    if (!tex) {
-      return false;
+/**
+* ̔zuƉsʒǔvZɎg蕝A݂̐ݒō蒼
+*
+* 蕝ς̂ŁAۑsʒuƑ傫蒼
+*/
+void FontRenderer::UpdateTextLayout()
+{
+  // \ɂȂ(0)ɂ蕝ƕԊu^
+  const float spacing = static_cast<float>(paddingRight + paddingLeft);
+  glyphAdvances.resize(glyphList.size());
+  glyphVisible.resize(glyphList.size());
+  for (size_t i = 0; i < glyphList.size(); ++i) {
+    const FontInfo& font = glyphList[i];
+    glyphAdvances[i] = (propotional ? font.xadvance : fixedAdvance) + spacing;
+    glyphVisible[i] = (font.size.x && font.size.y) ? 1 : 0;
+  }
+  glyphLayoutFont.glyphTable = &glyphTable;
+  glyphLayoutFont.advances = glyphAdvances.data();
+  glyphLayoutFont.visible = glyphVisible.data();
+  glyphLayoutFont.lineHeight = fontHeight;
+
+  textLayout.SetFont(&glyphTable, std::vector<float>(glyphAdvances), fontHeight, 0);
+}
+
+/**
+* \镶̍ő吔𒲂ׂ
+*
+* UTF-811oCgȏŁAsȃoCg1oCgɂ1ɂȂ̂ŁA
+* \镶̓oCg𒴂Ȃ. ŃoCg̍vԂ
+*/
+size_t FontRenderer::CountMaxCharacters(const Text* pText, size_t count)
+{
+  size_t maxCharacterCount = 0;
+  for (size_t i = 0; i < count; i++) {
+    maxCharacterCount += pText[i].text.size();
+  }
+  return maxCharacterCount;
+}
+
+/**
+* ݂̐ݒ肩VF[_p̕`ݒ쐬
+*/
+FontStyleInShader FontRenderer::GetStyle() const
+{
+  FontStyleInShader style;
+  style.subColor = subColor;
+  style.thickness = 1.0f - thickness;// 0.625f - thickness * 0.375f;
+  style.outline = border;
+  return style;
+}
+
+/**
+* ̕zu
+*
+* ̈ʒu͕̕\ʒüʒu(Y͏)ɂȂ
+*
+* @param text   \f[^
+* @param run    f[^̔ԍ
+* @param pBegin zuʂ̏ݐ(̃oCgȏ)
+*
+* @return 񂾕
+*/
+size_t FontRenderer::LayoutText(const Text& text, uint32_t run, GlyphInShader* pBegin) const
+{
+  return LayoutGlyphs(text.text.data(), text.text.size(), glyphLayoutFont,
+    XMFLOAT2(scale.x * text.scale.x, scale.y * text.scale.y), run, pBegin);
+}
+
+namespace /* unnamed */ {
+
+/**
+* f[^
+*
+* @param p              ݐ
+* @param text           \f[^
+* @param rendererScale  FontRendererɐݒ肳ꂽg嗦
+* @param viewportHeight r[|[g̍(Y𔽓]邽)
+*/
+void WriteRun(GlyphRunInShader* p, const Text& text, const XMFLOAT2& rendererScale, float viewportHeight)
+{
+  GlyphRunInShader run;
+  run.origin = XMFLOAT2(text.position.x, viewportHeight - text.position.y);
+  run.scale = XMFLOAT2(rendererScale.x * text.scale.x, rendererScale.y * text.scale.y);
+  run.color = text.color;
+  *p = run;
+}
+
+} // unnamed namespace
+
+/**
+* VF[_p̕f[^ƕf[^ɕϊ
+*
+* f[^͕\f[^1ɂ1
+*
+* @param pText          \f[^z̐擪AhX
+* @param count          z̒
+* @param viewportHeight r[|[g̍(Y𔽓]邽)
+* @param pRuns          f[^̏ݐ(count̐ȏ)
+* @param pGlyphs        f[^̏ݐ(CountMaxCharacters̐ȏ)
+*
+* @return 񂾕
+*/
+size_t FontRenderer::WriteCharacters(const Text* pText, size_t count, float viewportHeight,
+  GlyphRunInShader* pRuns, GlyphInShader* pGlyphs, uint32_t& pageMask)
+{
+  // ݐ悩ǂݕԂȂ悤ɁAƗp̔zɔzuĂRs[
+  GlyphInShader* pCharacter = pGlyphs;
+  for (size_t i = 0; i < count; i++) {
+    const Text& text = pText[i];
+    WriteRun(pRuns + i, text, scale, viewportHeight);
+    if (scratchGlyphs.size() < text.text.size()) {
+      scratchGlyphs.resize(text.text.size());
     }
-    texList.push_back(tex);
-    device->CopyDescriptors(1, handleTex, tex->GetCPUHandle(), D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-    handleTex.ptr += heap.GetHandleSize();
+    const size_t n = LayoutText(text, static_cast<uint32_t>(i), scratchGlyphs.data());
+    pageMask |= CollectPages(scratchGlyphs.data(), n);
+    memcpy(pCharacter, scratchGlyphs.data(), sizeof(GlyphInShader) * n);
+    pCharacter += n;
+  }
+  return static_cast<size_t>(pCharacter - pGlyphs);
+}
+
+/**
+* ÓIC[쐬
+*
+* f[^p̃obt@ɕۑA
+* 蒼j܂ŁAt[̕ϊƃAbv[hȗĕ`ł悤ɂ
+* ̑傫FȂǂ͍쐬̐ݒ肪g
+* łɓԍ̃C[΍蒼
+*
+* @param id       C[ԍ
+* @param pText    \f[^z̐擪AhX
+* @param count    z̒
+* @param viewport `Ɏgr[|[g
+*
+* @retval true  쐬
+* @retval false 쐬s
+*/
+bool FontRenderer::BuildStaticLayer(int id, const Text* pText, size_t count, const D3D12_VIEWPORT& viewport)
+{
+  ReleaseStaticLayer(id);
+
+  StaticLayer& layer = staticLayers[id];
+  const size_t maxCharacterCount = CountMaxCharacters(pText, count);
+  if (maxCharacterCount == 0) {
+    return true;
   }
-  const int texCount = static_cast<int>(texList.size());
-  if (texCount < 2) {
-    device->SetDescriptorsToNull(2 - texCount, heap.GetCPUDescriptorHandle(HeapID_Texture0 + texCount));
+  layer.buffer = device->CreateUploadResource(L"Font Static Layer",
+    sizeof(GlyphRunInShader) * count + sizeof(GlyphInShader) * maxCharacterCount);
+  if (!layer.buffer) {
+    staticLayers.erase(id);
+    return false;
   }
+  void* p;
+  const D3D12_RANGE range = { 0, 0 };
+  layer.buffer->Map(0, &range, &p);
+  GlyphRunInShader* pRuns = static_cast<GlyphRunInShader*>(p);
+  layer.runCount = count;
+  layer.count = WriteCharacters(pText, count, viewport.Height,
+    pRuns, reinterpret_cast<GlyphInShader*>(pRuns + count), layer.pageMask);
+  layer.style = GetStyle();
+  layer.buffer->Unmap(0, nullptr);
   return true;
 }
 
 /**
-* ̉̃sNZ𒲂ׂ
+* ÓIC[j
+*
+* obt@GPUgIĂj
+*
+* @param id C[ԍ
 */
-XMFLOAT2 FontRenderer::CalcStringSize(const wchar_t* str) const
+void FontRenderer::ReleaseStaticLayer(int id)
 {
-  XMFLOAT2 pos(0, 0);
-  for (const wchar_t* itr = str; *itr; ++itr) {
-    if (*itr == L'\n') {
-      pos.x = 0;
-      pos.y += fontHeight * scale.y;
-    }
-    const FontInfo& font = fontList[*itr];
-    pos.x += (propotional ? font.xadvance : fixedAdvance) * static_cast<float>(paddingRight + paddingLeft) * scale.x;
+  auto itr = staticLayers.find(id);
+  if (itr != staticLayers.end()) {
+    device->GetUploadRing().DeferRelease(std::move(itr->second.buffer));
+    staticLayers.erase(itr);
+  }
+}
+
+/**
+* DrawŐÓIC[`悷
+*
+* ÓIC[́Ao^ɁADrawɓnɕ`悳
+* UpdatePagesOɓo^΁AC[gy[W͂̃t[̕`܂łɓǂݍ܂
+*
+* @param id C[ԍ
+*
+* @retval true  o^
+* @retval false C[݂Ȃ
+*/
+bool FontRenderer::SubmitStaticLayer(int id)
+{
+  const auto itr = staticLayers.find(id);
+  if (itr == staticLayers.end()) {
+    return false;
   }
-  return pos;
+  submittedLayers.push_back(id);
+
+  // gĂy[W͍쐬ɂ킩Ă̂ŁÃt[UpdatePagesœǂݍ߂悤ɓ`
+  usedPageMask.fetch_or(itr->second.pageMask, std::memory_order_relaxed);
+  return true;
 }
 
 /**
@@ -277,54 +553,54 @@ XMFLOAT2 FontRenderer::CalcStringSize(const wchar_t* str) const
 */
 ID3D12GraphicsCommandList* FontRenderer::Draw(const Text* pText, size_t count, const FontRenderingInfo& renderingInfo)
 {
-	count = std::min(count, capacity);
 	CommandContext& context = commandContexts[renderingInfo.framebufferIndex];
 
-	if (count <= 0) {
-		context.allocator->Reset();
-		context.list->Reset(context.allocator.Get(), nullptr);
-		context.list->Close();
- 		return context.list.Get();
-	}
+  // y[W̓vUpdatePagesŋL^̂c
+  const FontRendererStatistics previous = statistics;
+  statistics = {};
+  statistics.pageLoadCount = previous.pageLoadCount;
+  statistics.pageEvictCount = previous.pageEvictCount;
+  statistics.residentPageCount = previous.residentPageCount;
+  statistics.residentPageBytes = previous.residentPageBytes;
+
+  // \镶͕̒𒴂Ȃ̂ŁA̕mۂ
+  const size_t maxCharacterCount = CountMaxCharacters(pText, count);
+  UploadAllocation runData;
+  UploadAllocation characterData;
+  if (maxCharacterCount > 0) {
+    runData = device->GetUploadRing().Allocate(sizeof(GlyphRunInShader) * count);
+    characterData = device->GetUploadRing().Allocate(sizeof(GlyphInShader) * maxCharacterCount);
+  }
+  size_t characterCount = 0;
+  uint32_t pageMask = 0;
+  if (runData && characterData) {
+    characterCount = WriteCharacters(pText, count, renderingInfo.viewport.Height,
+      static_cast<GlyphRunInShader*>(runData.cpuAddress), static_cast<GlyphInShader*>(characterData.cpuAddress),
+      pageMask);
+    statistics.characterCount = characterCount;
+    statistics.runCount = count;
+    statistics.uploadBytes = sizeof(GlyphRunInShader) * count + sizeof(GlyphInShader) * characterCount;
+  }
 
-	void* pTmp;
-	const D3D12_RANGE range = { 0, 0 };
-	context.characterBuffer->Map(0, &range, &pTmp);
-	CharacterInShader* const pBegin = static_cast<CharacterInShader*>(pTmp);
-  const CharacterInShader* const pEnd = pBegin + capacity;
+  // sʒǔvZ͑ODraẘԂɍsꂽ
+  textLayout.EvictUnused(layoutKeepFrames);
+  const TextLayoutStatistics layoutStatistics = textLayout.TakeStatistics();
+  statistics.layoutHitCount = layoutStatistics.hitCount;
+  statistics.layoutMissCount = layoutStatistics.missCount;
+  statistics.cachedLayoutCount = layoutStatistics.cachedCount;
 
-  CharacterInShader* pCharacter = pBegin;
-  for (size_t i = 0; i < count; i++) {
-    const Text& text = pText[i];
-    XMFLOAT2 pos = text.position;
-    for (const wchar_t* itr = text.text.c_str(); *itr; ++itr) {
-      if (pCharacter >= pEnd) {
-        break;
-      }
-      if (*itr == L'\n') {
-        pos.x = text.position.x;
-        pos.y -= fontHeight * scale.y;
-      }
-      const FontInfo& font = fontList[*itr];
-      if (font.id >= 0 && font.size.x && font.size.y) {
-        pCharacter->position = pos;
-        pCharacter->position.y = renderingInfo.viewport.Height - pCharacter->position.y;
-        pCharacter->scale = scale;
-        pCharacter->color = text.color;
-        pCharacter->subColor = subColor;
-        pCharacter->fontIndex = font.id;
-        pCharacter->thickness = 1.0f - thickness;// 0.625f - thickness * 0.375f;
-        pCharacter->outline = border;
-        ++pCharacter;
-      }
-      pos.x += ((propotional ? font.xadvance : fixedAdvance) + static_cast<float>(paddingRight + paddingLeft)) * scale.x;
-    }
-  }
-  context.characterBuffer->Unmap(0, nullptr);
+  // `悷镶̃y[W`. gpL^Ɠǂݍ݂́Ãt[̑OUpdatePagesōs
+  // (ÓIC[̃y[WSubmitStaticLayerœ`Ă)
+  usedPageMask.fetch_or(pageMask, std::memory_order_release);
 
 	context.allocator->Reset();
 	context.list->Reset(context.allocator.Get(), nullptr);
 
+	if (characterCount == 0 && submittedLayers.empty()) {
+		context.list->Close();
+ 		return context.list.Get();
+	}
+
 	context.list->SetPipelineState(pso->GetPipelineStateObject());
 	context.list->SetGraphicsRootSignature(pso->GetRootSignature());
   context.list->OMSetRenderTargets(1, &renderingInfo.handleRTV, FALSE, &renderingInfo.handleDSV);
@@ -345,14 +621,39 @@ ID3D12GraphicsCommandList* FontRenderer::Draw(const Text* pText, size_t count, c
 	// [gp[^1: tHgf[^
 	context.list->SetGraphicsRootDescriptorTable(1, heap.GetGPUDescriptorHandle(HeapID_FontInfo));
 
-	// [gp[^2: f[^
-	context.list->SetGraphicsRootDescriptorTable(2,
-    heap.GetGPUDescriptorHandle(HeapID_Character0 + renderingInfo.framebufferIndex));
-
 	// [gp[^3: eNX`
 	context.list->SetGraphicsRootDescriptorTable(3, heap.GetGPUDescriptorHandle(HeapID_Texture0));
 
-	context.list->DrawIndexedInstanced(6, static_cast<UINT>(pCharacter - pBegin), 0, 0, 0);
+  // ÓIC[͕ۑς݂̃f[^̂܂܎g
+  for (int id : submittedLayers) {
+    auto itr = staticLayers.find(id);
+    if (itr == staticLayers.end() || itr->second.count == 0) {
+      continue;
+    }
+    const StaticLayer& layer = itr->second;
+    const D3D12_GPU_VIRTUAL_ADDRESS address = layer.buffer->GetGPUVirtualAddress();
+    // [gp[^2: f[^
+    // [gp[^4: f[^
+    // [gp[^5: `ݒ(C[쐬̐ݒg)
+    context.list->SetGraphicsRootShaderResourceView(2, address + sizeof(GlyphRunInShader) * layer.runCount);
+    context.list->SetGraphicsRootShaderResourceView(4, address);
+    context.list->SetGraphicsRoot32BitConstants(5, sizeof(FontStyleInShader) / 4, &layer.style, 0);
+    context.list->DrawIndexedInstanced(6, static_cast<UINT>(layer.count), 0, 0, 0);
+    statistics.staticCharacterCount += layer.count;
+    statistics.skippedUploadBytes += sizeof(GlyphRunInShader) * layer.runCount + sizeof(GlyphInShader) * layer.count;
+  }
+  submittedLayers.clear();
+
+  if (characterCount > 0) {
+    // [gp[^2: f[^
+    // [gp[^4: f[^
+    // [gp[^5: `ݒ
+    const FontStyleInShader style = GetStyle();
+    context.list->SetGraphicsRootShaderResourceView(2, characterData.gpuAddress);
+    context.list->SetGraphicsRootShaderResourceView(4, runData.gpuAddress);
+    context.list->SetGraphicsRoot32BitConstants(5, sizeof(FontStyleInShader) / 4, &style, 0);
+    context.list->DrawIndexedInstanced(6, static_cast<UINT>(characterCount), 0, 0, 0);
+  }
   context.list->Close();
 
   return context.list.Get();
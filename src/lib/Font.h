@@ -3,25 +3,52 @@
 */
 #ifndef EASYLIB_DX12_FONT_H
 #define EASYLIB_DX12_FONT_H
+#include "DrawData.h"
 #include "Texture.h"
 #include "Device.h"
+#include "GlyphTable.h"
+#include "GlyphLayout.h"
+#include "TextLayout.h"
 #include <d3d12.h>
 #include <DirectXMath.h>
 #include <DirectXPackedVector.h>
 #include <wrl/client.h>
 #include <vector>
 #include <string>
+#include <unordered_map>
 #include <memory>
+#include <atomic>
 
 namespace EasyLib {
 namespace DX12 {
 
-struct Text
+/**
+* tHg`̓v
+*/
+struct FontRendererStatistics
+{
+  size_t characterCount = 0;       // `悵(ÓIC[)
+  size_t runCount = 0;             // `悵̐(ÓIC[)
+  size_t uploadBytes = 0;          // GPUɑf[^ƕf[^̃oCg
+  size_t staticCharacterCount = 0; // ÓIC[`悵
+  size_t skippedUploadBytes = 0;   // ÓIC[gƂŕϊƃAbv[hȗłoCg
+  size_t layoutHitCount = 0;       // ۑsʒuƑ傫ėpł̐
+  size_t layoutMissCount = 0;      // sʒuƑ傫vZ̐
+  size_t cachedLayoutCount = 0;    // ۑĂsʒuƑ傫̐
+  size_t pageLoadCount = 0;        // ǂݍ񂾃tHg摜̐
+  size_t pageEvictCount = 0;       // jtHg摜̐
+  size_t residentPageCount = 0;    // ǂݍݍς݂̃tHg摜̐
+  size_t residentPageBytes = 0;    // ǂݍݍς݂̃tHg摜̃oCg
+};
+
+/**
+* VF[_p̕`ݒ(`施߂ƂɃ[g萔œn)
+*/
+struct FontStyleInShader
 {
-  std::wstring text;
-  DirectX::XMFLOAT2 position;
-  DirectX::XMFLOAT2 scale;
-  DirectX::XMFLOAT4 color;
+  DirectX::XMFLOAT4 subColor;
+  float thickness;
+  float outline;
 };
 
 struct FontRenderingInfo
@@ -45,10 +72,11 @@ public:
   FontRenderer(const FontRenderer&) = delete;
   FontRenderer& operator=(const FontRenderer&) = delete;
 
-  bool Initialize(DevicePtr device, size_t framebufferCount, size_t capacity);
+  bool Initialize(DevicePtr device, size_t framebufferCount);
   bool LoadFromFile(const char* filename);
 
   ID3D12GraphicsCommandList* Draw(const Text* p, size_t count, const FontRenderingInfo& renderingInfo);
+  void UpdatePages();
 
   void Scale(const DirectX::XMFLOAT2& s) { scale = s; }
   const DirectX::XMFLOAT2& Scale() const { return scale; }
@@ -60,22 +88,49 @@ public:
   float Thickness() const { return thickness; }
   void Border(float b) { border = b; }
   float Border() const { return border; }
-  void Propotional(bool b) { propotional = b; }
+  void Propotional(bool b) { propotional = b; UpdateTextLayout(); }
   bool Propotional() const { return propotional; }
-  void XAdvance(float x) { fixedAdvance = x; }
+  void XAdvance(float x) { fixedAdvance = x; UpdateTextLayout(); }
   float XAdvance() const { return fixedAdvance; }
-  DirectX::XMFLOAT2 CalcStringSize(const wchar_t* str) const;
+  DirectX::XMFLOAT2 CalcStringSize(const char* str);
+
+  // tHg摜ێ郁̗\ZƁAgȂȂĂjł܂ł̃t[
+  void PageMemoryBudget(size_t bytes) { pageMemoryBudget = bytes; }
+  size_t PageMemoryBudget() const { return pageMemoryBudget; }
+  void PageKeepFrames(uint32_t frames) { pageKeepFrames = frames; }
+  uint32_t PageKeepFrames() const { return pageKeepFrames; }
+
+  // ̉sʒuƑ傫
+  const TextLayoutResult& Layout(const char* text, size_t length,
+    const DirectX::XMFLOAT2& textScale, float maxWidth);
+
+  // ÓIC[
+  bool BuildStaticLayer(int id, const Text* p, size_t count, const D3D12_VIEWPORT& viewport);
+  void ReleaseStaticLayer(int id);
+  bool HasStaticLayer(int id) const { return staticLayers.find(id) != staticLayers.end(); }
+  bool SubmitStaticLayer(int id);
+
+  const FontRendererStatistics& GetStatistics() const { return statistics; }
 
 private:
+  static size_t CountMaxCharacters(const Text* pText, size_t count);
+  FontStyleInShader GetStyle() const;
+  size_t LayoutText(const Text& text, uint32_t run, GlyphInShader* p) const;
+  size_t WriteCharacters(const Text* pText, size_t count, float viewportHeight,
+    GlyphRunInShader* pRuns, GlyphInShader* pGlyphs, uint32_t& pageMask);
+  void UpdateTextLayout();
+  uint32_t CollectPages(const GlyphInShader* p, size_t count) const;
+  void TouchPages(uint32_t pageMask);
+  bool LoadPage(size_t index);
+  void ReleasePage(size_t index);
+  void EvictPages();
+
   DevicePtr device;
   PSOPtr pso;
 
   enum HeapID
   {
     HeapID_FontInfo,
-    HeapID_Character0,
-    HeapID_Character1,
-    HeapID_Character2,
     HeapID_Texture0,
     HeapID_Texture1,
     num_HeapID,
@@ -85,7 +140,6 @@ private:
   struct CommandContext {
     Microsoft::WRL::ComPtr<ID3D12CommandAllocator> allocator;
     Microsoft::WRL::ComPtr<ID3D12GraphicsCommandList> list;
-    Microsoft::WRL::ComPtr<ID3D12Resource> characterBuffer;
   };
   CommandContext commandContexts[3];
   Microsoft::WRL::ComPtr<ID3D12Resource> indexBuffer;
@@ -93,20 +147,20 @@ private:
 
   D3D12_INDEX_BUFFER_VIEW viewIB;
   size_t framebufferCount = 0;
-  size_t capacity = 0;
 
+  // ̔zuɎg(摜̈ʒuȂǂ̓VF[_ptHgf[^ɂ)
   struct FontInfo {
-    int id = -1;
-    int page = 0;
-    DirectX::XMFLOAT2 uv[2];
-    DirectX::XMFLOAT2 size;
-    DirectX::XMFLOAT2 offset;
+    DirectX::XMFLOAT2 size = { 0, 0 };
     float xadvance = 0;
   };
-  std::vector<FontInfo> fontList;
-  std::vector<TexturePtr> texList;
+  std::vector<FontInfo> glyphList; // ԍ -> (0Ԃ͕ȂƂɎg̕)
+  GlyphTable glyphTable;           // R[h -> ԍ
+  std::vector<float> glyphAdvances; // ԍ -> 蕝(݂̐ݒł̒l. Ԋu܂)
+  std::vector<uint8_t> glyphVisible; // ԍ -> 摜1
+  std::vector<uint32_t> glyphPageBits; // ԍ -> 摜̂y[W̃rbg(摜Ȃ0)
+  GlyphLayoutFont glyphLayoutFont;   // LayoutGlyphsɓn
   DirectX::XMFLOAT2 reciprocalScreenSize;
-  float fontHeight;
+  float fontHeight = 0;
   int paddingUp = 0;
   int paddingRight = 0;
   int paddingLeft = 0;
@@ -119,6 +173,43 @@ private:
   float border = 0.25f; // ̊Öʒu(0.0=ŊO 1.0=œ)
   bool propotional = true;
   float fixedAdvance = 0;
+
+  // tHg摜(y[W)
+  // zuƂɏ߂ēǂݍ݁AgȂ܂ܗ\Z𒴂Â̂j
+  struct FontPage {
+    std::string filename;
+    TexturePtr texture;
+    size_t byteSize = 0;        // ǂݍ񂾉摜̃oCg
+    uint32_t lastUsedFrame = 0;
+    bool failed = false;        // ǂݍ݂Ɏs(摜xǂݍƂȂ)
+  };
+  static constexpr size_t maxPageCount = 2; // Font.hlsltex̗vf
+  static constexpr size_t defaultPageMemoryBudget = 16 * 1024 * 1024; // 2048x2048RGBA摜1
+  std::vector<FontPage> pages;
+  size_t residentPageBytes = 0;
+  std::atomic<uint32_t> usedPageMask = 0; // DrawŎgꂽy[W̃rbg(ƗpXbhŉAUpdatePagesŎo)
+  size_t pageMemoryBudget = defaultPageMemoryBudget;
+  uint32_t pageKeepFrames = 300;
+
+  // f[^ۑC[
+  // obt@ɂ͕f[^Af[^̏Ɋi[
+  struct StaticLayer {
+    Microsoft::WRL::ComPtr<ID3D12Resource> buffer;
+    size_t runCount = 0;
+    size_t count = 0;
+    FontStyleInShader style;
+    uint32_t pageMask = 0; // gĂy[W̃rbg
+  };
+  std::unordered_map<int, StaticLayer> staticLayers;
+  std::vector<int> submittedLayers; // Drawŕ`悷ÓIC[
+
+  uint32_t frameCount = 0; // UpdatePagesĂ񂾉(y[WŌɎgꂽ̋L^Ɏg)
+  std::vector<GlyphInShader> scratchGlyphs; // zuƗp̔z
+
+  static constexpr uint32_t layoutKeepFrames = 60; // gȂȂsʒuƑ傫ۑĂt[
+  TextLayout textLayout; // sʒuƑ傫̌vZ(ʂ͕񂲂Ƃɕۑ)
+
+  FontRendererStatistics statistics;
 };
 
 } // namespace EasyLib
@@ -0,0 +1,405 @@
+/**
+* @file FontData.cpp
+*/
+#include "FontData.h"
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <algorithm>
+#include <memory>
+#include <numeric>
+
+namespace EasyLib {
+namespace DX12 {
+
+using namespace DirectX;
+
+namespace /* unnamed */ {
+
+using FilePtr = std::unique_ptr<FILE, decltype(&fclose)>;
+
+/**
+* t@C̑傫ƍXV擾
+*
+* @retval true  擾
+* @retval false t@C݂Ȃ
+*/
+bool GetFileStamp(const char* filename, uint64_t& size, int64_t& time)
+{
+  struct stat st;
+  if (stat(filename, &st) != 0) {
+    return false;
+  }
+  size = static_cast<uint64_t>(st.st_size);
+  time = static_cast<int64_t>(st.st_mtime);
+  return true;
+}
+
+/**
+* 4oCgE܂ł̖ߑ̑傫
+*/
+size_t GetPaddingSize(size_t size)
+{
+  return (4 - size % 4) % 4;
+}
+
+} // unnamed namespace
+
+/**
+* e
+*/
+void FontData::Clear()
+{
+  fontSize = 0;
+  paddingUp = paddingRight = paddingDown = paddingLeft = 0;
+  textureSize = XMFLOAT2(0, 0);
+  pages.clear();
+  codePoints.clear();
+  advances.clear();
+  glyphs.clear();
+  errorLine = 0;
+  isBinary = false;
+}
+
+/**
+* ǂݍ񂾃tHgf[^ǂ
+*
+* eLXg`ƕϊς݌`ŁAf[^ǂݍ߂Ƃm߂邽߂Ɏg
+* ǂݍ݂̏(errorLineAisBinary)ׂ͔Ȃ
+*/
+bool FontData::IsSameData(const FontData& other) const
+{
+  return fontSize == other.fontSize && paddingUp == other.paddingUp && paddingRight == other.paddingRight &&
+    paddingDown == other.paddingDown && paddingLeft == other.paddingLeft &&
+    textureSize.x == other.textureSize.x && textureSize.y == other.textureSize.y &&
+    pages == other.pages && codePoints == other.codePoints && advances == other.advances &&
+    glyphs.size() == other.glyphs.size() &&
+    memcmp(glyphs.data(), other.glyphs.data(), sizeof(FontInfoInShader) * glyphs.size()) == 0;
+}
+
+/**
+* ϊς݃t@C̖O߂
+*
+* @param filename eLXg`̃t@C
+*
+* @return gq.fntbɒut@C
+*/
+std::string FontData::GetBinaryFilename(const char* filename)
+{
+  std::string s = filename;
+  const size_t dot = s.find_last_of('.');
+  const size_t slash = s.find_last_of("/\\");
+  if (dot != std::string::npos && (slash == std::string::npos || dot > slash)) {
+    s.resize(dot);
+  }
+  s += FontDataFormat::extension;
+  return s;
+}
+
+/**
+* tHgt@Cǂݍ
+*
+* eLXg`̃t@CnƁAꏊɕϊς݃t@C΂ǂݍ
+* ϊς݃t@CȂAĂA܂̓eLXg`Âꍇ̓eLXg`ǂݍ
+*
+* @param filename tHgt@C(.fnt܂.fntb)
+*
+* @retval true  ǂݍݐ
+* @retval false ǂݍݎs
+*/
+bool FontData::Load(const char* filename)
+{
+  const std::string binaryFilename = GetBinaryFilename(filename);
+  if (binaryFilename == filename) {
+    return LoadFromBinary(filename);
+  }
+  if (LoadFromBinary(binaryFilename.c_str(), filename)) {
+    return true;
+  }
+  return LoadFromText(filename);
+}
+
+/**
+* BMFont̃eLXg`̃t@Cǂݍ
+*
+* @param filename tHgt@C
+*
+* @retval true  ǂݍݐ
+* @retval false ǂݍݎs. sserrorLineɊi[
+*/
+bool FontData::LoadFromText(const char* filename)
+{
+  Clear();
+  const FilePtr fp(fopen(filename, "r"), fclose);
+  if (!fp) {
+    return false;
+  }
+
+  errorLine = 1;
+  int ret = fscanf(fp.get(), "info face=%*s size=%f bold=%*d italic=%*d charset=%*s"
+    " unicode=%*d stretchH=%*d smooth=%*d aa=%*d padding=%d,%d,%d,%d spacing=%*d,%*d",
+    &fontSize, &paddingUp, &paddingRight, &paddingDown, &paddingLeft);
+  if (ret < 5) {
+    return false;
+  }
+  ++errorLine;
+
+  ret = fscanf(fp.get(), " common lineHeight=%*d base=%*d scaleW=%f scaleH=%f pages=%*d packed=%*d",
+    &textureSize.x, &textureSize.y);
+  if (ret < 2) {
+    return false;
+  }
+  const XMFLOAT2 reciprocalTextureSize = XMFLOAT2(1.0f / textureSize.x, 1.0f / textureSize.y);
+  ++errorLine;
+
+  for (;;) {
+    char tex[128];
+    ret = fscanf(fp.get(), " page id=%*d file=%127s", tex);
+    if (ret < 1) {
+      break;
+    }
+    std::string name = tex + 1; // ŏ́u"v𔲂Ēǉ.
+    name.pop_back(); // Ṓu"v.
+    pages.push_back(name);
+    ++errorLine;
+  }
+  if (pages.empty()) {
+    return false;
+  }
+
+  int charCount;
+  ret = fscanf(fp.get(), " chars count=%d", &charCount);
+  if (ret < 1) {
+    return false;
+  }
+  ++errorLine;
+
+  codePoints.reserve(charCount);
+  advances.reserve(charCount);
+  glyphs.reserve(charCount);
+  for (int i = 0; i < charCount; ++i) {
+    int id;
+    int page;
+    float xadvance;
+    XMFLOAT2 uv;
+    FontInfoInShader glyph;
+    ret = fscanf(fp.get(), " char id=%d x=%f y=%f width=%f height=%f xoffset=%f yoffset=%f xadvance=%f page=%d chnl=%*d",
+      &id, &uv.x, &uv.y, &glyph.size.x, &glyph.size.y, &glyph.offset.x, &glyph.offset.y, &xadvance, &page);
+    if (ret < 8 || id < 0) {
+      return false;
+    }
+    if (ret < 9) {
+      page = 0;
+    }
+    glyph.page = static_cast<uint32_t>(page);
+    glyph.uv[0].x = uv.x * reciprocalTextureSize.x;
+    glyph.uv[0].y = uv.y * reciprocalTextureSize.y;
+    glyph.uv[1].x = (uv.x + glyph.size.x) * reciprocalTextureSize.x;
+    glyph.uv[1].y = (uv.y + glyph.size.y) * reciprocalTextureSize.y;
+    codePoints.push_back(static_cast<uint32_t>(id));
+    advances.push_back(xadvance);
+    glyphs.push_back(glyph);
+    ++errorLine;
+  }
+  errorLine = 0;
+
+  // R[hɕׂ. Ό̂̂g
+  std::vector<uint32_t> order(codePoints.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(),
+    [this](uint32_t a, uint32_t b) { return codePoints[a] < codePoints[b]; });
+  std::vector<uint32_t> sortedCodePoints;
+  std::vector<float> sortedAdvances;
+  std::vector<FontInfoInShader> sortedGlyphs;
+  sortedCodePoints.reserve(order.size());
+  sortedAdvances.reserve(order.size());
+  sortedGlyphs.reserve(order.size());
+  for (uint32_t i : order) {
+    if (!sortedCodePoints.empty() && sortedCodePoints.back() == codePoints[i]) {
+      sortedAdvances.back() = advances[i];
+      sortedGlyphs.back() = glyphs[i];
+      continue;
+    }
+    sortedCodePoints.push_back(codePoints[i]);
+    sortedAdvances.push_back(advances[i]);
+    sortedGlyphs.push_back(glyphs[i]);
+  }
+  codePoints.swap(sortedCodePoints);
+  advances.swap(sortedAdvances);
+  glyphs.swap(sortedGlyphs);
+  return true;
+}
+
+/**
+* ϊς݃t@Cǂݍ
+*
+* t@CŜxɓǂݍ݁Aẑ܂܃Rs[
+*
+* @param filename       ϊς݃t@C
+* @param sourceFilename ϊ̃eLXg`̃t@C
+*                       nullptrȊOw肷ƁAϊɕϊXVĂꍇ͎s
+*
+* @retval true  ǂݍݐ
+* @retval false ǂݍݎs
+*/
+bool FontData::LoadFromBinary(const char* filename, const char* sourceFilename)
+{
+  Clear();
+  const FilePtr fp(fopen(filename, "rb"), fclose);
+  if (!fp) {
+    return false;
+  }
+  fseek(fp.get(), 0, SEEK_END);
+  const long fileSize = ftell(fp.get());
+  fseek(fp.get(), 0, SEEK_SET);
+  if (fileSize < static_cast<long>(sizeof(FontDataFormat::Header))) {
+    return false;
+  }
+  std::vector<uint8_t> data(static_cast<size_t>(fileSize));
+  if (fread(data.data(), 1, data.size(), fp.get()) != data.size()) {
+    return false;
+  }
+
+  FontDataFormat::Header header;
+  memcpy(&header, data.data(), sizeof(header));
+  if (memcmp(header.magic, FontDataFormat::magic, sizeof(header.magic)) != 0 ||
+    header.version != FontDataFormat::version) {
+    return false;
+  }
+  if (sourceFilename) {
+    uint64_t size;
+    int64_t time;
+    if (GetFileStamp(sourceFilename, size, time) &&
+      (size != header.sourceSize || time != header.sourceTime)) {
+      return false;
+    }
+  }
+
+  size_t offset = sizeof(header);
+  const auto read = [&data, &offset](void* p, size_t size) {
+    if (offset + size > data.size()) {
+      return false;
+    }
+    memcpy(p, data.data() + offset, size);
+    offset += size;
+    return true;
+  };
+  pages.resize(header.pageCount);
+  for (std::string& name : pages) {
+    uint32_t length;
+    if (!read(&length, sizeof(length)) || offset + length > data.size()) {
+      Clear();
+      return false;
+    }
+    name.assign(reinterpret_cast<const char*>(data.data() + offset), length);
+    offset += length + GetPaddingSize(length);
+  }
+  codePoints.resize(header.glyphCount);
+  advances.resize(header.glyphCount);
+  glyphs.resize(header.glyphCount);
+  if (!read(codePoints.data(), sizeof(uint32_t) * header.glyphCount) ||
+    !read(advances.data(), sizeof(float) * header.glyphCount) ||
+    !read(glyphs.data(), sizeof(FontInfoInShader) * header.glyphCount)) {
+    Clear();
+    return false;
+  }
+
+  fontSize = header.fontSize;
+  paddingUp = header.paddingUp;
+  paddingRight = header.paddingRight;
+  paddingDown = header.paddingDown;
+  paddingLeft = header.paddingLeft;
+  textureSize = XMFLOAT2(header.textureWidth, header.textureHeight);
+  isBinary = true;
+  return true;
+}
+
+/**
+* ϊς݃t@C
+*
+* @param filename       ϊς݃t@C
+* @param sourceFilename ϊ̃eLXg`̃t@C(傫ƍXVL^)
+*
+* @retval true  ݐ
+* @retval false ݎs
+*/
+bool FontData::SaveToBinary(const char* filename, const char* sourceFilename) const
+{
+  FontDataFormat::Header header = {};
+  memcpy(header.magic, FontDataFormat::magic, sizeof(header.magic));
+  header.version = FontDataFormat::version;
+  if (sourceFilename) {
+    GetFileStamp(sourceFilename, header.sourceSize, header.sourceTime);
+  }
+  header.fontSize = fontSize;
+  header.paddingUp = paddingUp;
+  header.paddingRight = paddingRight;
+  header.paddingDown = paddingDown;
+  header.paddingLeft = paddingLeft;
+  header.textureWidth = textureSize.x;
+  header.textureHeight = textureSize.y;
+  header.pageCount = static_cast<uint32_t>(pages.size());
+  header.glyphCount = static_cast<uint32_t>(codePoints.size());
+
+  std::vector<uint8_t> data;
+  const auto write = [&data](const void* p, size_t size) {
+    const uint8_t* bytes = static_cast<const uint8_t*>(p);
+    data.insert(data.end(), bytes, bytes + size);
+  };
+  write(&header, sizeof(header));
+  for (const std::string& name : pages) {
+    const uint32_t length = static_cast<uint32_t>(name.size());
+    write(&length, sizeof(length));
+    write(name.data(), length);
+    data.resize(data.size() + GetPaddingSize(length), 0);
+  }
+  write(codePoints.data(), sizeof(uint32_t) * codePoints.size());
+  write(advances.data(), sizeof(float) * advances.size());
+  write(glyphs.data(), sizeof(FontInfoInShader) * glyphs.size());
+
+  const FilePtr fp(fopen(filename, "wb"), fclose);
+  if (!fp) {
+    return false;
+  }
+  return fwrite(data.data(), 1, data.size(), fp.get()) == data.size();
+}
+
+/**
+* BMFont̃eLXg`ŏ
+*
+* LoadFromTextǂݍޒl݁AȊO̍ڂ͊lɂ
+* 摜̈ʒu̓eNX`WɃeNX`̑傫|āAsNZPʂɖ߂
+*
+* @param filename tHgt@C
+*
+* @retval true  ݐ
+* @retval false ݎs
+*/
+bool FontData::SaveToText(const char* filename) const
+{
+  const FilePtr fp(fopen(filename, "w"), fclose);
+  if (!fp) {
+    return false;
+  }
+  fprintf(fp.get(), "info face=\"\" size=%.9g bold=0 italic=0 charset=\"\" unicode=1 stretchH=100"
+    " smooth=1 aa=1 padding=%d,%d,%d,%d spacing=0,0\n",
+    fontSize, paddingUp, paddingRight, paddingDown, paddingLeft);
+  fprintf(fp.get(), "common lineHeight=%d base=%d scaleW=%.9g scaleH=%.9g pages=%zu packed=0\n",
+    static_cast<int>(fontSize), static_cast<int>(fontSize), textureSize.x, textureSize.y, pages.size());
+  for (size_t i = 0; i < pages.size(); ++i) {
+    fprintf(fp.get(), "page id=%zu file=\"%s\"\n", i, pages[i].c_str());
+  }
+  fprintf(fp.get(), "chars count=%zu\n", codePoints.size());
+  for (size_t i = 0; i < codePoints.size(); ++i) {
+    const FontInfoInShader& e = glyphs[i];
+    fprintf(fp.get(), "char id=%-6u x=%-4ld y=%-4ld width=%-4.9g height=%-4.9g xoffset=%-4.9g yoffset=%-4.9g"
+      " xadvance=%-4.9g page=%-4u chnl=15\n",
+      codePoints[i], lroundf(e.uv[0].x * textureSize.x), lroundf(e.uv[0].y * textureSize.y),
+      e.size.x, e.size.y, e.offset.x, e.offset.y, advances[i], e.page);
+  }
+  return ferror(fp.get()) == 0;
+}
+
+} // namespace DX12
+} // namespace EasyLib
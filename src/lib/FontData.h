@@ -0,0 +1,102 @@
+/**
+* @file FontData.h
+*/
+#ifndef EASYLIB_DX12_FONTDATA_H
+#define EASYLIB_DX12_FONTDATA_H
+#include "PortableMath.h"
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace EasyLib {
+namespace DX12 {
+
+/**
+* VF[_ptHgf[^
+*
+* Font.hlslFontInfoƓzuȂ̂ŁAẑ܂GPUɑ
+*/
+struct FontInfoInShader
+{
+  uint32_t page;
+  DirectX::XMFLOAT2 uv[2];
+  DirectX::XMFLOAT2 size;
+  DirectX::XMFLOAT2 offset;
+};
+
+/**
+* ϊς݃tHgt@Č`
+*
+* t@C̐擪 HeaderǍɎ̔z4oCgEɑĕ. lׂ͂ăgGfBA
+*
+* - eNX`: pageCount((uint32_t)AO(tHgt@C̑΃pX)). 4oCgE܂0Ŗ߂
+* - R[h: uint32_t x glyphCount()
+* - 蕝: float x glyphCount
+* - VF[_ptHgf[^: FontInfoInShader x glyphCount
+*
+* sourceSizesourceTime͕ϊ̃eLXg`̃t@C̑傫ƍXVŁA
+* ϊɃeLXg`XVꂽǂ𒲂ׂ邽߂Ɏg
+*/
+namespace FontDataFormat {
+
+struct Header {
+  char magic[4];       // "EFNT"
+  uint32_t version;
+  uint64_t sourceSize; // ϊt@C̑傫
+  int64_t sourceTime;  // ϊt@C̍XV
+  float fontSize;
+  int32_t paddingUp;
+  int32_t paddingRight;
+  int32_t paddingDown;
+  int32_t paddingLeft;
+  float textureWidth;
+  float textureHeight;
+  uint32_t pageCount;
+  uint32_t glyphCount;
+  uint32_t reserved;
+};
+
+constexpr char magic[4] = { 'E', 'F', 'N', 'T' };
+constexpr uint32_t version = 1;
+constexpr const char* extension = ".fntb"; // ϊς݃t@C̊gq
+
+} // namespace FontDataFormat
+
+/**
+* rbg}bvtHg̕
+*
+* BMFont̃eLXg`(.fnt)ƁAϊ`(.fntb)̓ǂݏs
+* GPUɂ͐GȂ̂ŁAϊc[g
+*/
+struct FontData
+{
+  bool Load(const char* filename);
+  bool LoadFromText(const char* filename);
+  bool LoadFromBinary(const char* filename, const char* sourceFilename = nullptr);
+  bool SaveToBinary(const char* filename, const char* sourceFilename) const;
+  bool SaveToText(const char* filename) const;
+
+  void Clear();
+  bool IsSameData(const FontData& other) const;
+
+  static std::string GetBinaryFilename(const char* filename);
+
+  float fontSize = 0;
+  int paddingUp = 0;
+  int paddingRight = 0;
+  int paddingDown = 0;
+  int paddingLeft = 0;
+  DirectX::XMFLOAT2 textureSize = { 0, 0 };
+  std::vector<std::string> pages;          // eNX`(tHgt@C̑΃pX)
+  std::vector<uint32_t> codePoints;        // R[h()
+  std::vector<float> advances;             // 蕝
+  std::vector<FontInfoInShader> glyphs;    // VF[_ptHgf[^
+
+  int errorLine = 0;   // eLXg`̓ǂݍ݂Ɏss
+  bool isBinary = false; // Ōɓǂݍ񂾂̂ϊς݃t@CȂtrue
+};
+
+} // namespace DX12
+} // namespace EasyLib
+
+#endif // EASYLIB_DX12_FONTDATA_H
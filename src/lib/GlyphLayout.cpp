@@ -0,0 +1,113 @@
+/**
+* @file GlyphLayout.cpp
+*/
+#include "GlyphLayout.h"
+#include "Utf8.h"
+
+namespace EasyLib {
+namespace DX12 {
+
+using namespace DirectX;
+
+namespace /* unnamed */ {
+
+/**
+* 1zu
+*
+* 摜̂Ȃ(󔒂Ȃ)ނA񂾐i߂Ȃ̂Ŏ̕ŏ㏑
+*/
+inline void PlaceGlyph(uint32_t c, const GlyphLayoutFont& font, const XMFLOAT2& scale,
+  uint32_t run, float& x, float& y, size_t& count, GlyphInShader* glyphs)
+{
+  if (c == '\n') {
+    x = 0;
+    y += font.lineHeight;
+  }
+  const uint16_t glyph = font.glyphTable->Find(c);
+  GlyphInShader g;
+  g.offset = XMFLOAT2(x * scale.x, y * scale.y);
+  g.fontIndex = glyph;
+  g.run = run;
+  glyphs[count] = g;
+  count += font.visible[glyph];
+  x += font.advances[glyph];
+}
+
+} // unnamed namespace
+
+/**
+* ̕zu(QƗp̔ėp)
+*
+* LayoutGlyphsɒuÓA1ĕ򂷂zu
+* LayoutGlyphsƓʂɂȂ邱Ƃm߂邽߂̂̂ŁA`ɂ͎gȂ
+* ʒu͊g嗦|lŗݐς̂ŁAg嗦Ƒ蕝̐ςmɕ\Ȃꍇ
+* ŉʃrbgقȂ邱Ƃ
+*
+* Ɩ߂lLayoutGlyphsƓ
+*/
+size_t LayoutGlyphsScalar(const char* text, size_t length, const GlyphLayoutFont& font,
+  const XMFLOAT2& scale, uint32_t run, GlyphInShader* glyphs)
+{
+  const char* p = text;
+  const char* const end = text + length;
+  XMFLOAT2 pos(0, 0);
+  size_t count = 0;
+  while (p < end) {
+    const char32_t c = DecodeUtf8(p, end);
+    if (c == '\n') {
+      pos.x = 0;
+      pos.y += font.lineHeight * scale.y;
+    }
+    const uint16_t glyph = font.glyphTable->Find(c);
+    if (font.visible[glyph]) {
+      glyphs[count].offset = pos;
+      glyphs[count].fontIndex = glyph;
+      glyphs[count].run = run;
+      ++count;
+    }
+    pos.x += font.advances[glyph] * scale.x;
+  }
+  return count;
+}
+
+/**
+* ̕zu
+*
+* 蕝͕ԍƂ̕\ɂāAƂ̕ȂĂ
+* ʒu͊g嗦|O̒lŗݐςAނƂɊg嗦|
+* (tHg̒l͐Ȃ̂ŗݐςɌ덷ȂAԂςĂʂςȂ)
+* sƉʒu0ɖ߂Acʒus̊Ԋu₷
+* ASCII1oCg̂܂ܔzuAȊO̕UTF-8𕜍
+*
+* @param text   UTF-8̕
+* @param length ̃oCg
+* @param font   tHg
+* @param scale  g嗦
+* @param run    f[^ɐݒ肷镶f[^̔ԍ
+* @param glyphs f[^̏ݐ(lengthvfȏ)
+*
+* @return 񂾕f[^̐
+*/
+size_t LayoutGlyphs(const char* text, size_t length, const GlyphLayoutFont& font,
+  const XMFLOAT2& scale, uint32_t run, GlyphInShader* glyphs)
+{
+  const char* p = text;
+  const char* const end = text + length;
+  float x = 0;
+  float y = 0;
+  size_t count = 0;
+  while (p < end) {
+    const size_t n = CountAsciiRun(p, static_cast<size_t>(end - p));
+    for (size_t i = 0; i < n; ++i) {
+      PlaceGlyph(static_cast<uint8_t>(p[i]), font, scale, run, x, y, count, glyphs);
+    }
+    p += n;
+    if (p < end) {
+      PlaceGlyph(DecodeUtf8Sequence(p, end), font, scale, run, x, y, count, glyphs);
+    }
+  }
+  return count;
+}
+
+} // namespace DX12
+} // namespace EasyLib
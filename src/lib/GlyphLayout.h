@@ -0,0 +1,57 @@
+/**
+* @file GlyphLayout.h
+*/
+#ifndef EASYLIB_DX12_GLYPHLAYOUT_H
+#define EASYLIB_DX12_GLYPHLAYOUT_H
+#include "GlyphTable.h"
+#include "PortableMath.h"
+#include <stddef.h>
+#include <stdint.h>
+
+namespace EasyLib {
+namespace DX12 {
+
+/**
+* VF[_pf[^
+*/
+struct GlyphInShader
+{
+  DirectX::XMFLOAT2 offset; // ̕\ʒüʒu(g嗦|l)
+  uint32_t fontIndex;       // ԍ
+  uint32_t run;             // GlyphRunInShader̔ԍ
+};
+
+/**
+* VF[_pf[^
+*
+* ̒ŋʂ̒ĺAƂł͂Ȃ񂲂Ƃ1
+*/
+struct GlyphRunInShader
+{
+  DirectX::XMFLOAT2 origin; // ̕\ʒu(Y͏)
+  DirectX::XMFLOAT2 scale;
+  DirectX::XMFLOAT4 color;
+};
+
+/**
+* ̔zuɎgtHg
+*
+* 蕝ƍs̊Ԋu͊g嗦|O̒l
+*/
+struct GlyphLayoutFont
+{
+  const GlyphTable* glyphTable = nullptr; // R[h -> ԍ
+  const float* advances = nullptr;        // ԍ -> 蕝(Ԋu܂)
+  const uint8_t* visible = nullptr;       // ԍ -> 摜1AȂ0
+  float lineHeight = 0;                   // s̊Ԋu
+};
+
+size_t LayoutGlyphs(const char* text, size_t length, const GlyphLayoutFont& font,
+  const DirectX::XMFLOAT2& scale, uint32_t run, GlyphInShader* glyphs);
+size_t LayoutGlyphsScalar(const char* text, size_t length, const GlyphLayoutFont& font,
+  const DirectX::XMFLOAT2& scale, uint32_t run, GlyphInShader* glyphs);
+
+} // namespace DX12
+} // namespace EasyLib
+
+#endif // EASYLIB_DX12_GLYPHLAYOUT_H
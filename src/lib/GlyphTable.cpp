@@ -0,0 +1,66 @@
+/**
+* @file GlyphTable.cpp
+*/
+#include "GlyphTable.h"
+#include <algorithm>
+
+namespace EasyLib {
+namespace DX12 {
+
+/**
+* \쐬
+*
+* codePoints[i]̕ԍi+1ɂȂ. R[hΌ̂̂g
+*
+* @param codePoints R[h̔z
+* @param count      z̒(UINT16_MAX)
+*
+* @retval true  쐬
+* @retval false A܂͔͈͊O̕R[h
+*/
+bool GlyphTable::Build(const uint32_t* codePoints, size_t count)
+{
+  Clear();
+  if (count >= UINT16_MAX) {
+    return false;
+  }
+  uint32_t maxPage = 0;
+  for (size_t i = 0; i < count; ++i) {
+    if (codePoints[i] > maxCodePoint) {
+      return false;
+    }
+    maxPage = std::max(maxPage, codePoints[i] >> pageBits);
+  }
+
+  // 0Ԃ̃y[W͋̃y[WƂāAׂĂ̕R[h̃y[WɊ蓖ĂĂ
+  pageIndices.assign(count > 0 ? maxPage + 1 : 0, 0);
+  entries.assign(pageSize, noGlyph);
+  for (size_t i = 0; i < count; ++i) {
+    uint16_t& pageIndex = pageIndices[codePoints[i] >> pageBits];
+    if (pageIndex == 0) {
+      if (entries.size() / pageSize >= UINT16_MAX) {
+        Clear();
+        return false;
+      }
+      pageIndex = static_cast<uint16_t>(entries.size() / pageSize);
+      entries.resize(entries.size() + pageSize, noGlyph);
+    }
+    entries[(static_cast<size_t>(pageIndex) << pageBits) | (codePoints[i] & (pageSize - 1))] =
+      static_cast<uint16_t>(i + 1);
+  }
+  return true;
+}
+
+/**
+* \ɂ
+*
+* ̕\ł́AׂĂ̕R[hɑ΂noGlyphԂ
+*/
+void GlyphTable::Clear()
+{
+  pageIndices.clear();
+  entries.clear();
+}
+
+} // namespace DX12
+} // namespace EasyLib
@@ -0,0 +1,61 @@
+/**
+* @file GlyphTable.h
+*/
+#ifndef EASYLIB_DX12_GLYPHTABLE_H
+#define EASYLIB_DX12_GLYPHTABLE_H
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+namespace EasyLib {
+namespace DX12 {
+
+/**
+* R[h當ԍ2i̕\
+*
+* R[h̏ʃrbg(256Pʂ̃y[W)Ńy[WԍA8bitŃy[W̕ԍ
+* ܂܂Ȃy[Wׂ͂0Ԃ̋̃y[WL̂ŁA\̑傫͎gĂ镶͈̔͂ɔႷ
+* ԍ1n܂A0͕ȂƂ\
+* \ɂȂR[hł0ԂȂ̂ŁAĂяoŔ͈͂m߂Kv͂Ȃ
+*/
+class GlyphTable
+{
+public:
+  static constexpr uint32_t pageBits = 8;
+  static constexpr uint32_t pageSize = 1 << pageBits; // 1y[W̕
+  static constexpr uint32_t maxCodePoint = 0x10ffff;
+  static constexpr uint16_t noGlyph = 0;
+
+  GlyphTable() = default;
+  ~GlyphTable() = default;
+
+  bool Build(const uint32_t* codePoints, size_t count);
+  void Clear();
+
+  /**
+  * ԍ擾
+  *
+  * @return ԍ. ȂnoGlyph
+  */
+  uint16_t Find(uint32_t codePoint) const {
+    const uint32_t page = codePoint >> pageBits;
+    if (page >= pageIndices.size()) {
+      return noGlyph;
+    }
+    return entries[(static_cast<size_t>(pageIndices[page]) << pageBits) | (codePoint & (pageSize - 1))];
+  }
+
+  size_t GetPageCount() const { return entries.size() / pageSize; } // ̃y[W܂
+  size_t GetMemorySize() const {
+    return pageIndices.size() * sizeof(uint16_t) + entries.size() * sizeof(uint16_t);
+  }
+
+private:
+  std::vector<uint16_t> pageIndices; // R[h̃y[W -> y[Wԍ(0͋̃y[W)
+  std::vector<uint16_t> entries;     // y[Wԍ * pageSize + R[h̉8bit -> ԍ
+};
+
+} // namespace DX12
+} // namespace EasyLib
+
+#endif // EASYLIB_DX12_GLYPHTABLE_H
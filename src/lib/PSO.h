@@ -1,5 +1,6 @@
 #ifndef EASYLIB_DX12_PSO_H
 #define EASYLIB_DX12_PSO_H
+#include "DrawData.h"
 #include <d3d12.h>
 #include <wrl/client.h>
 #include <memory>
@@ -8,13 +9,6 @@ namespace EasyLib {
 
 namespace DX12 {
 
-enum class BlendMode {
-  Opaque,
-  Multiply,
-  Addition,
-  Subtraction,
-};
-
 enum class CullMode {
   None,
   Front,
@@ -0,0 +1,283 @@
+/**
+* @file Particle.cpp
+*/
+#define NOMINMAX
+#include "Particle.h"
+#include "CpuFeatures.h"
+#include <algorithm>
+#include <chrono>
+#include <math.h>
+#ifdef EASYLIB_X86_SIMD
+#include <immintrin.h>
+#endif
+
+namespace EasyLib {
+
+namespace /* unnamed */ {
+
+/**
+* p[eBŇvZɎgz
+*/
+struct ParticleArrays
+{
+  float* positionX;
+  float* positionY;
+  float* velocityX;
+  float* velocityY;
+  const float* gravity;
+  float* age;
+  const float* invLife;
+  const float* frameCount;
+  const uint32_t* frameBase;
+  uint32_t* frames;
+};
+
+/**
+* p[eBNi߂(ėp)
+*
+* @param a     p[eBN̔z
+* @param begin Jnʒu
+* @param end   Iʒu
+* @param dt    oߎ
+*/
+void UpdateParticlesScalar(const ParticleArrays& a, size_t begin, size_t end, float dt)
+{
+  for (size_t i = begin; i < end; ++i) {
+    a.velocityY[i] += a.gravity[i] * dt;
+    a.positionX[i] += a.velocityX[i] * dt;
+    a.positionY[i] += a.velocityY[i] * dt;
+    a.age[i] += dt;
+    const float f = std::min(a.age[i] * a.invLife[i] * a.frameCount[i], a.frameCount[i] - 1.0f);
+    a.frames[i] = a.frameBase[i] + static_cast<uint32_t>(static_cast<int32_t>(f));
+  }
+}
+
+#ifdef EASYLIB_X86_SIMD
+/**
+* p[eBNi߂(SSE)
+*
+* 4vZA[͔ėpłŏ
+*/
+void UpdateParticlesSSE(const ParticleArrays& a, size_t count, float dt)
+{
+  const __m128 vdt = _mm_set1_ps(dt);
+  const __m128 one = _mm_set1_ps(1.0f);
+  size_t i = 0;
+  for (; i + 4 <= count; i += 4) {
+    const __m128 vy = _mm_add_ps(_mm_loadu_ps(a.velocityY + i), _mm_mul_ps(_mm_loadu_ps(a.gravity + i), vdt));
+    _mm_storeu_ps(a.velocityY + i, vy);
+    _mm_storeu_ps(a.positionX + i,
+      _mm_add_ps(_mm_loadu_ps(a.positionX + i), _mm_mul_ps(_mm_loadu_ps(a.velocityX + i), vdt)));
+    _mm_storeu_ps(a.positionY + i, _mm_add_ps(_mm_loadu_ps(a.positionY + i), _mm_mul_ps(vy, vdt)));
+    const __m128 age = _mm_add_ps(_mm_loadu_ps(a.age + i), vdt);
+    _mm_storeu_ps(a.age + i, age);
+    const __m128 n = _mm_loadu_ps(a.frameCount + i);
+    const __m128 f = _mm_min_ps(_mm_mul_ps(_mm_mul_ps(age, _mm_loadu_ps(a.invLife + i)), n), _mm_sub_ps(n, one));
+    const __m128i frame = _mm_add_epi32(_mm_cvttps_epi32(f),
+      _mm_loadu_si128(reinterpret_cast<const __m128i*>(a.frameBase + i)));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(a.frames + i), frame);
+  }
+  UpdateParticlesScalar(a, i, count, dt);
+}
+
+/**
+* p[eBNi߂(AVX2)
+*
+* 8vZA[͔ėpłŏ
+*/
+EASYLIB_TARGET_AVX2 void UpdateParticlesAVX2(const ParticleArrays& a, size_t count, float dt)
+{
+  const __m256 vdt = _mm256_set1_ps(dt);
+  const __m256 one = _mm256_set1_ps(1.0f);
+  size_t i = 0;
+  for (; i + 8 <= count; i += 8) {
+    const __m256 vy = _mm256_add_ps(_mm256_loadu_ps(a.velocityY + i),
+      _mm256_mul_ps(_mm256_loadu_ps(a.gravity + i), vdt));
+    _mm256_storeu_ps(a.velocityY + i, vy);
+    _mm256_storeu_ps(a.positionX + i,
+      _mm256_add_ps(_mm256_loadu_ps(a.positionX + i), _mm256_mul_ps(_mm256_loadu_ps(a.velocityX + i), vdt)));
+    _mm256_storeu_ps(a.positionY + i, _mm256_add_ps(_mm256_loadu_ps(a.positionY + i), _mm256_mul_ps(vy, vdt)));
+    const __m256 age = _mm256_add_ps(_mm256_loadu_ps(a.age + i), vdt);
+    _mm256_storeu_ps(a.age + i, age);
+    const __m256 n = _mm256_loadu_ps(a.frameCount + i);
+    const __m256 f = _mm256_min_ps(_mm256_mul_ps(_mm256_mul_ps(age, _mm256_loadu_ps(a.invLife + i)), n),
+      _mm256_sub_ps(n, one));
+    const __m256i frame = _mm256_add_epi32(_mm256_cvttps_epi32(f),
+      _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a.frameBase + i)));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(a.frames + i), frame);
+  }
+  UpdateParticlesScalar(a, i, count, dt);
+}
+#endif // EASYLIB_X86_SIMD
+
+/**
+* p[eBNi߂
+*
+* @param a     p[eBN̔z
+* @param count p[eBN̐
+* @param dt    oߎ
+*/
+void UpdateParticles(const ParticleArrays& a, size_t count, float dt)
+{
+#ifdef EASYLIB_X86_SIMD
+  static const bool hasAVX2 = HasAVX2();
+  if (hasAVX2) {
+    UpdateParticlesAVX2(a, count, dt);
+  } else {
+    UpdateParticlesSSE(a, count, dt);
+  }
+#else
+  UpdateParticlesScalar(a, 0, count, dt);
+#endif // EASYLIB_X86_SIMD
+}
+
+} // unnamed namespace
+
+/**
+* p[eBNVXe
+*
+* @param capacity ɑ݂łp[eBN̍ő吔
+*/
+bool ParticleSystem::Init(uint32_t capacity)
+{
+  types.clear();
+  imageTable.clear();
+  for (auto* e : { &positionX, &positionY, &velocityX, &velocityY, &gravity, &age, &invLife, &frameCount, &scale }) {
+    e->assign(capacity, 0.0f);
+  }
+  frameBase.assign(capacity, 0);
+  frames.assign(capacity, 0);
+  count = 0;
+  return true;
+}
+
+/**
+* ׂẴp[eBN
+*/
+void ParticleSystem::Clear()
+{
+  count = 0;
+}
+
+/**
+* p[eBN̎ނ쐬
+*
+* @param desc ނ̐ݒ
+*
+* @return ޔԍ. 쐬łȂꍇinvalidType
+*/
+uint32_t ParticleSystem::CreateType(const ParticleTypeDesc& desc)
+{
+  if (!desc.images || desc.imageCount == 0 || desc.life <= 0) {
+    return invalidType;
+  }
+  Type type;
+  type.desc = desc;
+  type.desc.images = nullptr; // 摜͉摜\ɃRs[̂ŁAĂяo̔z͎QƂȂ
+  type.imageOffset = static_cast<uint32_t>(imageTable.size());
+  imageTable.insert(imageTable.end(), desc.images, desc.images + desc.imageCount);
+  types.push_back(type);
+  return static_cast<uint32_t>(types.size() - 1);
+}
+
+/**
+* p[eBN𔭐
+*
+* @param type  ޔԍ
+* @param x     XW
+* @param y     YW
+* @param count 鐔
+*
+* @return ۂɔ(󂫂Ȃcount菭ȂȂ)
+*/
+size_t ParticleSystem::Emit(uint32_t type, float x, float y, size_t count)
+{
+  if (type >= types.size()) {
+    return 0;
+  }
+  const Type& t = types[type];
+  const ParticleTypeDesc& desc = t.desc;
+  const size_t n = std::min(count, GetCapacity() - this->count);
+  for (size_t i = this->count; i < this->count + n; ++i) {
+    const float angle = desc.angleMin + (desc.angleMax - desc.angleMin) * Random();
+    const float speed = desc.speedMin + (desc.speedMax - desc.speedMin) * Random();
+    positionX[i] = x;
+    positionY[i] = y;
+    velocityX[i] = cosf(angle) * speed;
+    velocityY[i] = sinf(angle) * speed;
+    gravity[i] = desc.gravity;
+    age[i] = 0;
+    invLife[i] = 1.0f / desc.life;
+    frameCount[i] = static_cast<float>(desc.imageCount);
+    frameBase[i] = t.imageOffset;
+    frames[i] = t.imageOffset;
+    scale[i] = desc.scale;
+  }
+  this->count += n;
+  return n;
+}
+
+/**
+* ׂẴp[eBNi߁Aŝ
+*
+* @param deltaTime oߎ
+*/
+void ParticleSystem::Update(float deltaTime)
+{
+  const auto begin = std::chrono::steady_clock::now();
+
+  const ParticleArrays a = {
+    positionX.data(), positionY.data(), velocityX.data(), velocityY.data(), gravity.data(),
+    age.data(), invLife.data(), frameCount.data(), frameBase.data(), frames.data(),
+  };
+  UpdateParticles(a, count, deltaTime);
+
+  // sp[eBN𖖔̂̂Ŗ߂
+  for (size_t i = 0; i < count;) {
+    if (age[i] * invLife[i] >= 1.0f) {
+      Remove(i);
+    } else {
+      ++i;
+    }
+  }
+
+  const auto end = std::chrono::steady_clock::now();
+  updateNanoseconds = static_cast<uint64_t>(
+    std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count());
+}
+
+/**
+* p[eBNÃp[eBNŖ߂
+*/
+void ParticleSystem::Remove(size_t i)
+{
+  const size_t last = --count;
+  if (i != last) {
+    positionX[i] = positionX[last];
+    positionY[i] = positionY[last];
+    velocityX[i] = velocityX[last];
+    velocityY[i] = velocityY[last];
+    gravity[i] = gravity[last];
+    age[i] = age[last];
+    invLife[i] = invLife[last];
+    frameCount[i] = frameCount[last];
+    frameBase[i] = frameBase[last];
+    frames[i] = frames[last];
+    scale[i] = scale[last];
+  }
+}
+
+/**
+* 0ȏ1̗Ԃ(xorshift32)
+*/
+float ParticleSystem::Random()
+{
+  uint32_t x = randomState;
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  randomState = x;
+  return static_cast<float>(x >> 8) * (1.0f / 16777216.0f);
+}
+
+} // namespace EasyLib
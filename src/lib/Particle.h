@@ -0,0 +1,99 @@
+/**
+* @file Particle.h
+*/
+#ifndef EASYLIB_PARTICLE_H
+#define EASYLIB_PARTICLE_H
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+namespace EasyLib {
+
+/**
+* p[eBN̎
+*
+* 摜͎̊Ԃɐ擪珇ɐ؂ւ
+* Wn̓XvCgƓ(Y͉)ŁAԂ̒PʂUpdateɓnlƓ(ʏ̓t[)
+*/
+struct ParticleTypeDesc
+{
+  const uint32_t* images = nullptr; // 摜(eNX`nh)̔z
+  uint32_t imageCount = 0;
+  float life = 30;       // 
+  float speedMin = 1;    // ͈̑̔
+  float speedMax = 4;
+  float angleMin = 0;    // ͈̌̔(WA)
+  float angleMax = 6.2831853f;
+  float gravity = 0;     // Ỷx
+  float scale = 1;       // 摜̊g嗦
+};
+
+/**
+* Œ萔̃p[eBNǗNX
+*
+* p[eBN͗vfƂ̔z(SoA)ɋl߂Ċi[A
+* Update͑xAWAoߎԁA\摜܂Ƃ߂SIMDŌvZ
+* ŝ͖̃p[eBNŖ߂̂ŁA͕ۂȂ
+* `SpriteRenderer::SubmitParticlesɓnASpriteoRɒڃVF[_pf[^ɕϊ
+* GPUɂ͈ؐGȂ̂ŁAP̂ŃeXgx`}[Nł
+*/
+class ParticleSystem
+{
+public:
+  static constexpr uint32_t invalidType = UINT32_MAX;
+
+  ParticleSystem() = default;
+  ~ParticleSystem() = default;
+
+  bool Init(uint32_t capacity);
+  void Clear();
+
+  uint32_t CreateType(const ParticleTypeDesc& desc);
+  size_t Emit(uint32_t type, float x, float y, size_t count);
+  void Update(float deltaTime);
+
+  size_t GetCount() const { return count; }
+  size_t GetCapacity() const { return positionX.size(); }
+  uint64_t GetUpdateNanoseconds() const { return updateNanoseconds; }
+
+  // `p̃f[^
+  const float* GetPositionX() const { return positionX.data(); }
+  const float* GetPositionY() const { return positionY.data(); }
+  const float* GetScale() const { return scale.data(); }
+  const uint32_t* GetFrames() const { return frames.data(); } // 摜\̔ԍ
+  const uint32_t* GetImageTable() const { return imageTable.data(); }
+  size_t GetImageTableSize() const { return imageTable.size(); }
+
+private:
+  void Remove(size_t i);
+  float Random();
+
+  // ނƂ̐ݒ
+  struct Type {
+    ParticleTypeDesc desc;
+    uint32_t imageOffset;
+  };
+  std::vector<Type> types;
+  std::vector<uint32_t> imageTable; // ׂĂ̎ނ̉摜Ȃ\
+
+  // p[eBN(擪countL)
+  std::vector<float> positionX;
+  std::vector<float> positionY;
+  std::vector<float> velocityX;
+  std::vector<float> velocityY;
+  std::vector<float> gravity;
+  std::vector<float> age;          // oߎ
+  std::vector<float> invLife;      // ̋t
+  std::vector<float> frameCount;   // 摜̐
+  std::vector<uint32_t> frameBase; // 摜\̐擪ʒu
+  std::vector<uint32_t> frames;    // ݂̉摜(摜\̔ԍ)
+  std::vector<float> scale;
+  size_t count = 0;
+
+  uint32_t randomState = 0x12345678;
+  uint64_t updateNanoseconds = 0; // OUpdateɂ
+};
+
+} // namespace EasyLib
+
+#endif // EASYLIB_PARTICLE_H
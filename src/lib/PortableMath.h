@@ -0,0 +1,43 @@
+/**
+* @file PortableMath.h
+*/
+#ifndef EASYLIB_PORTABLEMATH_H
+#define EASYLIB_PORTABLEMATH_H
+
+#ifdef _WIN32
+#include <DirectXMath.h>
+#else
+/**
+* DirectXMatĥȂŁAD3D12ɈˑȂR[hrh邽߂̍ŏ̌^
+*
+* o̕тƑ傫DirectXMathƓɂĂ
+*/
+namespace DirectX {
+
+constexpr float XM_2PI = 6.283185307f;
+
+struct XMFLOAT2
+{
+  float x, y;
+  XMFLOAT2() = default;
+  constexpr XMFLOAT2(float _x, float _y) : x(_x), y(_y) {}
+};
+
+struct XMFLOAT3
+{
+  float x, y, z;
+  XMFLOAT3() = default;
+  constexpr XMFLOAT3(float _x, float _y, float _z) : x(_x), y(_y), z(_z) {}
+};
+
+struct XMFLOAT4
+{
+  float x, y, z, w;
+  XMFLOAT4() = default;
+  constexpr XMFLOAT4(float _x, float _y, float _z, float _w) : x(_x), y(_y), z(_z), w(_w) {}
+};
+
+} // namespace DirectX
+#endif // _WIN32
+
+#endif // EASYLIB_PORTABLEMATH_H
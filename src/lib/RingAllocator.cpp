@@ -0,0 +1,101 @@
+/**
+* @file RingAllocator.cpp
+*/
+#include "RingAllocator.h"
+
+namespace EasyLib {
+namespace DX12 {
+
+/**
+* ׂĂ̗̈𖢎gpɂ
+*
+* @param capacity ǗoCg
+*/
+void RingAllocator::Init(uint64_t capacity)
+{
+  this->capacity = capacity;
+  frames.clear();
+  head = 0;
+  tail = 0;
+  usedSize = 0;
+  frameSize = 0;
+}
+
+/**
+* ̈m
+*
+* @param size      mۂoCg
+* @param alignment 擪ʒũACg(2̗ݏ)
+*
+* @return mۂ̈̐擪ItZbg. 󂫂ȂinvalidOffset
+*/
+uint64_t RingAllocator::Allocate(uint64_t size, uint64_t alignment)
+{
+  if (size == 0 || size > capacity) {
+    return invalidOffset;
+  }
+
+  uint64_t offset = (head + alignment - 1) & ~(alignment - 1);
+  uint64_t newHead = offset + size;
+  if (usedSize == 0 || head > tail) {
+    // 󂫗̈[head, capacity)[0, tail)2
+    if (newHead > capacity) {
+      // ɓȂΐ擪ɐ܂Ԃ
+      offset = 0;
+      newHead = size;
+      if (usedSize != 0 && newHead > tail) {
+        return invalidOffset;
+      }
+    }
+  } else {
+    // ܂Ԃς݂Ȃ̂ŁA󂫗̈[head, tail)
+    if (newHead > tail) {
+      return invalidOffset;
+    }
+  }
+
+  // ܂Ԃꍇ͖̗]̂ƂĈ
+  const uint64_t consumed = newHead > head ? newHead - head : capacity - head + newHead;
+  head = newHead;
+  usedSize += consumed;
+  frameSize += consumed;
+  return offset;
+}
+
+/**
+* ݂̃t[̊mۂߐ؂
+*
+* @param fenceValue ̃t[̃R}hƂɓBtFXl
+*/
+void RingAllocator::FinishFrame(uint64_t fenceValue)
+{
+  frames.push_back({ fenceValue, head, frameSize });
+  frameSize = 0;
+}
+
+/**
+* GPUgIt[̗̈
+*
+* @param completedFenceValue ς݂̃tFXl
+*/
+void RingAllocator::Retire(uint64_t completedFenceValue)
+{
+  while (!frames.empty() && frames.front().fenceValue <= completedFenceValue) {
+    const Frame& frame = frames.front();
+    if (frame.size > 0) {
+      tail = frame.end;
+      usedSize -= frame.size;
+    }
+    frames.pop_front();
+  }
+
+  // ɂȂ擪gāA܂Ԃɂ閳ʂ炷
+  // (cĂt[͂ǂ̈gĂȂ̂ŁAtail𓮂ĂȂ)
+  if (usedSize == 0) {
+    head = 0;
+    tail = 0;
+  }
+}
+
+} // namespace DX12
+} // namespace EasyLib
@@ -0,0 +1,58 @@
+/**
+* @file RingAllocator.h
+*/
+#ifndef EASYLIB_DX12_RINGALLOCATOR_H
+#define EASYLIB_DX12_RINGALLOCATOR_H
+#include <stddef.h>
+#include <stdint.h>
+#include <deque>
+
+namespace EasyLib {
+namespace DX12 {
+
+/**
+* tFXlŗ̈郊Oobt@̃ItZbgǗNX
+*
+* AllocateŊmۂ̈́AFinishFrameŎw肵tFXl
+* Retireɓnς݃tFXlɒB܂ōėpȂ
+* GPUɂ͈ؐGȂ̂ŁAtFXlŐi߂ΒP̂ŃeXgł
+*/
+class RingAllocator
+{
+public:
+  static constexpr uint64_t invalidOffset = UINT64_MAX; // mێs
+
+  RingAllocator() = default;
+  explicit RingAllocator(uint64_t capacity) { Init(capacity); }
+  ~RingAllocator() = default;
+
+  void Init(uint64_t capacity);
+  uint64_t Allocate(uint64_t size, uint64_t alignment);
+  void FinishFrame(uint64_t fenceValue);
+  void Retire(uint64_t completedFenceValue);
+
+  uint64_t GetCapacity() const { return capacity; }
+  uint64_t GetUsedSize() const { return usedSize; }
+  uint64_t GetFrameSize() const { return frameSize; }
+  size_t GetPendingFrameCount() const { return frames.size(); }
+
+private:
+  // FinishFrameς݂ŁAGPŮ҂Ăt[
+  struct Frame {
+    uint64_t fenceValue; // ̃tFXlɒBł
+    uint64_t end;        // t[g̈̏I[
+    uint64_t size;       // t[oCg(ACg܂Ԃ̖ʂ܂)
+  };
+  std::deque<Frame> frames;
+
+  uint64_t capacity = 0;
+  uint64_t head = 0;      // Ɋmۂʒu
+  uint64_t tail = 0;      // gp̗̈̐擪
+  uint64_t usedSize = 0;  // gp̃oCg(݂̃t[܂)
+  uint64_t frameSize = 0; // ݂̃t[oCg
+};
+
+} // namespace DX12
+} // namespace EasyLib
+
+#endif // EASYLIB_DX12_RINGALLOCATOR_H
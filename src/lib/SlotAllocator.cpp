@@ -0,0 +1,83 @@
+/**
+* @file SlotAllocator.cpp
+*/
+#include "SlotAllocator.h"
+
+namespace EasyLib {
+namespace DX12 {
+
+/**
+* XbgׂĖgpɂ
+*
+* @param capacity Xbg(ő65536)
+*/
+bool SlotAllocator::Init(uint32_t capacity)
+{
+  if (capacity > maxCapacity) {
+    return false;
+  }
+  generations.assign(capacity, 1);
+  used.assign(capacity, false);
+  freeSlots.clear();
+  for (uint32_t i = 0; i < capacity; ++i) {
+    freeSlots.push_back(i);
+  }
+  usedCount = 0;
+  return true;
+}
+
+/**
+* Xbgm
+*
+* @return mۂXbg̃nh. 󂫂ȂinvalidHandle
+*/
+uint32_t SlotAllocator::Allocate()
+{
+  if (freeSlots.empty()) {
+    return invalidHandle;
+  }
+  const uint32_t index = freeSlots.front();
+  freeSlots.pop_front();
+  used[index] = true;
+  ++usedCount;
+  return (static_cast<uint32_t>(generations[index]) << indexBits) | index;
+}
+
+/**
+* Xbg
+*
+* @param handle Xbg̃nh
+*
+* @retval true  
+* @retval false nh(ς݂Ȃ)
+*/
+bool SlotAllocator::Free(uint32_t handle)
+{
+  if (!IsValid(handle)) {
+    return false;
+  }
+  const uint32_t index = GetIndex(handle);
+  used[index] = false;
+  --usedCount;
+  // ԍi߂ČÂnh𖳌ɂ(0͖ȃnhpȂ̂Ŕ΂)
+  if (++generations[index] == 0) {
+    generations[index] = 1;
+  }
+  freeSlots.push_back(index);
+  return true;
+}
+
+/**
+* nhgp̃XbgwĂ邩ׂ
+*/
+bool SlotAllocator::IsValid(uint32_t handle) const
+{
+  const uint32_t index = GetIndex(handle);
+  if (handle == invalidHandle || index >= generations.size()) {
+    return false;
+  }
+  return used[index] && generations[index] == GetGeneration(handle);
+}
+
+} // namespace DX12
+} // namespace EasyLib
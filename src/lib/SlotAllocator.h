@@ -0,0 +1,52 @@
+/**
+* @file SlotAllocator.h
+*/
+#ifndef EASYLIB_DX12_SLOTALLOCATOR_H
+#define EASYLIB_DX12_SLOTALLOCATOR_H
+#include <stdint.h>
+#include <vector>
+#include <deque>
+
+namespace EasyLib {
+namespace DX12 {
+
+/**
+* ԍ̃XbgǗNX
+*
+* nh͉16bitXbgԍA16bitԍ
+* ꂽXbg͐ԍiނ̂ŁAÂnhIsValidŌoł
+* ꂽXbg͐ɉꂽ̂ėp(GPUgp̉\炷)
+* GPUɂ͈ؐGȂ̂ŁAP̂ŃeXgł
+*/
+class SlotAllocator
+{
+public:
+  static constexpr uint32_t invalidHandle = 0; // ȃnh(ԍ0͎gȂ)
+  static constexpr uint32_t indexBits = 16;
+  static constexpr uint32_t indexMask = (1u << indexBits) - 1;
+  static constexpr uint32_t maxCapacity = 1u << indexBits;
+
+  SlotAllocator() = default;
+  ~SlotAllocator() = default;
+
+  bool Init(uint32_t capacity);
+  uint32_t Allocate();
+  bool Free(uint32_t handle);
+  bool IsValid(uint32_t handle) const;
+
+  uint32_t GetCapacity() const { return static_cast<uint32_t>(generations.size()); }
+  uint32_t GetUsedCount() const { return usedCount; }
+  static uint32_t GetIndex(uint32_t handle) { return handle & indexMask; }
+  static uint32_t GetGeneration(uint32_t handle) { return handle >> indexBits; }
+
+private:
+  std::vector<uint16_t> generations; // XbgƂ݂̌̐ԍ
+  std::vector<bool> used;
+  std::deque<uint32_t> freeSlots;
+  uint32_t usedCount = 0;
+};
+
+} // namespace DX12
+} // namespace EasyLib
+
+#endif // EASYLIB_DX12_SLOTALLOCATOR_H
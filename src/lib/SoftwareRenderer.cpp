@@ -0,0 +1,794 @@
+/**
+* @file SoftwareRenderer.cpp
+*/
+#define NOMINMAX
+#include "SoftwareRenderer.h"
+#include "CpuFeatures.h"
+#include "Utf8.h"
+#include <algorithm>
+#include <chrono>
+#include <math.h>
+#include <stdio.h>
+#include <memory>
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#include <emmintrin.h>
+#define EASYLIB_SOFTWARE_SIMD
+#endif
+#ifdef EASYLIB_X86_SIMD
+#include <immintrin.h>
+#endif
+
+namespace EasyLib {
+
+using namespace DirectX;
+
+namespace /* unnamed */ {
+
+/**
+* 0-1͈̔͂Ŋ炩ɕԂ(HLSLsmoothstepƓ)
+*/
+float SmoothStep(float edge0, float edge1, float x)
+{
+  const float t = std::min(std::max((x - edge0) / (edge1 - edge0), 0.0f), 1.0f);
+  return t * t * (3.0f - 2.0f * t);
+}
+
+/**
+* oCjATvOŎg4̃sNZƏd
+*/
+struct BilinearTaps
+{
+  uint32_t p00, p10, p01, p11;
+  float ax, ay;
+};
+
+/**
+* 摜̃sNZWAoCjATvOɎgsNZ߂
+*
+* ͈͊O͒[̃sNZg(TEXTURE_ADDRESS_CLAMPƓ)
+* u, v-0.5ȏł邱
+*/
+BilinearTaps GetBilinearTaps(const SoftwareImage& image, float u, float v)
+{
+  // floorf͒x̂ŁA-1ȏ̒lł邱Ƃ𗘗pĐ؂̂Ăŋ߂
+  const float fx = u - 0.5f;
+  const float fy = v - 0.5f;
+  const int ix = static_cast<int>(fx + 1.0f) - 1;
+  const int iy = static_cast<int>(fy + 1.0f) - 1;
+  const int maxX = static_cast<int>(image.width) - 1;
+  const int maxY = static_cast<int>(image.height) - 1;
+  const int x0 = std::min(std::max(ix, 0), maxX);
+  const int x1 = std::min(std::max(ix + 1, 0), maxX);
+  const int y0 = std::min(std::max(iy, 0), maxY);
+  const int y1 = std::min(std::max(iy + 1, 0), maxY);
+  const uint32_t* row0 = image.pixels.data() + static_cast<size_t>(y0) * image.width;
+  const uint32_t* row1 = image.pixels.data() + static_cast<size_t>(y1) * image.width;
+  return { row0[x0], row0[x1], row1[x0], row1[x1], fx - static_cast<float>(ix), fy - static_cast<float>(iy) };
+}
+
+#ifdef EASYLIB_SOFTWARE_SIMD
+/**
+* RGBA80-255̕_4vfɕϊ
+*/
+__m128 UnpackColor(uint32_t c)
+{
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i c8 = _mm_cvtsi32_si128(static_cast<int>(c));
+  return _mm_cvtepi32_ps(_mm_unpacklo_epi16(_mm_unpacklo_epi8(c8, zero), zero));
+}
+
+/**
+* 0-255̕_4vfRGBA8ɕϊ(͈͊O͖Oa)
+*/
+uint32_t PackColor(__m128 c)
+{
+  const __m128i c32 = _mm_cvtps_epi32(c);
+  const __m128i c16 = _mm_packs_epi32(c32, c32);
+  return static_cast<uint32_t>(_mm_cvtsi128_si32(_mm_packus_epi16(c16, c16)));
+}
+
+/**
+* oCjATvO(0-255)
+*
+* 2sNZ16bitɍLA7biťŒ菬_̏d݂ŕԂ
+*/
+__m128 Sample(const BilinearTaps& t)
+{
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i row0 = _mm_unpacklo_epi8(
+    _mm_unpacklo_epi32(_mm_cvtsi32_si128(static_cast<int>(t.p00)), _mm_cvtsi32_si128(static_cast<int>(t.p10))), zero);
+  const __m128i row1 = _mm_unpacklo_epi8(
+    _mm_unpacklo_epi32(_mm_cvtsi32_si128(static_cast<int>(t.p01)), _mm_cvtsi32_si128(static_cast<int>(t.p11))), zero);
+  const __m128i ay = _mm_set1_epi16(static_cast<short>(t.ay * 128.0f + 0.5f));
+  const __m128i ax = _mm_set1_epi16(static_cast<short>(t.ax * 128.0f + 0.5f));
+  // c: [p0, p1] = row0 + (row1 - row0) * ay
+  const __m128i col = _mm_add_epi16(row0, _mm_srai_epi16(_mm_mullo_epi16(_mm_sub_epi16(row1, row0), ay), 7));
+  // : p0 + (p1 - p0) * ax
+  const __m128i hi = _mm_unpackhi_epi64(col, col);
+  const __m128i c = _mm_add_epi16(col, _mm_srai_epi16(_mm_mullo_epi16(_mm_sub_epi16(hi, col), ax), 7));
+  return _mm_cvtepi32_ps(_mm_unpacklo_epi16(c, zero));
+}
+
+/**
+* sNZ(PSÕuhݒƓvZ)
+*
+* @param dst       ̃sNZ
+* @param src       F(0-255)
+* @param blendMode uh[h
+*/
+void Blend(uint32_t& dst, __m128 src, DX12::BlendMode blendMode)
+{
+  const __m128 a = _mm_mul_ps(_mm_shuffle_ps(src, src, _MM_SHUFFLE(3, 3, 3, 3)), _mm_set1_ps(1.0f / 255.0f));
+  const __m128 d = UnpackColor(dst);
+  __m128 result;
+  switch (blendMode) {
+  default:
+  case DX12::BlendMode::Opaque:
+    result = src;
+    break;
+  case DX12::BlendMode::Multiply:
+    result = _mm_add_ps(_mm_mul_ps(src, a), _mm_mul_ps(d, _mm_sub_ps(_mm_set1_ps(1.0f), a)));
+    break;
+  case DX12::BlendMode::Addition:
+    result = _mm_add_ps(_mm_mul_ps(src, a), d);
+    break;
+  case DX12::BlendMode::Subtraction:
+    result = _mm_sub_ps(_mm_mul_ps(src, a), d);
+    break;
+  }
+  dst = PackColor(result);
+}
+#else
+/**
+* 0-255̕_4vfŕ\F
+*/
+struct Color4 { float v[4]; };
+
+Color4 UnpackColor(uint32_t c)
+{
+  return { { static_cast<float>(c & 0xff), static_cast<float>((c >> 8) & 0xff),
+    static_cast<float>((c >> 16) & 0xff), static_cast<float>(c >> 24) } };
+}
+
+uint32_t PackColor(const Color4& c)
+{
+  uint32_t result = 0;
+  for (int i = 0; i < 4; ++i) {
+    const float f = std::min(std::max(c.v[i], 0.0f), 255.0f);
+    result |= static_cast<uint32_t>(lrintf(f)) << (i * 8);
+  }
+  return result;
+}
+
+Color4 Sample(const BilinearTaps& t)
+{
+  const Color4 c00 = UnpackColor(t.p00);
+  const Color4 c10 = UnpackColor(t.p10);
+  const Color4 c01 = UnpackColor(t.p01);
+  const Color4 c11 = UnpackColor(t.p11);
+  Color4 result;
+  for (int i = 0; i < 4; ++i) {
+    const float top = c00.v[i] + (c10.v[i] - c00.v[i]) * t.ax;
+    const float bottom = c01.v[i] + (c11.v[i] - c01.v[i]) * t.ax;
+    result.v[i] = top + (bottom - top) * t.ay;
+  }
+  return result;
+}
+
+void Blend(uint32_t& dst, const Color4& src, DX12::BlendMode blendMode)
+{
+  const float a = src.v[3] * (1.0f / 255.0f);
+  const Color4 d = UnpackColor(dst);
+  Color4 result;
+  for (int i = 0; i < 4; ++i) {
+    switch (blendMode) {
+    default:
+    case DX12::BlendMode::Opaque: result.v[i] = src.v[i]; break;
+    case DX12::BlendMode::Multiply: result.v[i] = src.v[i] * a + d.v[i] * (1.0f - a); break;
+    case DX12::BlendMode::Addition: result.v[i] = src.v[i] * a + d.v[i]; break;
+    case DX12::BlendMode::Subtraction: result.v[i] = src.v[i] * a - d.v[i]; break;
+    }
+  }
+  dst = PackColor(result);
+}
+#endif // EASYLIB_SOFTWARE_SIMD
+
+#ifdef EASYLIB_X86_SIMD
+/**
+* 16bit̕: a + ((b - a) * w >> 7) (AVX2)
+*/
+EASYLIB_TARGET_AVX2 inline __m256i Lerp16(__m256i a, __m256i b, __m256i w)
+{
+  return _mm256_add_epi16(a, _mm256_srai_epi16(_mm256_mullo_epi16(_mm256_sub_epi16(b, a), w), 7));
+}
+
+/**
+* 8sNZ̏d(0-1)7biťŒ菬_ɂāAsNZƂ4`l16bitɍL(AVX2)
+*
+* lounpacklo_epi8Ɠ(sNZ0, 1 | 4, 5)Ahiunpackhi_epi8Ɠ(2, 3 | 6, 7)ɂȂ
+*/
+EASYLIB_TARGET_AVX2 inline void SpreadWeights(__m256 w, __m256i& lo, __m256i& hi)
+{
+  const __m256i w32 = _mm256_cvttps_epi32(_mm256_add_ps(_mm256_mul_ps(w, _mm256_set1_ps(128.0f)), _mm256_set1_ps(0.5f)));
+  const __m256i w16 = _mm256_or_si256(w32, _mm256_slli_epi32(w32, 16));
+  lo = _mm256_unpacklo_epi32(w16, w16);
+  hi = _mm256_unpackhi_epi32(w16, w16);
+}
+
+/**
+* 16bit̐F̔(high)0-255̕_ɕϊ(AVX2)
+*/
+EASYLIB_TARGET_AVX2 inline __m256 ToFloat(__m256i c16, bool high)
+{
+  const __m256i zero = _mm256_setzero_si256();
+  return _mm256_cvtepi32_ps(high ? _mm256_unpackhi_epi16(c16, zero) : _mm256_unpacklo_epi16(c16, zero));
+}
+
+/**
+* 2sNZ(128bit[Ƃ1sNZ)āA32bitɂ(AVX2)
+*
+* vZBlendƓ
+*/
+EASYLIB_TARGET_AVX2 inline __m256i Blend2(__m256 src, __m256 d, __m256 tint, DX12::BlendMode blendMode)
+{
+  src = _mm256_mul_ps(src, tint);
+  const __m256 a = _mm256_mul_ps(_mm256_shuffle_ps(src, src, _MM_SHUFFLE(3, 3, 3, 3)), _mm256_set1_ps(1.0f / 255.0f));
+  __m256 result;
+  switch (blendMode) {
+  default:
+  case DX12::BlendMode::Opaque:
+    result = src;
+    break;
+  case DX12::BlendMode::Multiply:
+    result = _mm256_add_ps(_mm256_mul_ps(src, a), _mm256_mul_ps(d, _mm256_sub_ps(_mm256_set1_ps(1.0f), a)));
+    break;
+  case DX12::BlendMode::Addition:
+    result = _mm256_add_ps(_mm256_mul_ps(src, a), d);
+    break;
+  case DX12::BlendMode::Subtraction:
+    result = _mm256_sub_ps(_mm256_mul_ps(src, a), d);
+    break;
+  }
+  return _mm256_cvtps_epi32(result);
+}
+
+/**
+* XvCg̋Ԃ8sNZ`悷(AVX2)
+*
+* sNZ̉摜W̓XJ[łƓ uRow + dudx * (Ԃ̐擪̈ʒu + first) ŋ߂
+* 4̃sNZgatherœǂ݁AԂƍSample, BlendƓvZ8sNZ܂Ƃ߂čs
+* Ԃ̃sNZׂ͂ĉ摜͈͓̔ł邱
+*
+* @param dst   Ԃ̐擪̃sNZ
+* @param count Ԃ̃sNZ
+* @param first Ԃ̐擪́AuRow, vRoẅʒũsNZ
+* @param color ZF(0-1)
+*
+* @return `悵sNZ(8̔{. [͌Ăяoŕ`悷)
+*/
+EASYLIB_TARGET_AVX2 int DrawSpanAVX2(uint32_t* dst, int count, int first, const SoftwareImage& image,
+  float uRow, float vRow, float dudx, float dvdx, const float* color, DX12::BlendMode blendMode)
+{
+  const __m256i zero = _mm256_setzero_si256();
+  const __m256i oneI = _mm256_set1_epi32(1);
+  const __m256i lane = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+  const __m256i maxX = _mm256_set1_epi32(static_cast<int>(image.width) - 1);
+  const __m256i maxY = _mm256_set1_epi32(static_cast<int>(image.height) - 1);
+  const __m256i stride = _mm256_set1_epi32(static_cast<int>(image.width));
+  const __m256i alphaMask = _mm256_set1_epi32(static_cast<int>(0xff000000));
+  const __m256 one = _mm256_set1_ps(1.0f);
+  const __m256 half = _mm256_set1_ps(0.5f);
+  const __m256 u0 = _mm256_set1_ps(uRow);
+  const __m256 v0 = _mm256_set1_ps(vRow);
+  const __m256 du = _mm256_set1_ps(dudx);
+  const __m256 dv = _mm256_set1_ps(dvdx);
+  const __m256 tint = _mm256_setr_ps(color[0], color[1], color[2], color[3], color[0], color[1], color[2], color[3]);
+  const int* base = reinterpret_cast<const int*>(image.pixels.data());
+  // SɓȂ獇ĂςȂ(Z͏)
+  const bool skipTransparent = blendMode != DX12::BlendMode::Subtraction && blendMode != DX12::BlendMode::Opaque;
+
+  int i = 0;
+  for (; i + 8 <= count; i += 8) {
+    const __m256 k = _mm256_cvtepi32_ps(_mm256_add_epi32(_mm256_set1_epi32(first + i), lane));
+    const __m256 fx = _mm256_sub_ps(_mm256_add_ps(u0, _mm256_mul_ps(du, k)), half);
+    const __m256 fy = _mm256_sub_ps(_mm256_add_ps(v0, _mm256_mul_ps(dv, k)), half);
+    // GetBilinearTapsƓA-1ȏ̒lł邱Ƃ𗘗pĐ؂̂Ă
+    const __m256i ix = _mm256_sub_epi32(_mm256_cvttps_epi32(_mm256_add_ps(fx, one)), oneI);
+    const __m256i iy = _mm256_sub_epi32(_mm256_cvttps_epi32(_mm256_add_ps(fy, one)), oneI);
+    const __m256i x0 = _mm256_min_epi32(_mm256_max_epi32(ix, zero), maxX);
+    const __m256i x1 = _mm256_min_epi32(_mm256_max_epi32(_mm256_add_epi32(ix, oneI), zero), maxX);
+    const __m256i row0 = _mm256_mullo_epi32(_mm256_min_epi32(_mm256_max_epi32(iy, zero), maxY), stride);
+    const __m256i row1 = _mm256_mullo_epi32(
+      _mm256_min_epi32(_mm256_max_epi32(_mm256_add_epi32(iy, oneI), zero), maxY), stride);
+    const __m256i p00 = _mm256_i32gather_epi32(base, _mm256_add_epi32(row0, x0), 4);
+    const __m256i p10 = _mm256_i32gather_epi32(base, _mm256_add_epi32(row0, x1), 4);
+    const __m256i p01 = _mm256_i32gather_epi32(base, _mm256_add_epi32(row1, x0), 4);
+    const __m256i p11 = _mm256_i32gather_epi32(base, _mm256_add_epi32(row1, x1), 4);
+    if (skipTransparent && _mm256_testz_si256(
+      _mm256_or_si256(_mm256_or_si256(p00, p10), _mm256_or_si256(p01, p11)), alphaMask)) {
+      continue;
+    }
+
+    __m256i axLo, axHi, ayLo, ayHi;
+    SpreadWeights(_mm256_sub_ps(fx, _mm256_cvtepi32_ps(ix)), axLo, axHi);
+    SpreadWeights(_mm256_sub_ps(fy, _mm256_cvtepi32_ps(iy)), ayLo, ayHi);
+    // cɕԂĂ牡ɕԂ(SampleƓ)
+    const __m256i cLo = Lerp16(
+      Lerp16(_mm256_unpacklo_epi8(p00, zero), _mm256_unpacklo_epi8(p01, zero), ayLo),
+      Lerp16(_mm256_unpacklo_epi8(p10, zero), _mm256_unpacklo_epi8(p11, zero), ayLo), axLo);
+    const __m256i cHi = Lerp16(
+      Lerp16(_mm256_unpackhi_epi8(p00, zero), _mm256_unpackhi_epi8(p01, zero), ayHi),
+      Lerp16(_mm256_unpackhi_epi8(p10, zero), _mm256_unpackhi_epi8(p11, zero), ayHi), axHi);
+
+    // r0..r3͂ꂼsNZ(0 | 4), (1 | 5), (2 | 6), (3 | 7)ŁApackŌ̕тɖ߂
+    const __m256i d = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dst + i));
+    const __m256i dLo = _mm256_unpacklo_epi8(d, zero);
+    const __m256i dHi = _mm256_unpackhi_epi8(d, zero);
+    const __m256i r0 = Blend2(ToFloat(cLo, false), ToFloat(dLo, false), tint, blendMode);
+    const __m256i r1 = Blend2(ToFloat(cLo, true), ToFloat(dLo, true), tint, blendMode);
+    const __m256i r2 = Blend2(ToFloat(cHi, false), ToFloat(dHi, false), tint, blendMode);
+    const __m256i r3 = Blend2(ToFloat(cHi, true), ToFloat(dHi, true), tint, blendMode);
+    const __m256i result = _mm256_packus_epi16(_mm256_packs_epi32(r0, r1), _mm256_packs_epi32(r2, r3));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), result);
+  }
+  return i;
+}
+#endif // EASYLIB_X86_SIMD
+
+} // unnamed namespace
+
+/**
+* .fntt@C當̔zuǂݍ
+*
+* FontRenderer::LoadFromFileƓ`ɑΉ
+*
+* @param filename t@C
+*
+* @retval true  ǂݍݐ
+* @retval false ǂݍݎs
+*/
+bool SoftwareFont::LoadFromFile(const char* filename)
+{
+  const std::unique_ptr<FILE, decltype(&fclose)> fp(fopen(filename, "r"), fclose);
+  if (!fp) {
+    return false;
+  }
+
+  float fontSize;
+  int paddingUp, paddingDown;
+  int ret = fscanf(fp.get(), "info face=%*s size=%f bold=%*d italic=%*d charset=%*s"
+    " unicode=%*d stretchH=%*d smooth=%*d aa=%*d padding=%d,%d,%d,%d spacing=%*d,%*d",
+    &fontSize, &paddingUp, &paddingRight, &paddingDown, &paddingLeft);
+  if (ret < 5) {
+    return false;
+  }
+  fontHeight = fontSize + static_cast<float>(paddingUp + paddingDown + 4); // FontRendererƓ]
+
+  ret = fscanf(fp.get(), " common lineHeight=%*d base=%*d scaleW=%*f scaleH=%*f pages=%*d packed=%*d");
+
+  pageFiles.clear();
+  for (;;) {
+    char tex[128];
+    ret = fscanf(fp.get(), " page id=%*d file=%127s", tex);
+    if (ret < 1) {
+      break;
+    }
+    std::string name = tex + 1; // Óu"v菜
+    name.pop_back();
+    pageFiles.push_back(name);
+  }
+  if (pageFiles.empty()) {
+    return false;
+  }
+
+  int charCount;
+  ret = fscanf(fp.get(), " chars count=%d", &charCount);
+  if (ret < 1) {
+    return false;
+  }
+
+  glyphs.assign(65536, Glyph());
+  fixedAdvance = 0;
+  for (int i = 0; i < charCount; ++i) {
+    int id;
+    Glyph glyph;
+    ret = fscanf(fp.get(), " char id=%d x=%f y=%f width=%f height=%f xoffset=%f yoffset=%f xadvance=%f page=%d chnl=%*d",
+      &id, &glyph.x, &glyph.y, &glyph.width, &glyph.height, &glyph.offsetX, &glyph.offsetY, &glyph.xadvance, &glyph.page);
+    if (ret < 8) {
+      return false;
+    }
+    if (ret < 9) {
+      glyph.page = 0;
+    }
+    if (id >= 0 && id < 65536) {
+      glyph.valid = true;
+      glyphs[id] = glyph;
+      fixedAdvance = std::max(fixedAdvance, glyph.xadvance);
+    }
+  }
+  return true;
+}
+
+/**
+* \tgEFA_[
+*
+* @param width      t[obt@̕
+* @param height     t[obt@̍
+* @param workerPool ^C̕`ɎgƗpXbh(nullptrȂĂяoXbhŕ`悷)
+*/
+bool SoftwareRenderer::Initialize(uint32_t width, uint32_t height, WorkerPool* workerPool)
+{
+  if (width == 0 || height == 0) {
+    return false;
+  }
+  this->width = width;
+  this->height = height;
+  this->workerPool = workerPool;
+  tileCountX = (width + tileSize - 1) / tileSize;
+  tileCountY = (height + tileSize - 1) / tileSize;
+  pixels.assign(static_cast<size_t>(width) * height, 0);
+  tileBins.assign(static_cast<size_t>(tileCountX) * tileCountY, {});
+  tilePixelCounts.assign(tileBins.size(), 0);
+  return true;
+}
+
+/**
+* eNX`nhɑΉ摜ݒ肷
+*
+* @param handle eNX`nh
+* @param width  摜̕
+* @param height 摜̍
+* @param pixels f(RGBA8)
+*/
+void SoftwareRenderer::SetImage(DX12::TextureHandle handle, uint32_t width, uint32_t height, const uint32_t* pixels)
+{
+  SoftwareImage& image = images[handle];
+  image.width = width;
+  image.height = height;
+  image.pixels.assign(pixels, pixels + static_cast<size_t>(width) * height);
+}
+
+/**
+* eNX`nhɑΉ摜폜
+*/
+void SoftwareRenderer::RemoveImage(DX12::TextureHandle handle)
+{
+  images.erase(handle);
+}
+
+/**
+* t[obt@w肵FœhԂ
+*
+* @param color RGBA8
+*/
+void SoftwareRenderer::Clear(uint32_t color)
+{
+  std::fill(pixels.begin(), pixels.end(), color);
+}
+
+/**
+* XvCgƕ`悷
+*
+* XvCgSpriteRendererƓŕ`悵A͂̌ɕ`悷
+*
+* @param pSprite     XvCgz
+* @param spriteCount XvCgz̒
+* @param pText       z
+* @param textCount   z̒
+*/
+void SoftwareRenderer::Draw(const DX12::Sprite* pSprite, size_t spriteCount, const DX12::Text* pText, size_t textCount)
+{
+  const auto frameBegin = std::chrono::steady_clock::now();
+  statistics = {};
+
+  // `揇ɕׂāA^CɐU蕪
+  primitives.clear();
+  for (auto& e : tileBins) {
+    e.clear();
+  }
+  AddSprites(pSprite, spriteCount);
+  AddGlyphs(pText, textCount);
+  const auto binEnd = std::chrono::steady_clock::now();
+
+  // ^CƂɕ`悷. ^C͏dȂȂ̂ŁAXbhԂœKv͂Ȃ
+  const size_t tileCount = tileBins.size();
+  if (workerPool) {
+    workerPool->Run(tileCount, [this](size_t i) { DrawTile(i); });
+  } else {
+    for (size_t i = 0; i < tileCount; ++i) {
+      DrawTile(i);
+    }
+  }
+  for (uint64_t n : tilePixelCounts) {
+    statistics.pixelCount += n;
+  }
+
+  const auto frameEnd = std::chrono::steady_clock::now();
+  statistics.binNanoseconds = static_cast<uint64_t>(
+    std::chrono::duration_cast<std::chrono::nanoseconds>(binEnd - frameBegin).count());
+  statistics.frameNanoseconds = static_cast<uint64_t>(
+    std::chrono::duration_cast<std::chrono::nanoseconds>(frameEnd - frameBegin).count());
+}
+
+/**
+* XvCg`揇ɕׂăv~eBuɂ
+*/
+void SoftwareRenderer::AddSprites(const DX12::Sprite* pSprite, size_t count)
+{
+  // SortByTexturegȂꍇSpriteRendererƓL[
+  sortKeys.resize(count);
+  for (size_t i = 0; i < count; ++i) {
+    const DX12::Sprite& sprite = pSprite[i];
+    sortKeys[i] = DX12::SpriteSortKey::Make(sprite.layer, DX12::SpriteSortKey::FromDepth(sprite.position.z), 0, 0, i);
+  }
+  sorter.Sort(sortKeys.data(), count);
+  const uint32_t* order = sorter.GetOrder();
+
+  for (size_t i = 0; i < count; ++i) {
+    const DX12::Sprite& sprite = pSprite[order[i]];
+    auto itr = images.find(sprite.texture);
+    if (itr == images.end() || itr->second.pixels.empty()) {
+      ++statistics.invalidImageCount;
+      continue;
+    }
+    const SoftwareImage& image = itr->second;
+    const float sx = sprite.scale.x;
+    const float sy = sprite.scale.y;
+    if (sx == 0 || sy == 0) {
+      continue;
+    }
+
+    // VF[_Y̍Wŉ]̂ŁAʍW(Y)ł
+    //   u = W * ( ( c * (X - px) + s * (py - Y)) / sx + 0.5)
+    //   v = H * (-(-s * (X - px) + c * (py - Y)) / sy + 0.5)
+    // ƂȂ. X, ŸꎟƂĎĂ
+    const float c = cosf(sprite.rotation);
+    const float s = sinf(sprite.rotation);
+    const float px = sprite.position.x;
+    const float py = sprite.position.y;
+    const float w = static_cast<float>(image.width);
+    const float h = static_cast<float>(image.height);
+    Primitive prim;
+    prim.dudx = w * c / sx;
+    prim.dudy = -w * s / sx;
+    prim.u0 = w * ((-c * px + s * py) / sx + 0.5f);
+    prim.dvdx = h * s / sy;
+    prim.dvdy = h * c / sy;
+    prim.v0 = h * (0.5f - (s * px + c * py) / sy);
+    prim.umin = 0;
+    prim.vmin = 0;
+    prim.umax = w;
+    prim.vmax = h;
+    prim.image = &image;
+    prim.color[0] = sprite.color.x;
+    prim.color[1] = sprite.color.y;
+    prim.color[2] = sprite.color.z;
+    prim.color[3] = sprite.color.w;
+    prim.blendMode = sprite.blendMode;
+    prim.isGlyph = false;
+
+    const float ex = fabsf(c) * fabsf(sx) * 0.5f + fabsf(s) * fabsf(sy) * 0.5f;
+    const float ey = fabsf(s) * fabsf(sx) * 0.5f + fabsf(c) * fabsf(sy) * 0.5f;
+    AddPrimitive(prim, px - ex, py - ey, px + ex, py + ey);
+    ++statistics.spriteCount;
+  }
+}
+
+/**
+* FontRendererƓ悤ɔzuăv~eBuɂ
+*/
+void SoftwareRenderer::AddGlyphs(const DX12::Text* pText, size_t count)
+{
+  if (!font || font->glyphs.empty()) {
+    return;
+  }
+  for (size_t i = 0; i < count; ++i) {
+    const DX12::Text& text = pText[i];
+    XMFLOAT2 pos = text.position;
+    const char* const end = text.text.data() + text.text.size();
+    for (const char* itr = text.text.data(); itr < end && *itr;) {
+      const size_t code = static_cast<size_t>(DecodeUtf8(itr, end));
+      if (code == '\n') {
+        pos.x = text.position.x;
+        pos.y -= font->fontHeight * text.scale.y;
+      }
+      if (code >= font->glyphs.size()) {
+        continue;
+      }
+      const SoftwareFont::Glyph& glyph = font->glyphs[code];
+      if (glyph.valid && glyph.width && glyph.height &&
+        glyph.page >= 0 && static_cast<size_t>(glyph.page) < font->pages.size()) {
+        // VF[_ƓAʏ̏[y[W摜̏̕[ɑΉ
+        const float left = pos.x + glyph.offsetX * text.scale.x;
+        const float top = pos.y - (glyph.offsetY + glyph.height) * text.scale.y;
+        Primitive prim;
+        prim.dudx = 1.0f / text.scale.x;
+        prim.dudy = 0;
+        prim.u0 = glyph.x - left / text.scale.x;
+        prim.dvdx = 0;
+        prim.dvdy = 1.0f / text.scale.y;
+        prim.v0 = glyph.y - top / text.scale.y;
+        prim.umin = glyph.x;
+        prim.vmin = glyph.y;
+        prim.umax = glyph.x + glyph.width;
+        prim.vmax = glyph.y + glyph.height;
+        prim.image = &font->pages[glyph.page];
+        prim.color[0] = text.color.x;
+        prim.color[1] = text.color.y;
+        prim.color[2] = text.color.z;
+        prim.color[3] = text.color.w;
+        prim.blendMode = DX12::BlendMode::Multiply;
+        prim.isGlyph = true;
+        AddPrimitive(prim, left, top,
+          left + glyph.width * text.scale.x, top + glyph.height * text.scale.y);
+        ++statistics.glyphCount;
+      }
+      pos.x += ((font->propotional ? glyph.xadvance : font->fixedAdvance) +
+        static_cast<float>(font->paddingRight + font->paddingLeft)) * text.scale.x;
+    }
+  }
+}
+
+/**
+* v~eBuǉAdȂ^CɐU蕪
+*
+* @param prim   ǉv~eBu
+* @param left   ʏ͈̔͂̍[
+* @param top    ʏ͈̔͂̏[
+* @param right  ʏ͈̔͂̉E[
+* @param bottom ʏ͈̔͂̉[
+*/
+void SoftwareRenderer::AddPrimitive(Primitive& prim, float left, float top, float right, float bottom)
+{
+  // sNZ̒S͈͂ɓ̂`悷
+  const float maxX = static_cast<float>(width);
+  const float maxY = static_cast<float>(height);
+  prim.x0 = static_cast<int>(ceilf(std::min(std::max(left - 0.5f, 0.0f), maxX)));
+  prim.y0 = static_cast<int>(ceilf(std::min(std::max(top - 0.5f, 0.0f), maxY)));
+  prim.x1 = static_cast<int>(ceilf(std::min(std::max(right - 0.5f, 0.0f), maxX)));
+  prim.y1 = static_cast<int>(ceilf(std::min(std::max(bottom - 0.5f, 0.0f), maxY)));
+  if (prim.x0 >= prim.x1 || prim.y0 >= prim.y1) {
+    return;
+  }
+
+  const uint32_t index = static_cast<uint32_t>(primitives.size());
+  primitives.push_back(prim);
+  const uint32_t tx0 = prim.x0 / tileSize;
+  const uint32_t ty0 = prim.y0 / tileSize;
+  const uint32_t tx1 = (prim.x1 - 1) / tileSize;
+  const uint32_t ty1 = (prim.y1 - 1) / tileSize;
+  for (uint32_t ty = ty0; ty <= ty1; ++ty) {
+    for (uint32_t tx = tx0; tx <= tx1; ++tx) {
+      tileBins[ty * tileCountX + tx].push_back(index);
+    }
+  }
+}
+
+/**
+* ^CɐU蕪ꂽv~eBu`揇ɕ`悷
+*
+* @param tileIndex ^Cԍ
+*/
+void SoftwareRenderer::DrawTile(size_t tileIndex)
+{
+  const int tileX0 = static_cast<int>(tileIndex % tileCountX) * tileSize;
+  const int tileY0 = static_cast<int>(tileIndex / tileCountX) * tileSize;
+  const int tileX1 = std::min(tileX0 + tileSize, static_cast<int>(width));
+  const int tileY1 = std::min(tileY0 + tileSize, static_cast<int>(height));
+  uint64_t pixelCount = 0;
+#ifdef EASYLIB_X86_SIMD
+  static const bool hasAVX2 = HasAVX2();
+#endif // EASYLIB_X86_SIMD
+
+  for (uint32_t primIndex : tileBins[tileIndex]) {
+    const Primitive& prim = primitives[primIndex];
+    const SoftwareImage& image = *prim.image;
+    const int x0 = std::max(prim.x0, tileX0);
+    const int x1 = std::min(prim.x1, tileX1);
+    const int y0 = std::max(prim.y0, tileY0);
+    const int y1 = std::min(prim.y1, tileY1);
+
+    // ̐F̓VF[_ƓtB[hvZ
+    const float smoothing = 1.0f / 16.0f;
+    const float thickness = font ? 1.0f - font->thickness : 0.5f;
+    const float outline = font ? font->border : 0.25f;
+    const XMFLOAT4 subColor = font ? font->subColor : XMFLOAT4(0, 0, 0, 1);
+
+    for (int y = y0; y < y1; ++y) {
+      uint32_t* dst = pixels.data() + static_cast<size_t>(y) * width;
+      const float fy = static_cast<float>(y) + 0.5f;
+      const float uRow = prim.u0 + prim.dudx * (static_cast<float>(x0) + 0.5f) + prim.dudy * fy;
+      const float vRow = prim.v0 + prim.dvdx * (static_cast<float>(x0) + 0.5f) + prim.dvdy * fy;
+
+      // ]ĂƔ͈͂̎l͉摜̊OȂ̂ŁA摜ɓԂɋ߂Ă
+      float spanBegin = 0;
+      float spanEnd = static_cast<float>(x1 - x0);
+      const auto clip = [&spanBegin, &spanEnd](float value, float delta, float minValue, float maxValue) {
+        if (delta > 0) {
+          spanBegin = std::max(spanBegin, (minValue - value) / delta - 1.0f);
+          spanEnd = std::min(spanEnd, (maxValue - value) / delta + 1.0f);
+        } else if (delta < 0) {
+          spanBegin = std::max(spanBegin, (maxValue - value) / delta - 1.0f);
+          spanEnd = std::min(spanEnd, (minValue - value) / delta + 1.0f);
+        } else if (value < minValue || value >= maxValue) {
+          spanEnd = -1;
+        }
+      };
+      clip(uRow, prim.dudx, prim.umin, prim.umax);
+      clip(vRow, prim.dvdx, prim.vmin, prim.vmax);
+      if (spanBegin >= spanEnd) {
+        continue;
+      }
+      // ߂Ԃ͌덷ōL߂Ȃ̂ŁA[摜ɓȂsNZ
+      // uvẍꎟȂ̂ŁA摜ɓsNZ͘AĂāAԂ̒ł͔肵ȂĂ悢
+      const auto isInside = [&](int x) {
+        const float u = uRow + prim.dudx * static_cast<float>(x - x0);
+        const float v = vRow + prim.dvdx * static_cast<float>(x - x0);
+        return u >= prim.umin && u < prim.umax && v >= prim.vmin && v < prim.vmax;
+      };
+      int xBegin = x0 + static_cast<int>(spanBegin);
+      int xEnd = std::min(x0 + static_cast<int>(spanEnd) + 1, x1);
+      while (xBegin < xEnd && !isInside(xBegin)) {
+        ++xBegin;
+      }
+      while (xEnd > xBegin && !isInside(xEnd - 1)) {
+        --xEnd;
+      }
+      pixelCount += static_cast<uint64_t>(std::max(xEnd - xBegin, 0));
+
+      int x = xBegin;
+#ifdef EASYLIB_X86_SIMD
+      if (!prim.isGlyph && hasAVX2) {
+        x += DrawSpanAVX2(dst + xBegin, xEnd - xBegin, xBegin - x0, image,
+          uRow, vRow, prim.dudx, prim.dvdx, prim.color, prim.blendMode);
+      }
+#endif // EASYLIB_X86_SIMD
+      for (; x < xEnd; ++x) {
+        const float u = uRow + prim.dudx * static_cast<float>(x - x0);
+        const float v = vRow + prim.dvdx * static_cast<float>(x - x0);
+        const BilinearTaps taps = GetBilinearTaps(image, u, v);
+        if (!prim.isGlyph) {
+          // SɓȂ獇ĂςȂ(Z͏)
+          const bool transparent = ((taps.p00 | taps.p10 | taps.p01 | taps.p11) >> 24) == 0 &&
+            prim.blendMode != DX12::BlendMode::Subtraction && prim.blendMode != DX12::BlendMode::Opaque;
+          if (!transparent) {
+#ifdef EASYLIB_SOFTWARE_SIMD
+            const __m128 tint = _mm_loadu_ps(prim.color);
+            Blend(dst[x], _mm_mul_ps(Sample(taps), tint), prim.blendMode);
+#else
+            Color4 c = Sample(taps);
+            for (int i = 0; i < 4; ++i) {
+              c.v[i] *= prim.color[i];
+            }
+            Blend(dst[x], c, prim.blendMode);
+#endif // EASYLIB_SOFTWARE_SIMD
+          }
+        } else {
+#ifdef EASYLIB_SOFTWARE_SIMD
+          float sampled[4];
+          _mm_storeu_ps(sampled, Sample(taps));
+          const float distance = sampled[0] * (1.0f / 255.0f);
+#else
+          const float distance = Sample(taps).v[0] * (1.0f / 255.0f);
+#endif // EASYLIB_SOFTWARE_SIMD
+          const float t = SmoothStep(thickness - smoothing, thickness + smoothing, distance);
+          const float alpha = SmoothStep(outline - smoothing, outline + smoothing, distance);
+          float color[4] = {
+            (subColor.x + (prim.color[0] - subColor.x) * t) * 255.0f,
+            (subColor.y + (prim.color[1] - subColor.y) * t) * 255.0f,
+            (subColor.z + (prim.color[2] - subColor.z) * t) * 255.0f,
+            std::min(std::max((subColor.w + (prim.color[3] - subColor.w) * t) * alpha, 0.0f), 1.0f) * 255.0f,
+          };
+#ifdef EASYLIB_SOFTWARE_SIMD
+          Blend(dst[x], _mm_loadu_ps(color), prim.blendMode);
+#else
+          Blend(dst[x], Color4{ { color[0], color[1], color[2], color[3] } }, prim.blendMode);
+#endif // EASYLIB_SOFTWARE_SIMD
+        }
+      }
+    }
+  }
+  tilePixelCounts[tileIndex] = pixelCount;
+}
+
+} // namespace EasyLib
@@ -0,0 +1,148 @@
+/**
+* @file SoftwareRenderer.h
+*/
+#ifndef EASYLIB_SOFTWARERENDERER_H
+#define EASYLIB_SOFTWARERENDERER_H
+#include "DrawData.h"
+#include "SpriteSort.h"
+#include "WorkerPool.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace EasyLib {
+
+/**
+* CPUň摜
+*
+* fRGBA8(ʃoCg R, G, B, A)
+*/
+struct SoftwareImage
+{
+  uint32_t width = 0;
+  uint32_t height = 0;
+  std::vector<uint32_t> pixels;
+};
+
+/**
+* CPUňtHg
+*
+* ̔zuLoadFromFileFontRendererƓ.fntt@Cǂݍ
+* y[W摜(tB[h. Rg)͓ǂݍ܂Ȃ̂ŁApageFiles̏pages֐ݒ肷邱
+*/
+struct SoftwareFont
+{
+  struct Glyph {
+    bool valid = false;
+    int page = 0;
+    float x = 0, y = 0;             // y[Ẅʒu(sNZ)
+    float width = 0, height = 0;
+    float offsetX = 0, offsetY = 0;
+    float xadvance = 0;
+  };
+  std::vector<Glyph> glyphs; // R[hY
+  std::vector<std::string> pageFiles;
+  std::vector<SoftwareImage> pages;
+  float fontHeight = 0;
+  int paddingLeft = 0;
+  int paddingRight = 0;
+  float fixedAdvance = 0;
+
+  // FontRendereȑlƓ`ݒ
+  bool propotional = true;
+  float thickness = 0.5f;
+  float border = 0.25f;
+  DirectX::XMFLOAT4 subColor = { 0.125f, 0.125f, 0.125f, 1 };
+
+  bool LoadFromFile(const char* filename);
+};
+
+/**
+* \tgEFA_[̓v
+*/
+struct SoftwareRendererStatistics
+{
+  size_t spriteCount = 0;      // `悵XvCg
+  size_t glyphCount = 0;       // `悵
+  size_t invalidImageCount = 0; // 摜ݒ肳ĂȂߕ`悵ȂXvCg
+  uint64_t pixelCount = 0;     // FvZsNZ
+  uint64_t binNanoseconds = 0; // בւƃ^Cւ̐U蕪ɂ(imb)
+  uint64_t frameNanoseconds = 0; // DrawŜɂ(imb)
+};
+
+/**
+* CPUŃXvCgƕ`悷NX
+*
+* SpriteRendererAFontRendererƓSpriteATextz󂯎ARGBA8̃t[obt@ɕ`悷
+* `揇AWnAuh[hA̔zuGPUłɍ킹Ă
+* ʂ^CɕāA^CƂɍƗpXbhŕ`悷
+* oCjATvOƍ́A1sNZ4vf܂Ƃ߂SIMDŌvZ
+* D3D12ɈˑȂ̂ŁAGPÛȂł̉摜reXgx`}[NɎg
+*/
+class SoftwareRenderer
+{
+public:
+  static constexpr int tileSize = 64;
+
+  SoftwareRenderer() = default;
+  ~SoftwareRenderer() = default;
+  SoftwareRenderer(const SoftwareRenderer&) = delete;
+  SoftwareRenderer& operator=(const SoftwareRenderer&) = delete;
+
+  bool Initialize(uint32_t width, uint32_t height, WorkerPool* workerPool);
+
+  // 摜ƕ
+  void SetImage(DX12::TextureHandle handle, uint32_t width, uint32_t height, const uint32_t* pixels);
+  void RemoveImage(DX12::TextureHandle handle);
+  void SetFont(const SoftwareFont* font) { this->font = font; }
+
+  void Clear(uint32_t color);
+  void Draw(const DX12::Sprite* pSprite, size_t spriteCount, const DX12::Text* pText, size_t textCount);
+
+  uint32_t GetWidth() const { return width; }
+  uint32_t GetHeight() const { return height; }
+  const uint32_t* GetPixels() const { return pixels.data(); }
+  const SoftwareRendererStatistics& GetStatistics() const { return statistics; }
+
+private:
+  // ʏ̕slӌ`A摜͈̔͂ɑΉt
+  struct Primitive {
+    int x0, y0, x1, y1;     // ʏ͈̔(x1, y1͊܂܂Ȃ)
+    float u0, dudx, dudy;   // ʍW摜̃sNZWւ̕ϊ
+    float v0, dvdx, dvdy;
+    float umin, vmin, umax, vmax; // `悷摜͈̔
+    const SoftwareImage* image;
+    float color[4];         // 0-1
+    DX12::BlendMode blendMode;
+    bool isGlyph;
+  };
+
+  void AddSprites(const DX12::Sprite* pSprite, size_t count);
+  void AddGlyphs(const DX12::Text* pText, size_t count);
+  void AddPrimitive(Primitive& prim, float left, float top, float right, float bottom);
+  void DrawTile(size_t tileIndex);
+
+  uint32_t width = 0;
+  uint32_t height = 0;
+  uint32_t tileCountX = 0;
+  uint32_t tileCountY = 0;
+  std::vector<uint32_t> pixels;
+  WorkerPool* workerPool = nullptr;
+
+  std::unordered_map<DX12::TextureHandle, SoftwareImage> images;
+  const SoftwareFont* font = nullptr;
+
+  DX12::SpriteSorter sorter;
+  std::vector<uint64_t> sortKeys;
+  std::vector<Primitive> primitives;
+  std::vector<std::vector<uint32_t>> tileBins; // ^CƂ́A`揇ɕׂv~eBuԍ
+  std::vector<uint64_t> tilePixelCounts;
+
+  SoftwareRendererStatistics statistics;
+};
+
+} // namespace EasyLib
+
+#endif // EASYLIB_SOFTWARERENDERER_H
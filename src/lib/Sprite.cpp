@@ -1,59 +1,60 @@
 #define NOMINMAX
 #include "Sprite.h"
 #include "Texture.h"
+#include "SpritePack.h"
 #include <d3dx12.h>
-#include <DirectXPackedVector.h>
+#include <algorithm>
+#include <chrono>
+#include <math.h>
+#include <float.h>
+#include <string.h>
 
 namespace EasyLib {
 namespace DX12 {
 
 using Microsoft::WRL::ComPtr;
 using namespace DirectX;
-using namespace DirectX::PackedVector;
 
-struct SpriteInShader
-{
-	uint32_t texID;
-  XMFLOAT3 position;
-  float rotation;
-  XMFLOAT2 scale;
-  XMFLOAT4 color;
-};
+namespace /* unnamed */ {
+
+// ^C}bṽ`N1̃f[^̑傫ƁAAbv[hobt@1ɓ`N̐
+constexpr uint64_t chunkBlockBytes = sizeof(SpriteInShader) * Tilemap::chunkSize * Tilemap::chunkSize;
+constexpr uint32_t chunkBlocksPerPage = 16;
+
+} // unnamed namespace
 
 /**
 * XvCg_[
 */
-bool SpriteRenderer::Initialize(DevicePtr device, size_t framebufferCount, size_t maxSpriteCount)
+bool SpriteRenderer::Initialize(DevicePtr device, size_t framebufferCount)
 {
 	this->framebufferCount = framebufferCount;
-	this->maxSpriteCount = maxSpriteCount;
+
+	// `ÑubŃAt[obt@̃R}hXgėp܂GPUgĂ邩Ȃ
+	chunkPool.Init(chunkBlocksPerPage, static_cast<uint32_t>(framebufferCount));
+	chunkPages.clear();
+	chunkPageAddresses.clear();
 
 	//pso = device->CreatePipelineState(L"SpriteShader.vs", L"SpriteShader.ps", vertexLayout, std::size(vertexLayout));
-	pso = device->CreatePipelineState(L"res/shader/Sprite.hlsl", L"res/shader/Sprite.hlsl",
-		BlendMode::Multiply, CullMode::None, DepthStencilMode::None, nullptr, 0);
-	if (!pso) {
-		return false;
+	// uh[hƂPSO([gVOl`ׂ͂ċ)
+	for (int i = 0; i < blendModeCount; i++) {
+		psoList[i] = device->CreatePipelineState(L"res/shader/Sprite.hlsl", L"res/shader/Sprite.hlsl",
+			static_cast<BlendMode>(i), CullMode::None, DepthStencilMode::None, nullptr, 0);
+		if (!psoList[i]) {
+			return false;
+		}
 	}
 
+	// XvCgf[^̓t[ƂɃfoCX̃Abv[hOmۂ
+	// ɋL^ł悤ɁA`NƂɃAP[^ƃR}hXg
 	for (int i = 0; i < static_cast<int>(framebufferCount); i++) {
-		wchar_t bufferName[] = L"Sprite Buffer 0";
-		bufferName[std::size(bufferName) - 1] += static_cast<wchar_t>(i);
-		commandContexts[i].spriteBuffer = device->CreateUploadResource(bufferName, sizeof(SpriteInShader) * maxSpriteCount);
-		commandContexts[i].allocator = device->CreateCommandAllocator(D3D12_COMMAND_LIST_TYPE_DIRECT);
-		commandContexts[i].list = device->CreateCommandList(D3D12_COMMAND_LIST_TYPE_DIRECT, commandContexts[i].allocator.Get());
-		commandContexts[i].heap = device->CreateDescriptorHeap(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV, 1024, true);
-
-		if (!commandContexts[i].spriteBuffer || !commandContexts[i].allocator ||
-			!commandContexts[i].list || !commandContexts[i].heap.GetHeap()) {
-			return false;
+		for (CommandContext& context : commandContexts[i]) {
+			context.allocator = device->CreateCommandAllocator(D3D12_COMMAND_LIST_TYPE_DIRECT);
+			context.list = device->CreateCommandList(D3D12_COMMAND_LIST_TYPE_DIRECT, context.allocator.Get());
+			if (!context.allocator || !context.list) {
+				return false;
+			}
 		}
-
-		// q[v0Ԗڂɂ̓XvCgobt@蓖Ă
-		// 1Ԗڈȍ~͕`掞̃eNX`fXNv^̃Rs[ƂĎg
-		D3D12_SHADER_RESOURCE_VIEW_DESC view = 
-			CD3DX12_SHADER_RESOURCE_VIEW_DESC::StructuredBuffer(static_cast<UINT>(maxSpriteCount), sizeof(SpriteInShader));
-		D3D12_CPU_DESCRIPTOR_HANDLE heapHandle = commandContexts[i].heap.GetCPUDescriptorHandle(0);
-		device->CreateShaderResourceView(commandContexts[i].spriteBuffer.Get(), &view, heapHandle);
 	}
 
 	indexBuffer = device->CreateUploadResource(L"Sprite Index Buffer", sizeof(uint16_t) * 6);
@@ -78,81 +79,801 @@ bool SpriteRenderer::Initialize(DevicePtr device, size_t framebufferCount, size_
 }
 
 /**
-* XvCgz`悷R}hXg쐬
+* XvCgz̕`揇߂
+*
+* ʊÕXvCgAeNX`ȃXvCg͎菜
+* ʂsortedOrder, textureKeys, uvRectsɊi[
+*
+* @param device       D3D12foCX
+* @param pSprite      XvCgz
+* @param count        z̒
+* @param scissorRect  JOɎg`
+* @param invalidHandleCount eNX`XvCg̐i[ϐ
+*
+* @return `悷XvCg̐
 */
-ID3D12GraphicsCommandList* SpriteRenderer::Draw(
-	DevicePtr device, const Sprite* pSprite, size_t count, const SpriteRenderingInfo& renderingInfo)
+size_t SpriteRenderer::BuildDrawOrder(const DevicePtr& device, const Sprite* pSprite, size_t count,
+	const D3D12_RECT& scissorRect, size_t& invalidHandleCount)
 {
-	count = std::min(count, maxSpriteCount);
+	// eNX`̔ԍƔ͈́Aʏ͈̔͂W߂
+	const TextureRegistry& textureRegistry = device->GetTextureRegistry();
+	textureKeys.resize(count);
+	uvRects.resize(count);
+	centerX.resize(count);
+	centerY.resize(count);
+	extentX.resize(count);
+	extentY.resize(count);
+	invalidHandleCount = 0;
+	for (size_t i = 0; i < count; i++) {
+		const Sprite& sprite = pSprite[i];
+		const TextureRegistry::Entry* e = textureRegistry.Find(sprite.texture);
+		if (!e) {
+			// o^ꂽeNX`gXvCǵAKJOʒuɒuĕ`悵Ȃ
+			textureKeys[i] = 0;
+			uvRects[i] = XMFLOAT4(0, 0, 0, 0);
+			centerX[i] = -FLT_MAX;
+			centerY[i] = -FLT_MAX;
+			extentX[i] = 0;
+			extentY[i] = 0;
+			++invalidHandleCount;
+			continue;
+		}
+		textureKeys[i] = e->texID;
+		uvRects[i] = e->uvRect;
 
-	CommandContext& context = commandContexts[renderingInfo.framebufferIndex];
+		// ]܂߂AABB̔̑傫
+		centerX[i] = sprite.position.x;
+		centerY[i] = sprite.position.y;
+		const float hx = fabsf(sprite.scale.x) * 0.5f;
+		const float hy = fabsf(sprite.scale.y) * 0.5f;
+		if (sprite.rotation == 0) {
+			extentX[i] = hx;
+			extentY[i] = hy;
+		} else {
+			const float c = fabsf(cosf(sprite.rotation));
+			const float s = fabsf(sinf(sprite.rotation));
+			extentX[i] = c * hx + s * hy;
+			extentY[i] = s * hx + c * hy;
+		}
+	}
 
-	if (count <= 0) {
-		context.allocator->Reset();
-		context.list->Reset(context.allocator.Get(), nullptr);
-		context.list->Close();
- 		return context.list.Get();
+	// VU[`ƏdȂȂXvCg菜
+	const CullRect cullRect = {
+		static_cast<float>(scissorRect.left),
+		static_cast<float>(scissorRect.top),
+		static_cast<float>(scissorRect.right),
+		static_cast<float>(scissorRect.bottom),
+	};
+	visibleOrder.resize(count);
+	const size_t visibleCount = CullSprites(centerX.data(), centerY.data(), extentX.data(), extentY.data(),
+		count, cullRect, visibleOrder.data());
+
+	// cXvCg̃\[gL[ĕבւ
+	// eNX`ł܂Ƃ߂ȂꍇAC[Ɛ[x̒ł͕`wɂȂ
+	sortKeys.resize(visibleCount);
+	for (size_t i = 0; i < visibleCount; i++) {
+		const Sprite& sprite = pSprite[visibleOrder[i]];
+		const uint32_t blend = sortByTexture ? static_cast<uint32_t>(sprite.blendMode) : 0;
+		const uint32_t texture = sortByTexture ? textureKeys[visibleOrder[i]] : 0;
+		sortKeys[i] = SpriteSortKey::Make(sprite.layer, SpriteSortKey::FromDepth(sprite.position.z),
+			blend, texture, i);
+	}
+	sorter.Sort(sortKeys.data(), visibleCount);
+	const uint32_t* sorted = sorter.GetOrder();
+	sortedOrder.resize(visibleCount);
+	for (size_t i = 0; i < visibleCount; i++) {
+		sortedOrder[i] = visibleOrder[sorted[i]];
 	}
+	return visibleCount;
+}
 
-	void* pTmp;
-	const D3D12_RANGE range = { 0, 0 };
-	context.spriteBuffer->Map(0, &range, &pTmp);
-
-	uint32_t texCount = 0;
-	TexturePtr lastTexture;
-	SpriteInShader* p = static_cast<SpriteInShader*>(pTmp);
-	for (uint32_t i = 0; i < count; i++) {
-		// eNX`ςeNX`ǉ
-		if (lastTexture != pSprite[i].texture) {
-			lastTexture = pSprite[i].texture;
-			D3D12_CPU_DESCRIPTOR_HANDLE handle = context.heap.GetCPUDescriptorHandle(texCount + 1);
-			device->CopyDescriptors(1, handle, pSprite[i].texture->GetCPUHandle(), D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-			texCount++;
-		}
-		p[i].texID = texCount - 1;
-		p[i].position = pSprite[i].position;
-		p[i].position.y = renderingInfo.viewport.Height - p[i].position.y;
-		p[i].rotation = pSprite[i].rotation;
-		p[i].scale = pSprite[i].scale;
-		p[i].color = pSprite[i].color;
-	}
-	device->SetDescriptorsToNull(1023 - texCount, context.heap.GetCPUDescriptorHandle(texCount + 1));
-
-	context.spriteBuffer->Unmap(0, nullptr);
-	curSpriteCount = count;
-
-	context.allocator->Reset();
-	context.list->Reset(context.allocator.Get(), nullptr);
-
-	context.list->SetPipelineState(pso->GetPipelineStateObject());
-	context.list->SetGraphicsRootSignature(pso->GetRootSignature());
-  context.list->OMSetRenderTargets(1, &renderingInfo.handleRTV, FALSE, &renderingInfo.handleDSV);
-  context.list->RSSetViewports(1, &renderingInfo.viewport);
-  context.list->RSSetScissorRects(1, &renderingInfo.scissorRect);
-
-	context.list->IASetIndexBuffer(&viewIB);
-	context.list->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
-	ID3D12DescriptorHeap* heapList[] = { context.heap.GetHeap() };
-	context.list->SetDescriptorHeaps(_countof(heapList), heapList);
+/**
+* uh[hXvCg̕т𒲂ׂ
+*
+* @param pSprite XvCgz
+* @param order   `揇
+* @param count   `悷XvCg̐
+* @param runs    ʂi[z
+*/
+void SpriteRenderer::BuildRuns(const Sprite* pSprite, const uint32_t* order, size_t count, std::vector<DrawRun>& runs)
+{
+	runs.clear();
+	for (size_t start = 0; start < count;) {
+		const BlendMode blendMode = pSprite[order[start]].blendMode;
+		size_t end = start + 1;
+		while (end < count && pSprite[order[end]].blendMode == blendMode) {
+			++end;
+		}
+		runs.push_back({ blendMode, static_cast<uint32_t>(start), static_cast<uint32_t>(end - start) });
+		start = end;
+	}
+}
+
+/**
+* R}hXgɋʂ̕`ݒs
+*
+* @param list          R}hXg
+* @param device        D3D12foCX
+* @param renderingInfo `ɕKvȊe
+*/
+void SpriteRenderer::SetupCommandList(ID3D12GraphicsCommandList* list, const DevicePtr& device,
+	const SpriteRenderingInfo& renderingInfo) const
+{
+	list->SetGraphicsRootSignature(psoList[0]->GetRootSignature());
+	list->OMSetRenderTargets(1, &renderingInfo.handleRTV, FALSE, &renderingInfo.handleDSV);
+	list->RSSetViewports(1, &renderingInfo.viewport);
+	list->RSSetScissorRects(1, &renderingInfo.scissorRect);
+
+	list->IASetIndexBuffer(&viewIB);
+	list->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+	const DescriptorHeap& heap = device->GetBindlessHeap();
+	ID3D12DescriptorHeap* heapList[] = { heap.GetHeap() };
+	list->SetDescriptorHeaps(_countof(heapList), heapList);
 
 	// [gp[^0: r[vWFNVs
 	// NOTE: DirectXMath ͍sW[A HLSL ͗񃁃W[AȂ̂ŁA]uKv
 	// https://stackoverflow.com/questions/41405994/hlsl-mul-and-d3dxmatrix-order-mismatch
 	const XMMATRIX matInvVP = XMMatrixTranspose(renderingInfo.matViewProjection);
-	context.list->SetGraphicsRoot32BitConstants(0, 16, &matInvVP, 0);
+	list->SetGraphicsRoot32BitConstants(0, 16, &matInvVP, 0);
+
+	// [gp[^2: eNX`(q[vS)
+	list->SetGraphicsRootDescriptorTable(2, heap.GetGPUDescriptorHandle(0));
+}
+
+/**
+* XvCg̕т`悷R}hǉ
+*
+* SV_InstanceID͊JnCX^X܂܂Ȃ̂ŁAXvCgf[^̃AhX炵Ďw肷
+*
+* @param list    R}hXg
+* @param address XvCgf[^̐擪AhX
+* @param runs    `悷XvCg̕
+*
+* @return ǉ`R}h̐
+*/
+size_t SpriteRenderer::RecordRuns(ID3D12GraphicsCommandList* list,
+	D3D12_GPU_VIRTUAL_ADDRESS address, const std::vector<DrawRun>& runs) const
+{
+	for (const DrawRun& run : runs) {
+		list->SetPipelineState(psoList[static_cast<int>(run.blendMode)]->GetPipelineStateObject());
+
+		// [gp[^1: XvCgf[^
+		list->SetGraphicsRootShaderResourceView(1, address + sizeof(SpriteInShader) * run.start);
+
+		list->DrawIndexedInstanced(6, run.count, 0, 0, 0);
+	}
+	return runs.size();
+}
+
+/**
+* ÓIC[쐬
+*
+* XvCgϊf[^p̃obt@ɕۑA
+* 蒼j܂ŁAt[̕ϊƃAbv[hȗĕ`ł悤ɂ
+* łɓԍ̃C[΍蒼
+*
+* @param device        D3D12foCX
+* @param id            C[ԍ
+* @param pSprite       XvCgz
+* @param count         z̒
+* @param viewport      `Ɏgr[|[g
+* @param scissorRect   `ɎgVU[`
+*
+* @retval true  쐬
+* @retval false 쐬s
+*/
+bool SpriteRenderer::BuildStaticLayer(DevicePtr device, int id, const Sprite* pSprite, size_t count,
+	const D3D12_VIEWPORT& viewport, const D3D12_RECT& scissorRect)
+{
+	ReleaseStaticLayer(device, id);
+
+	size_t invalidHandleCount;
+	const size_t visibleCount = BuildDrawOrder(device, pSprite, count, scissorRect, invalidHandleCount);
+
+	StaticLayer& layer = staticLayers[id];
+	layer.count = visibleCount;
+	if (visibleCount == 0) {
+		return true;
+	}
 
-	// [gp[^1: XvCgf[^
-	context.list->SetGraphicsRootDescriptorTable(1, context.heap.GetGPUDescriptorHandle(0));
+	const size_t bytes = sizeof(SpriteInShader) * visibleCount;
+	layer.buffer = device->CreateUploadResource(L"Sprite Static Layer", bytes);
+	if (!layer.buffer) {
+		staticLayers.erase(id);
+		return false;
+	}
+	void* p;
+	const D3D12_RANGE range = { 0, 0 };
+	layer.buffer->Map(0, &range, &p);
+	PackSprites(pSprite, sortedOrder.data(), textureKeys.data(), uvRects.data(), visibleCount,
+		viewport.Height, static_cast<SpriteInShader*>(p));
+	layer.buffer->Unmap(0, nullptr);
+	BuildRuns(pSprite, sortedOrder.data(), visibleCount, layer.runs);
+	return true;
+}
 
-	// [gp[^2: eNX`
-	context.list->SetGraphicsRootDescriptorTable(2, context.heap.GetGPUDescriptorHandle(1));
+/**
+* ÓIC[j
+*
+* obt@GPUgIĂj
+*
+* @param device D3D12foCX
+* @param id     C[ԍ
+*/
+void SpriteRenderer::ReleaseStaticLayer(DevicePtr device, int id)
+{
+	auto itr = staticLayers.find(id);
+	if (itr != staticLayers.end()) {
+		device->GetUploadRing().DeferRelease(std::move(itr->second.buffer));
+		staticLayers.erase(itr);
+	}
+}
 
-	context.list->DrawIndexedInstanced(6, static_cast<UINT>(count), 0, 0, 0);
+/**
+* DrawŐÓIC[`悷
+*
+* ÓIC[́Ao^ɁADrawɓnXvCgɕ`悳
+*
+* @param id C[ԍ
+*
+* @retval true  o^
+* @retval false C[݂Ȃ
+*/
+bool SpriteRenderer::SubmitStaticLayer(int id)
+{
+	if (staticLayers.find(id) == staticLayers.end()) {
+		return false;
+	}
+	submittedLayers.push_back(id);
+	return true;
+}
 
-  context.list->Close();
- 	return context.list.Get();
+/**
+* DrawŃp[eBN`悷
+*
+* p[eBNDraw̎_̏Ԃŕ`悳̂ŁADrawI܂UpdateȂ
+*
+* @param particles p[eBN
+* @param blendMode uh[h
+*/
+void SpriteRenderer::SubmitParticles(const ParticleSystem& particles, BlendMode blendMode)
+{
+	particleBatches.push_back({ &particles, blendMode, 0, 0, 0 });
+}
+
+/**
+* p[eBN̉摜\ϊAf[^uʒu߂
+*
+* @param device D3D12foCX
+*
+* @return `悷p[eBN̑
+*/
+size_t SpriteRenderer::PrepareParticles(const DevicePtr& device)
+{
+	const TextureRegistry& textureRegistry = device->GetTextureRegistry();
+	particleTexIDs.clear();
+	particleUVRects.clear();
+	particleWidths.clear();
+	particleHeights.clear();
+	size_t total = 0;
+	for (ParticleBatch& batch : particleBatches) {
+		batch.count = batch.particles->GetCount();
+		batch.imageOffset = particleTexIDs.size();
+		batch.start = total;
+		total += batch.count;
+
+		// 摜\͏̂ŁAeNX`̌̓p[eBNƂł͂Ȃ摜Ƃɍs
+		const uint32_t* table = batch.particles->GetImageTable();
+		for (size_t i = 0; i < batch.particles->GetImageTableSize(); i++) {
+			const TextureRegistry::Entry* e = textureRegistry.Find(table[i]);
+			if (!e) {
+				// 傫0ɂĕ\Ȃ
+				particleTexIDs.push_back(0);
+				particleUVRects.push_back(0);
+				particleWidths.push_back(0);
+				particleHeights.push_back(0);
+				continue;
+			}
+			particleTexIDs.push_back(static_cast<uint16_t>(e->texID));
+			particleUVRects.push_back(
+				static_cast<uint64_t>(PackUnorm(e->uvRect.x, 65535)) |
+				(static_cast<uint64_t>(PackUnorm(e->uvRect.y, 65535)) << 16) |
+				(static_cast<uint64_t>(PackUnorm(e->uvRect.z, 65535)) << 32) |
+				(static_cast<uint64_t>(PackUnorm(e->uvRect.w, 65535)) << 48));
+			particleWidths.push_back(static_cast<float>(e->width));
+			particleHeights.push_back(static_cast<float>(e->height));
+		}
+	}
+	return total;
+}
+
+/**
+* p[eBNϊĕ`悷R}hǉ
+*
+* @param list           R}hXg
+* @param particleData   p[eBNf[^ޗ̈
+* @param viewportHeight r[|[g̍
+*
+* @return ǉ`R}h̐
+*/
+size_t SpriteRenderer::RecordParticles(ID3D12GraphicsCommandList* list,
+	const UploadAllocation& particleData, float viewportHeight) const
+{
+	size_t drawCallCount = 0;
+	for (const ParticleBatch& batch : particleBatches) {
+		if (batch.count == 0) {
+			continue;
+		}
+		const ParticleImages images = {
+			particleTexIDs.data() + batch.imageOffset,
+			particleUVRects.data() + batch.imageOffset,
+			particleWidths.data() + batch.imageOffset,
+			particleHeights.data() + batch.imageOffset,
+		};
+		PackParticles(*batch.particles, batch.count, images, viewportHeight,
+			static_cast<SpriteInShader*>(particleData.cpuAddress) + batch.start);
+
+		list->SetPipelineState(psoList[static_cast<int>(batch.blendMode)]->GetPipelineStateObject());
+
+		// [gp[^1: p[eBNf[^
+		list->SetGraphicsRootShaderResourceView(1, particleData.gpuAddress + sizeof(SpriteInShader) * batch.start);
+
+		list->DrawIndexedInstanced(6, static_cast<UINT>(batch.count), 0, 0, 0);
+		++drawCallCount;
+	}
+	return drawCallCount;
+}
+
+/**
+* DrawŃ^C}bv`悷
+*
+* ^C}bv́AC[layerȏ̃XvCgɕ`悳(C[̃XvCg͏ɏdȂ)
+* C[̃^C}bv͓o^ɕ`悳
+* ʂɓ`N͕ϊf[^ۑĂÃt[͕`ʒuςĕ`悷
+* DrawI܂Ń^C}bvjȂ
+*
+* @param tilemap   ^C}bv
+* @param scrollX   ʂ̍ɕ\}bv̍W
+* @param scrollY
+* @param layer     C[
+* @param blendMode uh[h
+*/
+void SpriteRenderer::SubmitTilemap(const Tilemap& tilemap, float scrollX, float scrollY,
+	uint8_t layer, BlendMode blendMode)
+{
+	tilemapBatches.push_back({ &tilemap, scrollX, scrollY, layer, blendMode, 0 });
+}
+
+/**
+* ^C}bv̕ϊς݃f[^j
+*
+* ^C}bvjOɌĂяo. `N̗̈GPUgIĂėp
+*
+* @param tilemap ^C}bv
+*/
+void SpriteRenderer::ReleaseTilemap(const Tilemap& tilemap)
+{
+	auto itr = tilemapCaches.find(&tilemap);
+	if (itr != tilemapCaches.end()) {
+		for (auto& e : itr->second.chunks) {
+			chunkPool.Free(e.second.block);
+		}
+		tilemapCaches.erase(itr);
+	}
+}
+
+/**
+* ʂɓ^C}bṽ`Nϊ
+*
+* ۑς݂œeςĂȂ`N͂̂܂܎g
+* ʂ̎1`N藣ꂽ`N͔j(EsĂϊȂ)
+*
+* @param device   D3D12foCX
+* @param viewport `Ɏgr[|[g
+*/
+void SpriteRenderer::PrepareTilemaps(const DevicePtr& device, const D3D12_VIEWPORT& viewport)
+{
+	++tilemapFrame;
+	chunkPool.NextFrame();
+	const TextureRegistry& textureRegistry = device->GetTextureRegistry();
+
+	// ^CԍƂ̉摜̏
+	std::vector<TileImageInShader> tileImages;
+
+	for (const TilemapBatch& batch : tilemapBatches) {
+		const Tilemap& tilemap = *batch.tilemap;
+		TilemapCache& cache = tilemapCaches[&tilemap];
+		if (cache.serial != tilemap.GetSerial()) {
+			// ꂽ^C}bv̌Âf[^͎gȂ
+			for (auto& e : cache.chunks) {
+				chunkPool.Free(e.second.block);
+			}
+			cache.chunks.clear();
+			cache.serial = tilemap.GetSerial();
+		}
+
+		int firstX, firstY, lastX, lastY;
+		tilemap.GetVisibleChunks(batch.scrollX, batch.scrollY, viewport.Width, viewport.Height,
+			firstX, firstY, lastX, lastY);
+		const int countX = static_cast<int>(tilemap.GetChunkCountX());
+		const int countY = static_cast<int>(tilemap.GetChunkCountY());
+		const auto wrapX = [&tilemap, countX](int x) {
+			return tilemap.GetWrapX() ? ((x % countX) + countX) % countX : x;
+		};
+
+		// ʂ̎1`N܂ł͔jȂ
+		for (int cy = std::max(firstY - 1, 0); cy <= std::min(lastY + 1, countY - 1); cy++) {
+			for (int x = firstX - 1; x <= lastX + 1; x++) {
+				const int cx = wrapX(x);
+				if (cx < 0 || cx >= countX) {
+					continue;
+				}
+				auto itr = cache.chunks.find(static_cast<uint32_t>(cy * countX + cx));
+				if (itr != cache.chunks.end()) {
+					itr->second.keepFrame = tilemapFrame;
+				}
+			}
+		}
+
+		// ʂɓ`N̂AۑĂȂeς̂ϊ
+		tileImages.clear();
+		for (int cy = firstY; cy <= lastY; cy++) {
+			for (int x = firstX; x <= lastX; x++) {
+				const uint32_t cx = static_cast<uint32_t>(wrapX(x));
+				TilemapChunk& chunk = cache.chunks[static_cast<uint32_t>(cy * countX) + cx];
+				chunk.keepFrame = tilemapFrame;
+				const uint32_t version = tilemap.GetChunkVersion(cx, cy);
+				if (chunk.version == version) {
+					statistics.skippedUploadBytes += sizeof(SpriteInShader) * chunk.count;
+					continue;
+				}
+				chunkPool.Free(chunk.block);
+				chunk.block = BlockPool::invalidBlock;
+				chunk.version = version;
+				chunk.count = 0;
+				++statistics.repackedChunkCount;
+				const uint32_t tileCount = tilemap.GetChunkTileCount(cx, cy);
+				if (tileCount == 0) {
+					continue;
+				}
+
+				// ^Cԍ̉摜𒲂ׂ̂́AϊKvɂȂƂɈx
+				if (tileImages.empty()) {
+					tileImages.resize(tilemap.GetTileImageCount() + 1, TileImageInShader{ 0, {}, false });
+					for (size_t i = 1; i < tileImages.size(); i++) {
+						const TextureRegistry::Entry* e =
+							textureRegistry.Find(tilemap.GetTileImage(static_cast<uint16_t>(i)));
+						if (e) {
+							tileImages[i] = { static_cast<uint16_t>(e->texID), {
+								static_cast<uint16_t>(PackUnorm(e->uvRect.x, 65535)),
+								static_cast<uint16_t>(PackUnorm(e->uvRect.y, 65535)),
+								static_cast<uint16_t>(PackUnorm(e->uvRect.z, 65535)),
+								static_cast<uint16_t>(PackUnorm(e->uvRect.w, 65535)) }, true };
+						}
+					}
+				}
+
+				chunk.block = AllocateChunkBlock(device);
+				if (chunk.block == BlockPool::invalidBlock) {
+					chunk.version = 0; // ̃t[ł蒼
+					continue;
+				}
+				chunk.count = PackTilemapChunk(tilemap, cx, static_cast<uint32_t>(cy),
+					tileImages.data(), tileImages.size(), static_cast<SpriteInShader*>(GetChunkBlockAddress(chunk.block)));
+				statistics.uploadBytes += sizeof(SpriteInShader) * chunk.count;
+			}
+		}
+
+		for (int cy = firstY; cy <= lastY; cy++) {
+			for (int x = firstX; x <= lastX; x++) {
+				const auto itr = cache.chunks.find(static_cast<uint32_t>(cy * countX + wrapX(x)));
+				if (itr != cache.chunks.end() && itr->second.count > 0) {
+					++statistics.tilemapChunkCount;
+					statistics.tileCount += itr->second.count;
+				}
+			}
+		}
+	}
+
+	// ʂ痣ꂽ`Nj(̃t[ŕ`悵Ȃ^C}bv͂̂܂܎c)
+	for (const TilemapBatch& batch : tilemapBatches) {
+		auto& chunks = tilemapCaches[batch.tilemap].chunks;
+		for (auto itr = chunks.begin(); itr != chunks.end();) {
+			if (itr->second.keepFrame != tilemapFrame) {
+				chunkPool.Free(itr->second.block);
+				itr = chunks.erase(itr);
+			} else {
+				++itr;
+			}
+		}
+	}
+}
+
+/**
+* ^C}bṽ`N1̃ubNmۂ
+*
+* 󂫂Ȃ΁AAbv[hobt@(y[W)ăv[ɒǉ
+*
+* @param device D3D12foCX
+*
+* @return ubNԍ. mۂłȂꍇBlockPool::invalidBlock
+*/
+uint32_t SpriteRenderer::AllocateChunkBlock(const DevicePtr& device)
+{
+	uint32_t block = chunkPool.Allocate();
+	if (block != BlockPool::invalidBlock) {
+		return block;
+	}
+	ComPtr<ID3D12Resource> page = device->CreateUploadResource(L"Tilemap Chunk Pool", chunkBlockBytes * chunkBlocksPerPage);
+	if (!page) {
+		return BlockPool::invalidBlock;
+	}
+	void* p;
+	const D3D12_RANGE range = { 0, 0 };
+	if (FAILED(page->Map(0, &range, &p))) {
+		return BlockPool::invalidBlock;
+	}
+	chunkPages.push_back(page);
+	chunkPageAddresses.push_back(static_cast<uint8_t*>(p));
+	chunkPool.AddPage();
+	return chunkPool.Allocate();
+}
+
+/**
+* `ÑubN̏ݐ擾
+*/
+void* SpriteRenderer::GetChunkBlockAddress(uint32_t block) const
+{
+	return chunkPageAddresses[chunkPool.GetPage(block)] + chunkBlockBytes * chunkPool.GetIndexInPage(block);
+}
+
+/**
+* ^C}bv`悷R}hǉ
+*
+* `NƂɁA`N̈ʒuֈړsݒ肵ĕ`悷
+* XN[Ăς͍̂s񂾂ŁA`Ñf[^͍蒼Ȃ
+*
+* @param list          R}hXg
+* @param batch         `悷^C}bv
+* @param renderingInfo `ɕKvȊe
+*
+* @return ǉ`R}h̐
+*/
+size_t SpriteRenderer::RecordTilemap(ID3D12GraphicsCommandList* list,
+	const TilemapBatch& batch, const SpriteRenderingInfo& renderingInfo) const
+{
+	const auto itrCache = tilemapCaches.find(batch.tilemap);
+	if (itrCache == tilemapCaches.end()) {
+		return 0;
+	}
+	const Tilemap& tilemap = *batch.tilemap;
+	const TilemapCache& cache = itrCache->second;
+
+	int firstX, firstY, lastX, lastY;
+	tilemap.GetVisibleChunks(batch.scrollX, batch.scrollY,
+		renderingInfo.viewport.Width, renderingInfo.viewport.Height, firstX, firstY, lastX, lastY);
+	const int countX = static_cast<int>(tilemap.GetChunkCountX());
+	const float chunkWidth = tilemap.GetTileWidth() * Tilemap::chunkSize;
+	const float chunkHeight = tilemap.GetTileHeight() * Tilemap::chunkSize;
+
+	list->SetPipelineState(psoList[static_cast<int>(batch.blendMode)]->GetPipelineStateObject());
+	size_t drawCallCount = 0;
+	for (int cy = firstY; cy <= lastY; cy++) {
+		for (int x = firstX; x <= lastX; x++) {
+			const int cx = tilemap.GetWrapX() ? ((x % countX) + countX) % countX : x;
+			const auto itr = cache.chunks.find(static_cast<uint32_t>(cy * countX + cx));
+			if (itr == cache.chunks.end() || itr->second.count == 0) {
+				continue;
+			}
+
+			// [gp[^0: `N̍ʏ̈ʒuɈړs
+			const float left = static_cast<float>(x) * chunkWidth - batch.scrollX;
+			const float bottom = renderingInfo.viewport.Height -
+				(static_cast<float>(cy) * chunkHeight - batch.scrollY) - chunkHeight;
+			const XMMATRIX matChunk = XMMatrixTranspose(
+				XMMatrixTranslation(left, bottom, 0) * renderingInfo.matViewProjection);
+			list->SetGraphicsRoot32BitConstants(0, 16, &matChunk, 0);
+
+			// [gp[^1: `Ñ^Cf[^
+			const uint32_t block = itr->second.block;
+			list->SetGraphicsRootShaderResourceView(1, chunkPages[chunkPool.GetPage(block)]->GetGPUVirtualAddress() +
+				chunkBlockBytes * chunkPool.GetIndexInPage(block));
+
+			list->DrawIndexedInstanced(6, itr->second.count, 0, 0, 0);
+			++drawCallCount;
+		}
+	}
+
+	// ɑXvCĝ߂ɍs߂
+	const XMMATRIX matVP = XMMatrixTranspose(renderingInfo.matViewProjection);
+	list->SetGraphicsRoot32BitConstants(0, 16, &matVP, 0);
+	return drawCallCount;
+}
+
+/**
+* `ÑXvCgƃ^C}bv`悷R}hǉ
+*
+* ^C}bv́A`揇ł̃^C}bvɂȂXvCǧɊ荞܂
+*
+* @param list          R}hXg
+* @param pSprite       XvCgz
+* @param chunk         `悷`N
+* @param isLastChunk   Ō̃`NȂtrue(ׂẴXvCǧɕ`悷^C}bv󂯎)
+* @param address       XvCgf[^̐擪AhX
+* @param renderingInfo `ɕKvȊe
+*
+* @return ǉ`R}h̐
+*/
+size_t SpriteRenderer::RecordChunk(ID3D12GraphicsCommandList* list, const Sprite* pSprite, Chunk& chunk,
+	bool isLastChunk, D3D12_GPU_VIRTUAL_ADDRESS address, const SpriteRenderingInfo& renderingInfo) const
+{
+	const size_t end = chunk.start + chunk.count;
+	size_t drawCallCount = 0;
+	size_t position = chunk.start;
+	for (const TilemapBatch& batch : tilemapBatches) {
+		const size_t split = batch.splitPosition;
+		if (split < chunk.start || split > end || (split == end && !isLastChunk)) {
+			continue; // ̃`N󂯎
+		}
+		if (split > position) {
+			BuildRuns(pSprite, sortedOrder.data() + position, split - position, chunk.runs);
+			drawCallCount += RecordRuns(list, address + sizeof(SpriteInShader) * position, chunk.runs);
+			position = split;
+		}
+		drawCallCount += RecordTilemap(list, batch, renderingInfo);
+	}
+	if (end > position) {
+		BuildRuns(pSprite, sortedOrder.data() + position, end - position, chunk.runs);
+		drawCallCount += RecordRuns(list, address + sizeof(SpriteInShader) * position, chunk.runs);
+	}
+	return drawCallCount;
+}
+
+/**
+* XvCgz`悷R}hXg쐬
+*
+* `揇߂܂ł͌ĂяoXbhōsA
+* ϊƃR}h̋L^̓`NƂɍƗpXbhōs
+* ÓIC[͍ŏ̃`ÑR}hXgɋL^
+* ^C}bv́A`揇Ŋ荞ވʒu󂯎`ÑR}hXgɋL^
+* p[eBN͍Ō̃R}hXgɋL^
+*
+* @return R}hXg̔z. ̏ŃL[ɐςނ
+*/
+const std::vector<ID3D12CommandList*>& SpriteRenderer::Draw(
+	DevicePtr device, const Sprite* pSprite, size_t count, const SpriteRenderingInfo& renderingInfo)
+{
+	CommandContext* contexts = commandContexts[renderingInfo.framebufferIndex];
+	statistics = {};
+
+	// `揇߂
+	size_t invalidHandleCount = 0;
+	const size_t visibleCount = count > 0 ?
+		BuildDrawOrder(device, pSprite, count, renderingInfo.scissorRect, invalidHandleCount) : 0;
+
+	UploadAllocation spriteData;
+	if (visibleCount > 0) {
+		spriteData = device->GetUploadRing().Allocate(sizeof(SpriteInShader) * visibleCount);
+	}
+
+	// `揇ɉă`Nɕ(ȂΕȂ)
+	size_t chunkCount = 0;
+	if (spriteData) {
+		chunkCount = std::min(maxChunkCount, device->GetWorkerPool().GetConcurrency());
+		chunkCount = std::max<size_t>(std::min(chunkCount, visibleCount / minChunkSize), 1);
+		const size_t chunkSize = (visibleCount + chunkCount - 1) / chunkCount;
+		for (size_t i = 0; i < chunkCount; i++) {
+			chunks[i].start = chunkSize * i;
+			chunks[i].count = std::min(chunkSize, visibleCount - chunks[i].start);
+		}
+	} else {
+		chunks[0].start = 0;
+		chunks[0].count = 0;
+	}
+
+	// ^C}bv荞܂ʒu߁Aʂɓ`Nϊ
+	std::stable_sort(tilemapBatches.begin(), tilemapBatches.end(),
+		[](const TilemapBatch& a, const TilemapBatch& b) { return a.layer < b.layer; });
+	for (TilemapBatch& batch : tilemapBatches) {
+		const uint32_t* order = sortedOrder.data();
+		batch.splitPosition = static_cast<size_t>(std::partition_point(order, order + visibleCount,
+			[pSprite, &batch](uint32_t n) { return pSprite[n].layer < batch.layer; }) - order);
+	}
+	PrepareTilemaps(device, renderingInfo.viewport);
+
+	// p[eBN̓XvCgƓɕϊ
+	const size_t particleCount = PrepareParticles(device);
+	UploadAllocation particleData;
+	if (particleCount > 0) {
+		particleData = device->GetUploadRing().Allocate(sizeof(SpriteInShader) * particleCount);
+	}
+	size_t particleDrawCallCount = 0;
+
+	// `NƂɕϊċL^. L^̂ȂĂÃR}hXgЂƂԂ
+	const size_t listCount = std::max<size_t>(chunkCount, 1);
+	const size_t taskCount = listCount + (particleData ? 1 : 0);
+	const auto packBegin = std::chrono::steady_clock::now();
+	device->GetWorkerPool().Run(taskCount, [&](size_t i) {
+		if (i == listCount) {
+			CommandContext& context = contexts[maxChunkCount];
+			context.allocator->Reset();
+			context.list->Reset(context.allocator.Get(), nullptr);
+			SetupCommandList(context.list.Get(), device, renderingInfo);
+			particleDrawCallCount = RecordParticles(context.list.Get(), particleData, renderingInfo.viewport.Height);
+			context.list->Close();
+			return;
+		}
+
+		CommandContext& context = contexts[i];
+		Chunk& chunk = chunks[i];
+		chunk.drawCallCount = 0;
+		context.allocator->Reset();
+		context.list->Reset(context.allocator.Get(), nullptr);
+		if (i >= chunkCount && submittedLayers.empty() && tilemapBatches.empty()) {
+			context.list->Close();
+			return;
+		}
+		SetupCommandList(context.list.Get(), device, renderingInfo);
+
+		// ÓIC[͕ۑς݂̃f[^̂܂܎g
+		if (i == 0) {
+			for (int id : submittedLayers) {
+				auto itr = staticLayers.find(id);
+				if (itr == staticLayers.end() || itr->second.count == 0) {
+					continue;
+				}
+				const StaticLayer& layer = itr->second;
+				chunk.drawCallCount += RecordRuns(context.list.Get(), layer.buffer->GetGPUVirtualAddress(), layer.runs);
+			}
+		}
+
+		if (i < chunkCount) {
+			const uint32_t* order = sortedOrder.data() + chunk.start;
+			PackSprites(pSprite, order, textureKeys.data(), uvRects.data(), chunk.count,
+				renderingInfo.viewport.Height, static_cast<SpriteInShader*>(spriteData.cpuAddress) + chunk.start);
+		}
+		chunk.drawCallCount += RecordChunk(context.list.Get(), pSprite, chunk, i + 1 == listCount,
+			spriteData.gpuAddress, renderingInfo);
+		context.list->Close();
+	});
+	const auto packEnd = std::chrono::steady_clock::now();
+
+	commandLists.clear();
+	for (size_t i = 0; i < listCount; i++) {
+		commandLists.push_back(contexts[i].list.Get());
+		statistics.drawCallCount += chunks[i].drawCallCount;
+	}
+	if (particleData) {
+		commandLists.push_back(contexts[maxChunkCount].list.Get());
+		statistics.drawCallCount += particleDrawCallCount;
+		statistics.particleCount = particleCount;
+		statistics.uploadBytes += sizeof(SpriteInShader) * particleCount;
+	}
+	particleBatches.clear();
+	tilemapBatches.clear();
+
+	for (int id : submittedLayers) {
+		auto itr = staticLayers.find(id);
+		if (itr != staticLayers.end()) {
+			statistics.staticSpriteCount += itr->second.count;
+			statistics.skippedUploadBytes += sizeof(SpriteInShader) * itr->second.count;
+		}
+	}
+	submittedLayers.clear();
+
+	if (spriteData) {
+		// eNX`ԍ͌ŒȂ̂ŁAt[Ƃ̃fXNv^̃Rs[͔Ȃ
+		statistics.spriteCount = visibleCount;
+		statistics.uploadBytes += sizeof(SpriteInShader) * visibleCount;
+		statistics.chunkCount = chunkCount;
+		statistics.packNanoseconds = static_cast<uint64_t>(
+			std::chrono::duration_cast<std::chrono::nanoseconds>(packEnd - packBegin).count());
+	}
+	statistics.culledCount = count - visibleCount - invalidHandleCount;
+	statistics.invalidHandleCount = invalidHandleCount;
+
+	return commandLists;
 }
 
 } // namespace EasyLib
 } // namespace DX12
-
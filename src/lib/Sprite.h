@@ -1,27 +1,23 @@
 #ifndef EASYLIB_DX12_SPRITE_H
 #define EASYLIB_DX12_SPRITE_H
+#include "DrawData.h"
 #include "Texture.h"
 #include "PSO.h"
 #include "Device.h"
+#include "SpriteSort.h"
+#include "SpriteCull.h"
+#include "Particle.h"
+#include "Tilemap.h"
+#include "BlockPool.h"
 #include <d3d12.h>
 #include <DirectXMath.h>
 #include <wrl/client.h>
+#include <unordered_map>
+#include <vector>
 
 namespace EasyLib {
 namespace DX12 {
 
-/**
-*
-*/
-struct Sprite
-{
-  TexturePtr texture;
-  DirectX::XMFLOAT3 position;
-  float rotation;
-  DirectX::XMFLOAT2 scale;
-  DirectX::XMFLOAT4 color;
-};
-
 struct SpriteRenderingInfo
 {
   DirectX::XMMATRIX matViewProjection;
@@ -32,11 +28,36 @@ struct SpriteRenderingInfo
   int framebufferIndex;
 };
 
+/**
+* XvCg`̓v
+*/
+struct SpriteRendererStatistics
+{
+  size_t spriteCount = 0;           // `悵XvCg
+  size_t culledCount = 0;           // ʊOȂ̂ŕ`悵ȂXvCg
+  size_t drawCallCount = 0;         // `R}h̐(uh[h̐؂ւƂɑ)
+  size_t chunkCount = 0;            // ɕϊƋL^s`N̐
+  size_t staticSpriteCount = 0;     // ÓIC[`悵XvCg
+  size_t particleCount = 0;         // `悵p[eBN
+  size_t tileCount = 0;             // ^C}bv`悵^C
+  size_t tilemapChunkCount = 0;     // `悵^C}bṽ`N
+  size_t repackedChunkCount = 0;    // ʂɓeς߁Aϊ`N
+  size_t skippedUploadBytes = 0;    // ÓIC[ƃ^C}bvŁAϊƃAbv[hȗłoCg
+  size_t invalidHandleCount = 0;    // eNX`nhߕ`悵ȂXvCg
+  size_t uploadBytes = 0;           // GPUɑXvCgf[^̃oCg
+  uint64_t packNanoseconds = 0;     // XvCgf[^̕ϊƃR}h̋L^ɂ(imb)
+};
+
 /**
 * XvCg`NX
 *
 * ƎPSOR}hXg
-* Draw֐ԂR}hXgL[ɐςŎs
+* Draw֐ԂR}hXgAz̏ɃL[ɐςŎs
+*
+* XvCgꍇ͕`揇ɉĂ̃`NɕA
+* foCX̍ƗpXbhŃ`NƂɕϊƃR}h̋L^s
+* p[eBN̓XvCǧɁAp̃R}hXgŕ`悷
+* ^C}bv́A`NƂɕϊf[^ۑĂA`ʒuςĕ`悷
 */
 class SpriteRenderer
 {
@@ -44,26 +65,160 @@ public:
   SpriteRenderer() = default;
   ~SpriteRenderer() = default;
 
-  bool Initialize(DevicePtr device, size_t framebufferCount, size_t maxSpriteCount);
+  bool Initialize(DevicePtr device, size_t framebufferCount);
 
-  ID3D12GraphicsCommandList* Draw(
+  const std::vector<ID3D12CommandList*>& Draw(
     DevicePtr device, const Sprite* p, size_t count, const SpriteRenderingInfo& renderingInfo);
 
+  // `N̍ő吔ƁA`NЂƂ̍ŏXvCg
+  // ϊ1XvCg6ns(PackSprites_ChunksŌv)Ȃ̂ŁA4096Ŗ25us.
+  // 菬`N̓R}hXg̋L^ƃXbh̋N̕
+  static constexpr size_t maxChunkCount = 4;
+  static constexpr size_t minChunkSize = 4096;
+
+  // DrawԂR}hXg̍ő吔(`NƂ̃Xgƃp[eBNp̃Xg)
+  static constexpr size_t maxCommandListCount = maxChunkCount + 1;
+
+  void SortByTexture(bool b) { sortByTexture = b; }
+  bool SortByTexture() const { return sortByTexture; }
+  const SpriteRendererStatistics& GetStatistics() const { return statistics; }
+
+  // ÓIC[
+  bool BuildStaticLayer(DevicePtr device, int id, const Sprite* p, size_t count,
+    const D3D12_VIEWPORT& viewport, const D3D12_RECT& scissorRect);
+  void ReleaseStaticLayer(DevicePtr device, int id);
+  bool HasStaticLayer(int id) const { return staticLayers.find(id) != staticLayers.end(); }
+  bool SubmitStaticLayer(int id);
+
+  // p[eBN(DrawŁAXvCǧɓo^ŕ`悷)
+  void SubmitParticles(const ParticleSystem& particles, BlendMode blendMode);
+
+  // ^C}bv(DrawŁAw肵C[̃XvCgɕ`悷)
+  void SubmitTilemap(const Tilemap& tilemap, float scrollX, float scrollY, uint8_t layer, BlendMode blendMode);
+  void ReleaseTilemap(const Tilemap& tilemap);
+
 private:
-  std::shared_ptr<PSO> pso;
+  // uh[hXvCg̕
+  struct DrawRun {
+    BlendMode blendMode;
+    uint32_t start;
+    uint32_t count;
+  };
+
+  size_t BuildDrawOrder(const DevicePtr& device, const Sprite* pSprite, size_t count,
+    const D3D12_RECT& scissorRect, size_t& invalidHandleCount);
+  static void BuildRuns(const Sprite* pSprite, const uint32_t* order, size_t count, std::vector<DrawRun>& runs);
+  void SetupCommandList(ID3D12GraphicsCommandList* list, const DevicePtr& device,
+    const SpriteRenderingInfo& renderingInfo) const;
+  size_t RecordRuns(ID3D12GraphicsCommandList* list,
+    D3D12_GPU_VIRTUAL_ADDRESS address, const std::vector<DrawRun>& runs) const;
+  size_t PrepareParticles(const DevicePtr& device);
+  size_t RecordParticles(ID3D12GraphicsCommandList* list,
+    const UploadAllocation& particleData, float viewportHeight) const;
+  struct Chunk;
+  struct TilemapBatch;
+  void PrepareTilemaps(const DevicePtr& device, const D3D12_VIEWPORT& viewport);
+  uint32_t AllocateChunkBlock(const DevicePtr& device);
+  void* GetChunkBlockAddress(uint32_t block) const;
+  size_t RecordTilemap(ID3D12GraphicsCommandList* list,
+    const TilemapBatch& batch, const SpriteRenderingInfo& renderingInfo) const;
+  size_t RecordChunk(ID3D12GraphicsCommandList* list, const Sprite* pSprite, Chunk& chunk, bool isLastChunk,
+    D3D12_GPU_VIRTUAL_ADDRESS address, const SpriteRenderingInfo& renderingInfo) const;
+
+  static constexpr int blendModeCount = 4;
+  PSOPtr psoList[blendModeCount]; // BlendModeƂPSO
   struct CommandContext {
-    DescriptorHeap heap;
     Microsoft::WRL::ComPtr<ID3D12CommandAllocator> allocator;
     Microsoft::WRL::ComPtr<ID3D12GraphicsCommandList> list;
-    Microsoft::WRL::ComPtr<ID3D12Resource> spriteBuffer;
   };
-  CommandContext commandContexts[3];
+  CommandContext commandContexts[3][maxCommandListCount]; // t[ƁA`NƂ̃R}hXg(Ō̓p[eBNp)
+  std::vector<ID3D12CommandList*> commandLists;       // DrawԂR}hXg
   Microsoft::WRL::ComPtr<ID3D12Resource> indexBuffer;
 
   D3D12_INDEX_BUFFER_VIEW viewIB;
   size_t framebufferCount = 0;
-  size_t maxSpriteCount = 0;
-  size_t curSpriteCount = 0;
+
+  // C[Ɛ[x̒ŁAuh[hƃeNX`Ƃɕ`揇בւ
+  bool sortByTexture = false;
+  SpriteSorter sorter;
+  std::vector<uint32_t> textureKeys;
+  std::vector<DirectX::XMFLOAT4> uvRects;
+  std::vector<uint64_t> sortKeys;
+  std::vector<uint32_t> sortedOrder;
+
+  // JOp̃XvCg͈̔(]܂߂AABB)ƁAJO
+  std::vector<float> centerX;
+  std::vector<float> centerY;
+  std::vector<float> extentX;
+  std::vector<float> extentY;
+  std::vector<uint32_t> visibleOrder;
+
+  // `NƂ̕`͈͂ƌ
+  struct Chunk {
+    size_t start = 0;
+    size_t count = 0;
+    std::vector<DrawRun> runs;
+    size_t drawCallCount = 0;
+  };
+  Chunk chunks[maxChunkCount];
+
+  // ϊς݂̃f[^ۑC[
+  struct StaticLayer {
+    Microsoft::WRL::ComPtr<ID3D12Resource> buffer;
+    size_t count = 0;
+    std::vector<DrawRun> runs;
+  };
+  std::unordered_map<int, StaticLayer> staticLayers;
+  std::vector<int> submittedLayers; // Drawŕ`悷ÓIC[
+
+  // Drawŕ`悷p[eBN
+  struct ParticleBatch {
+    const ParticleSystem* particles;
+    BlendMode blendMode;
+    size_t count;       // Draw̎_̃p[eBN
+    size_t imageOffset; // particleImages̐擪ʒu
+    size_t start;       // p[eBNf[^̐擪ʒu
+  };
+  std::vector<ParticleBatch> particleBatches;
+
+  // p[eBN̉摜\eNX`̏ɕϊ
+  std::vector<uint16_t> particleTexIDs;
+  std::vector<uint64_t> particleUVRects; // 16bit x 4
+  std::vector<float> particleWidths;
+  std::vector<float> particleHeights;
+
+  // Drawŕ`悷^C}bv
+  struct TilemapBatch {
+    const Tilemap* tilemap;
+    float scrollX;
+    float scrollY;
+    uint8_t layer;
+    BlendMode blendMode;
+    size_t splitPosition; // ̃^C}bvɕ`悷XvCg̐
+  };
+  std::vector<TilemapBatch> tilemapBatches;
+
+  // ^C}bṽ`NƂɕϊς݂̃f[^
+  struct TilemapChunk {
+    uint32_t block = BlockPool::invalidBlock; // chunkPool̃ubNԍ
+    uint32_t count = 0;      // ^C
+    uint32_t version = 0;    // ϊƂ̃`N̍XVԍ
+    uint64_t keepFrame = 0;  // Ōɉʂ̋߂ɂt[
+  };
+  struct TilemapCache {
+    uint32_t serial = 0; // ϊƂ̃^C}bv̎ʔԍ
+    std::unordered_map<uint32_t, TilemapChunk> chunks; // `Nԍ(cy * `NX + cx)Ƃ̃f[^
+  };
+  std::unordered_map<const Tilemap*, TilemapCache> tilemapCaches;
+  uint64_t tilemapFrame = 0;
+
+  // `Ñf[^́A`N1̃ubN܂Ƃ߂Abv[hobt@(y[W)؂o
+  // y[W̓}bv܂܂ɂĂA_[Ɠŕێ
+  BlockPool chunkPool;
+  std::vector<Microsoft::WRL::ComPtr<ID3D12Resource>> chunkPages;
+  std::vector<uint8_t*> chunkPageAddresses;
+
+  SpriteRendererStatistics statistics;
 };
 
 } // namespace EasyLib
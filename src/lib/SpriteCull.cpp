@@ -0,0 +1,97 @@
+/**
+* @file SpriteCull.cpp
+*/
+#include "SpriteCull.h"
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#include <emmintrin.h>
+#define EASYLIB_SPRITECULL_SSE2
+#endif
+
+namespace EasyLib {
+namespace DX12 {
+
+/**
+* `ƏdȂXvCgIяo(ėp)
+*
+* Ɩ߂lCullSpritesƓ
+*/
+size_t CullSpritesScalar(const float* centerX, const float* centerY, const float* extentX, const float* extentY,
+  size_t count, const CullRect& rect, uint32_t* visible)
+{
+  size_t visibleCount = 0;
+  for (size_t i = 0; i < count; ++i) {
+    const bool inside =
+      centerX[i] + extentX[i] > rect.left && centerX[i] - extentX[i] < rect.right &&
+      centerY[i] + extentY[i] > rect.top && centerY[i] - extentY[i] < rect.bottom;
+    visible[visibleCount] = static_cast<uint32_t>(i);
+    visibleCount += inside;
+  }
+  return visibleCount;
+}
+
+/**
+* `ƏdȂXvCgIяo
+*
+* XvCg͈̔͂͒SƁAS[܂ł̋(]܂߂AABB̔̑傫)Ŏw肷
+* `ɐڂĂ邾̃XvCg͕`悳Ȃ̂Ŏ菜
+*
+* @param centerX  SXW̔z
+* @param centerY  SYW̔z
+* @param extentX  S獶E̒[܂ł̋̔z
+* @param extentY  S㉺̒[܂ł̋̔z
+* @param count    z̒
+* @param rect     JOɎg`
+* @param visible  `ƏdȂXvCg̔ԍޔz(countvfȏ)
+*
+* @return visibleɏ񂾔ԍ̐
+*/
+size_t CullSprites(const float* centerX, const float* centerY, const float* extentX, const float* extentY,
+  size_t count, const CullRect& rect, uint32_t* visible)
+{
+#ifdef EASYLIB_SPRITECULL_SSE2
+  const __m128 left = _mm_set1_ps(rect.left);
+  const __m128 top = _mm_set1_ps(rect.top);
+  const __m128 right = _mm_set1_ps(rect.right);
+  const __m128 bottom = _mm_set1_ps(rect.bottom);
+
+  // 4XvCg肵āAdȂĂ̂̔ԍ𕪊Ȃŋl߂ď
+  size_t visibleCount = 0;
+  size_t i = 0;
+  for (; i + 4 <= count; i += 4) {
+    const __m128 x = _mm_loadu_ps(centerX + i);
+    const __m128 y = _mm_loadu_ps(centerY + i);
+    const __m128 ex = _mm_loadu_ps(extentX + i);
+    const __m128 ey = _mm_loadu_ps(extentY + i);
+    const __m128 insideX = _mm_and_ps(
+      _mm_cmpgt_ps(_mm_add_ps(x, ex), left), _mm_cmplt_ps(_mm_sub_ps(x, ex), right));
+    const __m128 insideY = _mm_and_ps(
+      _mm_cmpgt_ps(_mm_add_ps(y, ey), top), _mm_cmplt_ps(_mm_sub_ps(y, ey), bottom));
+    const int mask = _mm_movemask_ps(_mm_and_ps(insideX, insideY));
+    const uint32_t index = static_cast<uint32_t>(i);
+    visible[visibleCount] = index;
+    visibleCount += mask & 1;
+    visible[visibleCount] = index + 1;
+    visibleCount += (mask >> 1) & 1;
+    visible[visibleCount] = index + 2;
+    visibleCount += (mask >> 2) & 1;
+    visible[visibleCount] = index + 3;
+    visibleCount += (mask >> 3) & 1;
+  }
+
+  // [͔ėpłŏ
+  if (i < count) {
+    const size_t n = CullSpritesScalar(centerX + i, centerY + i, extentX + i, extentY + i,
+      count - i, rect, visible + visibleCount);
+    for (size_t j = 0; j < n; ++j) {
+      visible[visibleCount + j] += static_cast<uint32_t>(i);
+    }
+    visibleCount += n;
+  }
+  return visibleCount;
+#else
+  return CullSpritesScalar(centerX, centerY, extentX, extentY, count, rect, visible);
+#endif // EASYLIB_SPRITECULL_SSE2
+}
+
+} // namespace DX12
+} // namespace EasyLib
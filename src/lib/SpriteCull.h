@@ -0,0 +1,31 @@
+/**
+* @file SpriteCull.h
+*/
+#ifndef EASYLIB_DX12_SPRITECULL_H
+#define EASYLIB_DX12_SPRITECULL_H
+#include <stddef.h>
+#include <stdint.h>
+
+namespace EasyLib {
+namespace DX12 {
+
+/**
+* JOp̋`(sNZP. オ_)
+*/
+struct CullRect
+{
+  float left;
+  float top;
+  float right;
+  float bottom;
+};
+
+size_t CullSprites(const float* centerX, const float* centerY, const float* extentX, const float* extentY,
+  size_t count, const CullRect& rect, uint32_t* visible);
+size_t CullSpritesScalar(const float* centerX, const float* centerY, const float* extentX, const float* extentY,
+  size_t count, const CullRect& rect, uint32_t* visible);
+
+} // namespace DX12
+} // namespace EasyLib
+
+#endif // EASYLIB_DX12_SPRITECULL_H
@@ -0,0 +1,366 @@
+/**
+* @file SpritePack.cpp
+*/
+#include "SpritePack.h"
+#include "CpuFeatures.h"
+#include <math.h>
+#include <string.h>
+#include <algorithm>
+#ifdef _WIN32
+#include <DirectXPackedVector.h>
+#endif
+#ifdef EASYLIB_X86_SIMD
+#include <immintrin.h>
+#endif
+
+namespace EasyLib {
+namespace DX12 {
+
+using namespace DirectX;
+
+namespace /* unnamed */ {
+
+/**
+* XvCgVF[_pf[^ɕϊ(ėp)
+*
+* PackSpritesƓ. PackSpritesScalarAVX2ł̒[g
+*/
+void PackSpritesRange(const Sprite* pSprite, const uint32_t* order, const uint32_t* texIDs,
+  const XMFLOAT4* uvRects, size_t count, float viewportHeight, SpriteInShader* p)
+{
+  for (size_t i = 0; i < count; ++i) {
+    const uint32_t n = order ? order[i] : static_cast<uint32_t>(i);
+    const Sprite& sprite = pSprite[n];
+    p[i].position[0] = PackHalf(sprite.position.x);
+    p[i].position[1] = PackHalf(viewportHeight - sprite.position.y);
+    p[i].scale[0] = PackHalf(sprite.scale.x);
+    p[i].scale[1] = PackHalf(sprite.scale.y);
+    p[i].rotation = PackRotation(sprite.rotation);
+    p[i].texID = static_cast<uint16_t>(texIDs[n]);
+    p[i].color = PackUnorm(sprite.color.x, 255) | (PackUnorm(sprite.color.y, 255) << 8) |
+      (PackUnorm(sprite.color.z, 255) << 16) | (PackUnorm(sprite.color.w, 255) << 24);
+    p[i].uvRect[0] = static_cast<uint16_t>(PackUnorm(uvRects[n].x, 65535));
+    p[i].uvRect[1] = static_cast<uint16_t>(PackUnorm(uvRects[n].y, 65535));
+    p[i].uvRect[2] = static_cast<uint16_t>(PackUnorm(uvRects[n].z, 65535));
+    p[i].uvRect[3] = static_cast<uint16_t>(PackUnorm(uvRects[n].w, 65535));
+  }
+}
+
+/**
+* p[eBNVF[_pf[^ɕϊ(ėp)
+*
+* beginend̎O܂łϊ
+*/
+void PackParticlesRange(const ParticleSystem& particles, size_t begin, size_t end,
+  const ParticleImages& images, float viewportHeight, SpriteInShader* p)
+{
+  const float* x = particles.GetPositionX();
+  const float* y = particles.GetPositionY();
+  const float* scale = particles.GetScale();
+  const uint32_t* frames = particles.GetFrames();
+  for (size_t i = begin; i < end; ++i) {
+    const uint32_t n = frames[i];
+    p[i].position[0] = PackHalf(x[i]);
+    p[i].position[1] = PackHalf(viewportHeight - y[i]);
+    p[i].scale[0] = PackHalf(images.widths[n] * scale[i]);
+    p[i].scale[1] = PackHalf(images.heights[n] * scale[i]);
+    p[i].rotation = 0;
+    p[i].texID = images.texIDs[n];
+    p[i].color = 0xffff'ffff;
+    memcpy(p[i].uvRect, &images.uvRects[n], sizeof(p[i].uvRect));
+  }
+}
+
+#ifdef EASYLIB_X86_SIMD
+/**
+* XvCgVF[_pf[^ɕϊ(AVX2)
+*
+* 2XvCgAWƑ傫F16CŔxɁAFUV܂Ƃ߂Đɕϊ
+*/
+EASYLIB_TARGET_AVX2 void PackSpritesAVX2(const Sprite* pSprite, const uint32_t* order, const uint32_t* texIDs,
+  const XMFLOAT4* uvRects, size_t count, float viewportHeight, SpriteInShader* p)
+{
+  const __m256 colorScale = _mm256_set1_ps(255.0f);
+  const __m256 uvScale = _mm256_set1_ps(65535.0f);
+  const __m256 zero = _mm256_setzero_ps();
+  const __m256 one = _mm256_set1_ps(1.0f);
+  const __m256 half = _mm256_set1_ps(0.5f);
+
+  size_t i = 0;
+  for (; i + 2 <= count; i += 2) {
+    const uint32_t n0 = order ? order[i] : static_cast<uint32_t>(i);
+    const uint32_t n1 = order ? order[i + 1] : static_cast<uint32_t>(i + 1);
+    const Sprite& s0 = pSprite[n0];
+    const Sprite& s1 = pSprite[n1];
+
+    // WƑ傫: [x, y, sx, sy] x 2 𔼐x8ɕϊ
+    const __m256 posScale = _mm256_setr_ps(
+      s0.position.x, viewportHeight - s0.position.y, s0.scale.x, s0.scale.y,
+      s1.position.x, viewportHeight - s1.position.y, s1.scale.x, s1.scale.y);
+    const __m128i halfs = _mm256_cvtps_ph(posScale, _MM_FROUND_TO_NEAREST_INT);
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(p[i].position), halfs);
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(p[i + 1].position), _mm_unpackhi_epi64(halfs, halfs));
+
+    // F: RGBA x 2 8bitɕϊ
+    __m256 color = _mm256_set_m128(
+      _mm_loadu_ps(&s1.color.x), _mm_loadu_ps(&s0.color.x));
+    // PackUnormƓA0.5𑫂Đ؂̂Ă
+    color = _mm256_add_ps(_mm256_mul_ps(_mm256_min_ps(_mm256_max_ps(color, zero), one), colorScale), half);
+    const __m256i color32 = _mm256_cvttps_epi32(color);
+    const __m128i color16 = _mm_packus_epi32(
+      _mm256_castsi256_si128(color32), _mm256_extracti128_si256(color32, 1));
+    const __m128i color8 = _mm_packus_epi16(color16, color16);
+    p[i].color = static_cast<uint32_t>(_mm_cvtsi128_si32(color8));
+    p[i + 1].color = static_cast<uint32_t>(_mm_extract_epi32(color8, 1));
+
+    // UV: 4vf x 2 16bitɕϊ
+    __m256 uv = _mm256_set_m128(
+      _mm_loadu_ps(&uvRects[n1].x), _mm_loadu_ps(&uvRects[n0].x));
+    uv = _mm256_add_ps(_mm256_mul_ps(_mm256_min_ps(_mm256_max_ps(uv, zero), one), uvScale), half);
+    const __m256i uv32 = _mm256_cvttps_epi32(uv);
+    const __m128i uv16 = _mm_packus_epi32(
+      _mm256_castsi256_si128(uv32), _mm256_extracti128_si256(uv32, 1));
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(p[i].uvRect), uv16);
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(p[i + 1].uvRect), _mm_unpackhi_epi64(uv16, uv16));
+
+    p[i].rotation = PackRotation(s0.rotation);
+    p[i + 1].rotation = PackRotation(s1.rotation);
+    p[i].texID = static_cast<uint16_t>(texIDs[n0]);
+    p[i + 1].texID = static_cast<uint16_t>(texIDs[n1]);
+  }
+
+  // [͔ėpłŏ
+  if (i < count) {
+    if (order) {
+      PackSpritesRange(pSprite, order + i, texIDs, uvRects, count - i, viewportHeight, p + i);
+    } else {
+      PackSpritesRange(pSprite + i, nullptr, texIDs + i, uvRects + i, count - i, viewportHeight, p + i);
+    }
+  }
+}
+
+/**
+* p[eBNVF[_pf[^ɕϊ(AVX2)
+*
+* WSoAȂ̂ŁA8܂Ƃ߂ĔxɕϊĂAp[eBNƂɕבւď
+*/
+EASYLIB_TARGET_AVX2 void PackParticlesAVX2(const ParticleSystem& particles, size_t count,
+  const ParticleImages& images, float viewportHeight, SpriteInShader* p)
+{
+  const float* x = particles.GetPositionX();
+  const float* y = particles.GetPositionY();
+  const float* scale = particles.GetScale();
+  const uint32_t* frames = particles.GetFrames();
+  const __m256 height = _mm256_set1_ps(viewportHeight);
+
+  size_t i = 0;
+  for (; i + 8 <= count; i += 8) {
+    const __m256i n = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(frames + i));
+    const __m256 s = _mm256_loadu_ps(scale + i);
+    const __m256 sx = _mm256_mul_ps(_mm256_i32gather_ps(images.widths, n, 4), s);
+    const __m256 sy = _mm256_mul_ps(_mm256_i32gather_ps(images.heights, n, 4), s);
+    const __m128i hx = _mm256_cvtps_ph(_mm256_loadu_ps(x + i), _MM_FROUND_TO_NEAREST_INT);
+    const __m128i hy = _mm256_cvtps_ph(_mm256_sub_ps(height, _mm256_loadu_ps(y + i)), _MM_FROUND_TO_NEAREST_INT);
+    const __m128i hsx = _mm256_cvtps_ph(sx, _MM_FROUND_TO_NEAREST_INT);
+    const __m128i hsy = _mm256_cvtps_ph(sy, _MM_FROUND_TO_NEAREST_INT);
+
+    // [x, y, sx, sy] ̕тɓւ
+    const __m128i xyLo = _mm_unpacklo_epi16(hx, hy);
+    const __m128i xyHi = _mm_unpackhi_epi16(hx, hy);
+    const __m128i sLo = _mm_unpacklo_epi16(hsx, hsy);
+    const __m128i sHi = _mm_unpackhi_epi16(hsx, hsy);
+    const __m128i v[4] = {
+      _mm_unpacklo_epi32(xyLo, sLo), _mm_unpackhi_epi32(xyLo, sLo),
+      _mm_unpacklo_epi32(xyHi, sHi), _mm_unpackhi_epi32(xyHi, sHi),
+    };
+    for (int k = 0; k < 4; ++k) {
+      SpriteInShader& p0 = p[i + k * 2];
+      SpriteInShader& p1 = p[i + k * 2 + 1];
+      _mm_storel_epi64(reinterpret_cast<__m128i*>(p0.position), v[k]);
+      _mm_storel_epi64(reinterpret_cast<__m128i*>(p1.position), _mm_unpackhi_epi64(v[k], v[k]));
+    }
+    for (int k = 0; k < 8; ++k) {
+      const uint32_t f = frames[i + k];
+      p[i + k].rotation = 0;
+      p[i + k].texID = images.texIDs[f];
+      p[i + k].color = 0xffff'ffff;
+      memcpy(p[i + k].uvRect, &images.uvRects[f], sizeof(p[i + k].uvRect));
+    }
+  }
+  PackParticlesRange(particles, i, count, images, viewportHeight, p);
+}
+#endif // EASYLIB_X86_SIMD
+
+} // unnamed namespace
+
+/**
+* 0-1̒lnrbg̐ɕϊ
+*/
+uint32_t PackUnorm(float f, float scale)
+{
+  return static_cast<uint32_t>(std::min(std::max(f, 0.0f), 1.0f) * scale + 0.5f);
+}
+
+/**
+* Px_𔼐xɕϊ
+*
+* XMConvertFloatToHalfƓAł߂l(ԂȂ)Ɋۂ߂
+* F16C̕ϊ߂ƂʂɂȂ
+*/
+uint16_t PackHalf(float f)
+{
+#ifdef _WIN32
+  return PackedVector::XMConvertFloatToHalf(f);
+#else
+  uint32_t bits;
+  memcpy(&bits, &f, sizeof(bits));
+  const uint32_t sign = (bits & 0x8000'0000u) >> 16;
+  bits &= 0x7fff'ffffu;
+  uint32_t result;
+  if (bits >= 0x4780'0000u) {
+    // xŕ\Ȃ傫Ȓl͖ɁANaNNaNɂ
+    result = 0x7c00u | ((bits > 0x7f80'0000u) ? (0x200u | ((bits >> 13) & 0x3ffu)) : 0u);
+  } else if (bits <= 0x3300'0000u) {
+    result = 0;
+  } else if (bits < 0x3880'0000u) {
+    // Kŕ\ȂȒl͔񐳋Kɂ
+    const uint32_t shift = 125u - (bits >> 23);
+    bits = 0x80'0000u | (bits & 0x7f'ffffu);
+    result = bits >> (shift + 1);
+    const uint32_t sticky = (bits & ((1u << shift) - 1)) != 0;
+    result += (result | sticky) & ((bits >> shift) & 1u);
+  } else {
+    // w̃oCAX12715ɕύX
+    bits += 0xc800'0000u;
+    result = ((bits + 0x0fffu + ((bits >> 13) & 1u)) >> 13) & 0x7fffu;
+  }
+  return static_cast<uint16_t>(result | sign);
+#endif // _WIN32
+}
+
+/**
+* ]p(WA)16bitɕϊ
+*/
+uint16_t PackRotation(float rotation)
+{
+  float t = rotation * (1.0f / XM_2PI);
+  t -= floorf(t);
+  return static_cast<uint16_t>(static_cast<uint32_t>(t * 65536.0f + 0.5f));
+}
+
+/**
+* XvCgVF[_pf[^ɕϊ(ėp)
+*
+* PackSpritesƓ
+*/
+void PackSpritesScalar(const Sprite* pSprite, const uint32_t* order, const uint32_t* texIDs,
+  const XMFLOAT4* uvRects, size_t count, float viewportHeight, SpriteInShader* p)
+{
+  PackSpritesRange(pSprite, order, texIDs, uvRects, count, viewportHeight, p);
+}
+
+/**
+* XvCgVF[_pf[^ɕϊ
+*
+* @param pSprite        XvCgz
+* @param order          `揇(nullptrȂz̏)
+* @param texIDs         XvCgƂ̃eNX`ԍ
+* @param uvRects        XvCgƂ̃eNX`͈̔
+* @param count          XvCg̐
+* @param viewportHeight r[|[g̍(Y𔽓]邽)
+* @param p              ϊʂ̏ݐ
+*/
+void PackSprites(const Sprite* pSprite, const uint32_t* order, const uint32_t* texIDs,
+  const XMFLOAT4* uvRects, size_t count, float viewportHeight, SpriteInShader* p)
+{
+#ifdef EASYLIB_X86_SIMD
+  static const bool hasAVX2 = HasAVX2();
+  if (hasAVX2) {
+    PackSpritesAVX2(pSprite, order, texIDs, uvRects, count, viewportHeight, p);
+    return;
+  }
+#endif // EASYLIB_X86_SIMD
+  PackSpritesRange(pSprite, order, texIDs, uvRects, count, viewportHeight, p);
+}
+
+/**
+* p[eBNVF[_pf[^ɕϊ(ėp)
+*
+* PackParticlesƓ
+*/
+void PackParticlesScalar(const ParticleSystem& particles, size_t count,
+  const ParticleImages& images, float viewportHeight, SpriteInShader* p)
+{
+  PackParticlesRange(particles, 0, count, images, viewportHeight, p);
+}
+
+/**
+* p[eBNVF[_pf[^ɕϊ
+*
+* @param particles      p[eBN
+* @param count          ϊp[eBN̐
+* @param images         p[eBN̉摜\
+* @param viewportHeight r[|[g̍(Y𔽓]邽)
+* @param p              ϊʂ̏ݐ
+*/
+void PackParticles(const ParticleSystem& particles, size_t count,
+  const ParticleImages& images, float viewportHeight, SpriteInShader* p)
+{
+#ifdef EASYLIB_X86_SIMD
+  static const bool hasAVX2 = HasAVX2();
+  if (hasAVX2) {
+    PackParticlesAVX2(particles, count, images, viewportHeight, p);
+    return;
+  }
+#endif // EASYLIB_X86_SIMD
+  PackParticlesRange(particles, 0, count, images, viewportHeight, p);
+}
+
+/**
+* ^C}bṽ`NVF[_pf[^ɕϊ
+*
+* W̓`N̍_ƂAYɂ
+* ̃^CƁA摜ȃ^C͏܂Ȃ
+*
+* @param tilemap    ^C}bv
+* @param cx, cy     `N̈ʒu
+* @param images     ^CԍƂ̉摜
+* @param imageCount images̗vf
+* @param p          ϊʂ̏ݐ(`N̋łȂ^C̐ȏ)
+*
+* @return 񂾃^C̐
+*/
+uint32_t PackTilemapChunk(const Tilemap& tilemap, uint32_t cx, uint32_t cy,
+  const TileImageInShader* images, size_t imageCount, SpriteInShader* p)
+{
+  const float tileWidth = tilemap.GetTileWidth();
+  const float tileHeight = tilemap.GetTileHeight();
+  const float chunkHeight = tileHeight * Tilemap::chunkSize;
+  const uint16_t* tiles = tilemap.GetChunkTiles(cx, cy);
+  const uint16_t halfWidth = PackHalf(tileWidth);
+  const uint16_t halfHeight = PackHalf(tileHeight);
+  uint32_t count = 0;
+  for (uint32_t ty = 0; ty < Tilemap::chunkSize; ++ty) {
+    const uint16_t halfY = PackHalf(chunkHeight - (static_cast<float>(ty) + 0.5f) * tileHeight);
+    for (uint32_t tx = 0; tx < Tilemap::chunkSize; ++tx) {
+      const uint16_t tile = tiles[ty * Tilemap::chunkSize + tx];
+      if (tile == Tilemap::emptyTile || tile >= imageCount || !images[tile].valid) {
+        continue;
+      }
+      const TileImageInShader& image = images[tile];
+      SpriteInShader& e = p[count++];
+      e.position[0] = PackHalf((static_cast<float>(tx) + 0.5f) * tileWidth);
+      e.position[1] = halfY;
+      e.scale[0] = halfWidth;
+      e.scale[1] = halfHeight;
+      e.rotation = 0;
+      e.texID = image.texID;
+      e.color = 0xffff'ffff;
+      memcpy(e.uvRect, image.uvRect, sizeof(e.uvRect));
+    }
+  }
+  return count;
+}
+
+} // namespace DX12
+} // namespace EasyLib
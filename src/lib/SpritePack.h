@@ -0,0 +1,71 @@
+/**
+* @file SpritePack.h
+*/
+#ifndef EASYLIB_DX12_SPRITEPACK_H
+#define EASYLIB_DX12_SPRITEPACK_H
+#include "DrawData.h"
+#include "Particle.h"
+#include "Tilemap.h"
+#include <stddef.h>
+#include <stdint.h>
+
+namespace EasyLib {
+namespace DX12 {
+
+/**
+* VF[_pXvCgf[^(24oCg)
+*
+* ʂ̑傫xȂ甼xŏ\Ȃ̂ŁAW傫͔x_Ŏ
+* Sprite.hlslSprite\̂ƈv邱
+*/
+struct SpriteInShader
+{
+  uint16_t position[2]; // x_
+  uint16_t scale[2];    // x_
+  uint16_t rotation;    // 0-65535  0-2 ɑΉ
+  uint16_t texID;
+  uint32_t color;       // RGBA8
+  uint16_t uvRect[4];   // 0-65535  0-1 ɑΉ
+};
+static_assert(sizeof(SpriteInShader) == 24, "SpriteInShader must be 24 bytes");
+
+/**
+* p[eBN̉摜\
+*/
+struct ParticleImages
+{
+  const uint16_t* texIDs;
+  const uint64_t* uvRects; // 16bit x 4
+  const float* widths;
+  const float* heights;
+};
+
+/**
+* ^C}bṽ^CԍƂ̉摜
+*/
+struct TileImageInShader
+{
+  uint16_t texID;
+  uint16_t uvRect[4];
+  bool valid; // falseȂ^C`悵Ȃ
+};
+
+uint32_t PackUnorm(float f, float scale);
+uint16_t PackHalf(float f);
+uint16_t PackRotation(float rotation);
+
+void PackSprites(const Sprite* pSprite, const uint32_t* order, const uint32_t* texIDs,
+  const DirectX::XMFLOAT4* uvRects, size_t count, float viewportHeight, SpriteInShader* p);
+void PackSpritesScalar(const Sprite* pSprite, const uint32_t* order, const uint32_t* texIDs,
+  const DirectX::XMFLOAT4* uvRects, size_t count, float viewportHeight, SpriteInShader* p);
+void PackParticles(const ParticleSystem& particles, size_t count,
+  const ParticleImages& images, float viewportHeight, SpriteInShader* p);
+void PackParticlesScalar(const ParticleSystem& particles, size_t count,
+  const ParticleImages& images, float viewportHeight, SpriteInShader* p);
+uint32_t PackTilemapChunk(const Tilemap& tilemap, uint32_t cx, uint32_t cy,
+  const TileImageInShader* images, size_t imageCount, SpriteInShader* p);
+
+} // namespace DX12
+} // namespace EasyLib
+
+#endif // EASYLIB_DX12_SPRITEPACK_H
@@ -0,0 +1,95 @@
+/**
+* @file SpriteSort.cpp
+*/
+#include "SpriteSort.h"
+#include <string.h>
+
+namespace EasyLib {
+namespace DX12 {
+
+namespace SpriteSortKey {
+
+/**
+* [x\[gL[p24bitɕϊ
+*
+* ɂ([x傫)قǏȒlɂȂ
+*
+* @param depth [x
+*/
+uint32_t FromDepth(float depth)
+{
+  // _̃rbgA召֌Wۂ܂ܕȂɕϊ
+  uint32_t u;
+  memcpy(&u, &depth, sizeof(u));
+  u = (u & 0x8000'0000u) ? ~u : (u | 0x8000'0000u);
+  // ɂȂ悤ɔ]A24bitg
+  return (~u) >> (32 - depthBits);
+}
+
+} // namespace SpriteSortKey
+
+/**
+* `揇vZ
+*
+* @param keys  XvCgƂ̃\[gL[
+* @param count XvCg̐
+*
+* ʂGetOrderŎ擾
+*/
+void SpriteSorter::Sort(const uint64_t* keys, size_t count)
+{
+  constexpr int digitBits = 8;
+  constexpr int digitCount = 64 / digitBits;
+  constexpr int firstDigit = SpriteSortKey::sequenceBits / digitBits;
+  constexpr int radix = 1 << digitBits;
+
+  passCount = 0;
+  order.resize(count);
+  for (size_t i = 0; i < count; ++i) {
+    order[i] = static_cast<uint32_t>(i);
+  }
+  if (count <= 1) {
+    return;
+  }
+
+  // ׂĂ̌̃qXgOxɍ
+  uint32_t histogram[digitCount][radix] = {};
+  for (size_t i = 0; i < count; ++i) {
+    const uint64_t key = keys[i];
+    for (int d = firstDigit; d < digitCount; ++d) {
+      ++histogram[d][(key >> (d * digitBits)) & (radix - 1)];
+    }
+  }
+
+  sortedKeys.assign(keys, keys + count);
+  tmpKeys.resize(count);
+  tmpOrder.resize(count);
+
+  // ͏̕ō\錅́A\[gȂ̂ŕבւKvȂ
+  // (͏20bitȂ̂ŁA2͔΂A3ڂ͏ʃrbg܂ނ̂ŕבւ)
+  for (int d = firstDigit; d < digitCount; ++d) {
+    const int shift = d * digitBits;
+    uint32_t* h = histogram[d];
+    if (h[(sortedKeys[0] >> shift) & (radix - 1)] == count) {
+      continue; // ׂẴL[̌œl
+    }
+    uint32_t offset = 0;
+    for (int i = 0; i < radix; ++i) {
+      const uint32_t n = h[i];
+      h[i] = offset;
+      offset += n;
+    }
+    for (size_t i = 0; i < count; ++i) {
+      const uint64_t key = sortedKeys[i];
+      const uint32_t dst = h[(key >> shift) & (radix - 1)]++;
+      tmpKeys[dst] = key;
+      tmpOrder[dst] = order[i];
+    }
+    sortedKeys.swap(tmpKeys);
+    order.swap(tmpOrder);
+    ++passCount;
+  }
+}
+
+} // namespace DX12
+} // namespace EasyLib
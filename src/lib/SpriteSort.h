@@ -0,0 +1,88 @@
+/**
+* @file SpriteSort.h
+*/
+#ifndef EASYLIB_DX12_SPRITESORT_H
+#define EASYLIB_DX12_SPRITESORT_H
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+namespace EasyLib {
+namespace DX12 {
+
+/**
+* XvCg̕`揇߂64bit̃\[gL[
+*
+* ʂ C[(8bit) | [x(24bit) | uh[h(2bit) | eNX`ԍ(10bit) | ͏(20bit)
+* L[̏ɕ`悷΁AC[Ɛ[x̏A
+* [x̒ł̓uh[hƃeNX`̐؂ւŏɂȂ
+*/
+namespace SpriteSortKey {
+
+constexpr uint32_t sequenceBits = 20;
+constexpr uint32_t textureBits = 10;
+constexpr uint32_t blendBits = 2;
+constexpr uint32_t depthBits = 24;
+constexpr uint32_t layerBits = 8;
+
+constexpr uint32_t textureShift = sequenceBits;
+constexpr uint32_t blendShift = textureShift + textureBits;
+constexpr uint32_t depthShift = blendShift + blendBits;
+constexpr uint32_t layerShift = depthShift + depthBits;
+
+uint32_t FromDepth(float depth);
+
+/**
+* \[gL[쐬
+*
+* @param layer    C[(傫قǎO)
+* @param depth    FromDepthŕϊ[x
+* @param blend    uh[h
+* @param texture  eNX`ԍ
+* @param sequence ͏(͈͊O̒l͍őlɊۂ߂)
+*/
+inline uint64_t Make(uint32_t layer, uint32_t depth, uint32_t blend, uint32_t texture, size_t sequence)
+{
+  constexpr uint64_t maxSequence = (1ull << sequenceBits) - 1;
+  const uint64_t s = sequence < maxSequence ? sequence : maxSequence;
+  return (static_cast<uint64_t>(layer & ((1u << layerBits) - 1)) << layerShift) |
+    (static_cast<uint64_t>(depth & ((1u << depthBits) - 1)) << depthShift) |
+    (static_cast<uint64_t>(blend & ((1u << blendBits) - 1)) << blendShift) |
+    (static_cast<uint64_t>(texture & ((1u << textureBits) - 1)) << textureShift) |
+    s;
+}
+
+} // namespace SpriteSortKey
+
+/**
+* 64bit̃\[gL[\[g(LSD)ŕׂNX
+*
+* 8bitʂ̌ȕzグ\[gJԂ
+* ׂẴL[œlɂȂ錅͕בւȗ
+* L[̉ʂ̓͏́̕A\[gȂ̂ŕבւȂĂۂ
+* GPUɂ͈ؐGȂ̂ŁAP̂ŃeXgx`}[Nł
+*/
+class SpriteSorter
+{
+public:
+  SpriteSorter() = default;
+  ~SpriteSorter() = default;
+
+  void Sort(const uint64_t* keys, size_t count);
+
+  const uint32_t* GetOrder() const { return order.data(); }
+  size_t GetCount() const { return order.size(); }
+  uint32_t GetPassCount() const { return passCount; }
+
+private:
+  std::vector<uint32_t> order;
+  std::vector<uint32_t> tmpOrder;
+  std::vector<uint64_t> sortedKeys;
+  std::vector<uint64_t> tmpKeys;
+  uint32_t passCount = 0; // OSortŎۂɕבւ̐
+};
+
+} // namespace DX12
+} // namespace EasyLib
+
+#endif // EASYLIB_DX12_SPRITESORT_H
@@ -0,0 +1,314 @@
+/**
+* @file TextFormat.cpp
+*/
+#include "TextFormat.h"
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+#include <charconv>
+
+namespace EasyLib {
+
+namespace /* unnamed */ {
+
+/**
+* 𐧌ĕރNX
+*
+* vsnprintfƓA߂Ȃ͎̂Ă
+*/
+class TextWriter
+{
+public:
+  TextWriter(char* buffer, size_t size) : p(buffer), end(size > 0 ? buffer + size - 1 : buffer) {}
+
+  void Put(char c) {
+    if (p < end) {
+      *p++ = c;
+    }
+  }
+  void Put(const char* s, size_t n) {
+    n = std::min(n, static_cast<size_t>(end - p));
+    memcpy(p, s, n);
+    p += n;
+  }
+  void Fill(char c, int n) {
+    for (; n > 0; --n) {
+      Put(c);
+    }
+  }
+  char* Get() const { return p; }
+
+private:
+  char* p;
+  char* end;
+};
+
+/**
+* AړA𕝂ɍ킹ď
+*
+* @param zeroPad ɑȂ𐔎̑O0Ŗ߂Ȃtrue
+*/
+void PutPadded(TextWriter& writer, const TextFormatSpec& spec, bool zeroPad,
+  const char* prefix, size_t prefixLength, const char* digits, size_t digitLength)
+{
+  const int padding = spec.width - static_cast<int>(prefixLength + digitLength);
+  if (spec.leftAlign) {
+    writer.Put(prefix, prefixLength);
+    writer.Put(digits, digitLength);
+    writer.Fill(' ', padding);
+  } else if (zeroPad) {
+    writer.Put(prefix, prefixLength);
+    writer.Fill('0', padding);
+    writer.Put(digits, digitLength);
+  } else {
+    writer.Fill(' ', padding);
+    writer.Put(prefix, prefixLength);
+    writer.Put(digits, digitLength);
+  }
+}
+
+/**
+* (%d %i %u %o %x %X)
+*/
+void PutInteger(TextWriter& writer, const TextFormatSpec& spec, const TextArg& arg)
+{
+  bool negative = false;
+  unsigned long long value;
+  const bool isSigned = spec.conversion == 'd' || spec.conversion == 'i';
+  if (arg.type == TextArg::Type::Int && isSigned) {
+    negative = arg.i < 0;
+    value = negative ? 0ull - static_cast<unsigned long long>(arg.i) : static_cast<unsigned long long>(arg.i);
+  } else {
+    // Ȃ̕ϊł́Ȃ傫̕ȂƂĈ
+    value = arg.type == TextArg::Type::Int ? static_cast<unsigned long long>(arg.i) : arg.u;
+    if (arg.size < sizeof(value)) {
+      value &= (1ull << (arg.size * 8)) - 1;
+    }
+  }
+
+  int base = 10;
+  if (spec.conversion == 'o') {
+    base = 8;
+  } else if (spec.conversion == 'x' || spec.conversion == 'X') {
+    base = 16;
+  }
+  char digits[32];
+  size_t digitLength = 0;
+  if (value != 0 || spec.precision != 0) {
+    digitLength = static_cast<size_t>(std::to_chars(digits, digits + sizeof(digits), value, base).ptr - digits);
+  }
+  if (spec.conversion == 'X') {
+    for (size_t i = 0; i < digitLength; ++i) {
+      if (digits[i] >= 'a' && digits[i] <= 'f') {
+        digits[i] = static_cast<char>(digits[i] - 'a' + 'A');
+      }
+    }
+  }
+
+  // x͍ŏ̌
+  char buffer[96];
+  size_t length = 0;
+  const size_t minDigits = std::min<size_t>(spec.precision > 0 ? spec.precision : 0, 64);
+  size_t zeroCount = minDigits > digitLength ? minDigits - digitLength : 0;
+  if (spec.alternate && spec.conversion == 'o' && zeroCount == 0 && (digitLength == 0 || digits[0] != '0')) {
+    zeroCount = 1;
+  }
+  memset(buffer, '0', zeroCount);
+  length = zeroCount;
+  memcpy(buffer + length, digits, digitLength);
+  length += digitLength;
+
+  char prefix[2];
+  size_t prefixLength = 0;
+  if (isSigned) {
+    if (negative) {
+      prefix[prefixLength++] = '-';
+    } else if (spec.plusSign) {
+      prefix[prefixLength++] = '+';
+    } else if (spec.spaceSign) {
+      prefix[prefixLength++] = ' ';
+    }
+  } else if (spec.alternate && base == 16 && value != 0) {
+    prefix[prefixLength++] = '0';
+    prefix[prefixLength++] = spec.conversion;
+  }
+  PutPadded(writer, spec, spec.zeroPad && spec.precision < 0, prefix, prefixLength, buffer, length);
+}
+
+/**
+* Œ菬_\L̎(%f %F)
+*/
+void PutFixed(TextWriter& writer, const TextFormatSpec& spec, double value)
+{
+  char buffer[384];
+  const int precision = spec.precision < 0 ? 6 : std::min(spec.precision, 64);
+  const auto result = std::to_chars(buffer, buffer + sizeof(buffer) - 1,
+    fabs(value), std::chars_format::fixed, precision);
+  size_t length = static_cast<size_t>(result.ptr - buffer);
+  if (spec.alternate && precision == 0) {
+    buffer[length++] = '.';
+  }
+
+  char prefix[1];
+  size_t prefixLength = 0;
+  if (signbit(value)) {
+    prefix[prefixLength++] = '-';
+  } else if (spec.plusSign) {
+    prefix[prefixLength++] = '+';
+  } else if (spec.spaceSign) {
+    prefix[prefixLength++] = ' ';
+  }
+  PutPadded(writer, spec, spec.zeroPad, prefix, prefixLength, buffer, length);
+}
+
+/**
+* (%s)
+*/
+void PutString(TextWriter& writer, const TextFormatSpec& spec, const char* s)
+{
+  if (!s) {
+    s = "(null)";
+  }
+  size_t length = 0;
+  if (spec.precision >= 0) {
+    while (length < static_cast<size_t>(spec.precision) && s[length]) {
+      ++length;
+    }
+  } else {
+    length = strlen(s);
+  }
+  PutPadded(writer, spec, false, nullptr, 0, s, length);
+}
+
+/**
+* snprintfŏ
+*
+* w\LȂǂ̎gppx̒ႢϊɎg
+*/
+void PutByPrintf(TextWriter& writer, const char* specBegin, const char* specEnd, const TextArg& arg)
+{
+  // Cq͈̌^ɍ킹ĕt
+  char format[32];
+  size_t length = 0;
+  for (const char* p = specBegin; p < specEnd - 1 && length < sizeof(format) - 4; ++p) {
+    if (!strchr("hlzjtLI", *p)) {
+      format[length++] = *p;
+    }
+  }
+  const char conversion = specEnd[-1];
+  if (arg.type == TextArg::Type::Int || arg.type == TextArg::Type::UInt) {
+    format[length++] = 'l';
+    format[length++] = 'l';
+  }
+  format[length++] = conversion;
+  format[length] = '\0';
+
+  char buffer[512];
+  int n = 0;
+  switch (arg.type) {
+  case TextArg::Type::Int: n = snprintf(buffer, sizeof(buffer), format, arg.i); break;
+  case TextArg::Type::UInt: n = snprintf(buffer, sizeof(buffer), format, arg.u); break;
+  case TextArg::Type::Double: n = snprintf(buffer, sizeof(buffer), format, arg.d); break;
+  case TextArg::Type::String:
+  case TextArg::Type::Pointer: n = snprintf(buffer, sizeof(buffer), format, arg.p); break;
+  default: break;
+  }
+  if (n > 0) {
+    writer.Put(buffer, std::min(static_cast<size_t>(n), sizeof(buffer) - 1));
+  }
+}
+
+} // unnamed namespace
+
+/**
+* ɏ]ĕ쐬
+*
+* printf̏߂邪Ǎ^TextArgĂ̂ŁAϒgȂ
+* AŒ菬_\L̎A̓P[ɈˑAmۂɕϊ
+* ɕϊw肪ȂAl1̏ꍇ́Ǎɐl
+* TextFormatStringŌς݂ł邱
+*
+* @param buffer ݐ
+* @param size   ݐ̃oCg(I['\0'܂)
+* @param format 
+* @param args   ̔z
+* @param count  ̐
+*
+* @return 񂾕(I['\0'܂܂Ȃ)
+*/
+size_t FormatText(char* buffer, size_t size, const char* format, const TextArg* args, size_t count)
+{
+  if (size == 0) {
+    return 0;
+  }
+  TextWriter writer(buffer, size);
+  size_t argIndex = 0;
+  for (const char* p = format; *p;) {
+    if (*p != '%') {
+      const char* q = p;
+      while (*q && *q != '%') {
+        ++q;
+      }
+      writer.Put(p, static_cast<size_t>(q - p));
+      p = q;
+      continue;
+    }
+    ++p;
+    if (*p == '%') {
+      writer.Put('%');
+      ++p;
+      continue;
+    }
+    const char* specBegin = p - 1;
+    TextFormatSpec spec;
+    p = ParseTextFormatSpec(p, spec);
+    if (!p || argIndex >= count) {
+      break; // TextFormatStringŌĂ΋NȂ
+    }
+    const TextArg& arg = args[argIndex++];
+    switch (spec.conversion) {
+    case 'd': case 'i': case 'u': case 'o': case 'x': case 'X':
+      PutInteger(writer, spec, arg);
+      break;
+    case 'c': {
+      const char c = static_cast<char>(arg.type == TextArg::Type::Int ? arg.i : static_cast<long long>(arg.u));
+      PutPadded(writer, spec, false, nullptr, 0, &c, 1);
+      break;
+    }
+    case 'f': case 'F':
+      if (isfinite(arg.d)) {
+        PutFixed(writer, spec, arg.d);
+      } else {
+        PutByPrintf(writer, specBegin, p, arg);
+      }
+      break;
+    case 's':
+      PutString(writer, spec, arg.s);
+      break;
+    default:
+      PutByPrintf(writer, specBegin, p, arg);
+      break;
+    }
+  }
+
+  // ϊw肪Ȃɐl1nꂽꍇ́Ǎɐl
+  if (argIndex == 0 && count == 1) {
+    char digits[32];
+    std::to_chars_result result = {};
+    switch (args[0].type) {
+    case TextArg::Type::Int: result = std::to_chars(digits, digits + sizeof(digits), args[0].i); break;
+    case TextArg::Type::UInt: result = std::to_chars(digits, digits + sizeof(digits), args[0].u); break;
+    case TextArg::Type::Double: result = std::to_chars(digits, digits + sizeof(digits), args[0].d); break;
+    default: break;
+    }
+    if (result.ptr) {
+      writer.Put(digits, static_cast<size_t>(result.ptr - digits));
+    }
+  }
+
+  *writer.Get() = '\0';
+  return static_cast<size_t>(writer.Get() - buffer);
+}
+
+} // namespace EasyLib
@@ -0,0 +1,212 @@
+/**
+* @file TextFormat.h
+*/
+#ifndef EASYLIB_TEXTFORMAT_H
+#define EASYLIB_TEXTFORMAT_H
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <type_traits>
+
+namespace EasyLib {
+
+/**
+* tɓn
+*
+* ^̏Ă̂ŁAprintf̂悤ɏ^𐄑KvȂ
+*/
+struct TextArg
+{
+  enum class Type : uint8_t {
+    None,
+    Int,
+    UInt,
+    Double,
+    String,
+    Pointer,
+  };
+
+  TextArg() = default;
+  template<typename T> requires (std::is_integral_v<T> && std::is_signed_v<T>)
+  TextArg(T v) : type(Type::Int), size(sizeof(T)), i(static_cast<long long>(v)) {}
+  template<typename T> requires (std::is_integral_v<T> && std::is_unsigned_v<T>)
+  TextArg(T v) : type(Type::UInt), size(sizeof(T)), u(static_cast<unsigned long long>(v)) {}
+  template<typename T> requires std::is_floating_point_v<T>
+  TextArg(T v) : type(Type::Double), d(static_cast<double>(v)) {}
+  TextArg(const char* v) : type(Type::String), s(v) {}
+  TextArg(const std::string& v) : type(Type::String), s(v.c_str()) {}
+  template<typename T> requires (!std::is_same_v<std::remove_cv_t<T>, char>)
+  TextArg(T* v) : type(Type::Pointer), p(v) {}
+
+  Type type = Type::None;
+  uint8_t size = 0; // ̃oCg(%u%xŕ̒l\ƂɎg)
+  union {
+    long long i;
+    unsigned long long u = 0;
+    double d;
+    const char* s;
+    const void* p;
+  };
+};
+
+/**
+* ^ɑΉTextArg̎
+*/
+template<typename T>
+constexpr TextArg::Type GetTextArgType()
+{
+  using U = std::remove_cvref_t<std::decay_t<T>>;
+  if constexpr (std::is_integral_v<U> && std::is_signed_v<U>) {
+    return TextArg::Type::Int;
+  } else if constexpr (std::is_integral_v<U> && std::is_unsigned_v<U>) {
+    return TextArg::Type::UInt;
+  } else if constexpr (std::is_floating_point_v<U>) {
+    return TextArg::Type::Double;
+  } else if constexpr (std::is_same_v<U, const char*> || std::is_same_v<U, char*> || std::is_same_v<U, std::string>) {
+    return TextArg::Type::String;
+  } else if constexpr (std::is_pointer_v<U>) {
+    return TextArg::Type::Pointer;
+  } else {
+    return TextArg::Type::None;
+  }
+}
+
+/**
+* ̕ϊw
+*/
+struct TextFormatSpec
+{
+  bool leftAlign = false;  // '-'
+  bool plusSign = false;   // '+'
+  bool spaceSign = false;  // ' '
+  bool alternate = false;  // '#'
+  bool zeroPad = false;    // '0'
+  int width = 0;
+  int precision = -1;      // ȗ-1
+  char conversion = 0;     // 'd'A'f'Ȃ
+};
+
+/**
+* ϊw͂
+*
+* @param p    '%'̎̕
+* @param spec ͌ʂi[ϐ
+*
+* @return ϊw̎̕. ϊw肪Ȃnullptr
+*/
+constexpr const char* ParseTextFormatSpec(const char* p, TextFormatSpec& spec)
+{
+  for (;; ++p) {
+    if (*p == '-') { spec.leftAlign = true; }
+    else if (*p == '+') { spec.plusSign = true; }
+    else if (*p == ' ') { spec.spaceSign = true; }
+    else if (*p == '#') { spec.alternate = true; }
+    else if (*p == '0') { spec.zeroPad = true; }
+    else { break; }
+  }
+  for (; *p >= '0' && *p <= '9'; ++p) {
+    spec.width = spec.width * 10 + (*p - '0');
+  }
+  if (*p == '.') {
+    spec.precision = 0;
+    for (++p; *p >= '0' && *p <= '9'; ++p) {
+      spec.precision = spec.precision * 10 + (*p - '0');
+    }
+  }
+  // Cq͈̌^番̂œǂݔ΂
+  while (*p == 'h' || *p == 'l' || *p == 'z' || *p == 'j' || *p == 't' || *p == 'L' || *p == 'I') {
+    ++p;
+  }
+  switch (*p) {
+  case 'd': case 'i': case 'u': case 'o': case 'x': case 'X': case 'c':
+  case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': case 'a': case 'A':
+  case 's': case 'p':
+    spec.conversion = *p;
+    return p + 1;
+  default:
+    return nullptr; // '*''n'Ȃǂɂ͑ΉȂ
+  }
+}
+
+/**
+* ϊwɓn̎ނǂ
+*/
+constexpr bool IsTextArgAcceptable(char conversion, TextArg::Type type)
+{
+  switch (conversion) {
+  case 'd': case 'i': case 'u': case 'o': case 'x': case 'X': case 'c':
+    return type == TextArg::Type::Int || type == TextArg::Type::UInt;
+  case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': case 'a': case 'A':
+    return type == TextArg::Type::Double;
+  case 's':
+    return type == TextArg::Type::String;
+  case 'p':
+    return type == TextArg::Type::Pointer || type == TextArg::Type::String;
+  default:
+    return false;
+  }
+}
+
+// RpC̏ŁAG[񍐂邽߂̊֐
+// consteval̒ĂԂƃRpCG[ɂȂAG[bZ[WɊ֐\
+void text_format_is_invalid();
+void text_format_has_too_few_arguments();
+void text_format_has_too_many_arguments();
+void text_format_argument_type_mismatch();
+
+/**
+* RpCɌ鏑
+*
+* printfƓg. '*'ɂ镝Ɛx̎wA%nɂ͑ΉȂ
+* ƈ̐^Ȃꍇ̓RpCG[ɂȂ
+* ɕϊw肪ȂAl1̏ꍇ́Ǎɐl\
+*/
+template<typename... Args>
+class TextFormatString
+{
+public:
+  template<typename S> requires std::is_convertible_v<const S&, const char*>
+  consteval TextFormatString(const S& s) : str(s) {
+    constexpr TextArg::Type types[] = { GetTextArgType<Args>()..., TextArg::Type::None };
+    size_t argIndex = 0;
+    for (const char* p = str; *p;) {
+      if (*p++ != '%') {
+        continue;
+      }
+      if (*p == '%') {
+        ++p;
+        continue;
+      }
+      TextFormatSpec spec;
+      p = ParseTextFormatSpec(p, spec);
+      if (!p) {
+        text_format_is_invalid();
+      }
+      if (argIndex >= sizeof...(Args)) {
+        text_format_has_too_few_arguments();
+      }
+      if (!IsTextArgAcceptable(spec.conversion, types[argIndex])) {
+        text_format_argument_type_mismatch();
+      }
+      ++argIndex;
+    }
+    if (argIndex == 0 && sizeof...(Args) == 1 &&
+      (types[0] == TextArg::Type::Int || types[0] == TextArg::Type::UInt || types[0] == TextArg::Type::Double)) {
+      return; // ̌ɐl\
+    }
+    if (argIndex != sizeof...(Args)) {
+      text_format_has_too_many_arguments();
+    }
+  }
+
+  const char* Get() const { return str; }
+
+private:
+  const char* str;
+};
+
+size_t FormatText(char* buffer, size_t size, const char* format, const TextArg* args, size_t count);
+
+} // namespace EasyLib
+
+#endif // EASYLIB_TEXTFORMAT_H
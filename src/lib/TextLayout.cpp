@@ -0,0 +1,245 @@
+/**
+* @file TextLayout.cpp
+*/
+#include "TextLayout.h"
+#include "Utf8.h"
+#include <string.h>
+#include <algorithm>
+
+namespace EasyLib {
+namespace DX12 {
+
+using namespace DirectX;
+
+namespace /* unnamed */ {
+
+/**
+* zuʂ̌ɎgnbVlvZ(FNV-1a)
+*
+* 8oCg܂Ƃ߂č
+*/
+uint64_t HashLayoutKey(const char* text, size_t length, const XMFLOAT2& scale, float maxWidth)
+{
+  constexpr uint64_t prime = 1099511628211ull;
+  uint64_t hash = 14695981039346656037ull ^ length;
+  size_t i = 0;
+  for (; i + 8 <= length; i += 8) {
+    uint64_t word;
+    memcpy(&word, text + i, sizeof(word));
+    hash = (hash ^ word) * prime;
+  }
+  if (i < length) {
+    uint64_t word = 0;
+    memcpy(&word, text + i, length - i);
+    hash = (hash ^ word) * prime;
+  }
+  uint32_t bits[3];
+  memcpy(bits, &scale, sizeof(scale));
+  memcpy(bits + 2, &maxWidth, sizeof(maxWidth));
+  for (uint32_t e : bits) {
+    hash = (hash ^ e) * prime;
+  }
+  return hash;
+}
+
+/**
+* OŐ܂ԂĂ悢ǂ(Sp)
+*/
+bool IsWideCharacter(char32_t c)
+{
+  return c >= 0x3000;
+}
+
+} // unnamed namespace
+
+/**
+* tHg̏ݒ肷
+*
+* ۑĂzuʂׂ͂Ĕj
+*
+* @param glyphTable R[h當ԍ\(TextLayout蒷݂邱)
+* @param advances   ԍƂ̑蕝(Ԋu܂). 0Ԃ͕\ɂȂɎg
+* @param lineHeight s̊Ԋu
+* @param spacing    ׂĂ̑̕蕝ɉ镶Ԋu
+*/
+void TextLayout::SetFont(const GlyphTable* glyphTable, std::vector<float>&& advances, float lineHeight, float spacing)
+{
+  this->glyphTable = glyphTable;
+  this->advances = std::move(advances);
+  if (this->advances.empty()) {
+    this->advances.push_back(0);
+  }
+  for (float& e : this->advances) {
+    e += spacing;
+  }
+  this->lineHeight = lineHeight;
+  cache.clear();
+}
+
+/**
+* zu(ʂۑ)
+*
+* Ag嗦Aő啝ŔzuƂ΁AۑʂԂ
+*
+* @param text     UTF-8̕
+* @param length   ̃oCg(r'\0'΁AŏI)
+* @param scale    g嗦
+* @param maxWidth 1s̍ő啝(0ȉȂ܂ԂȂ)
+*
+* @return zu. LayoutĂԂ܂ŗL
+*/
+const TextLayoutResult& TextLayout::Layout(const char* text, size_t length,
+  const XMFLOAT2& scale, float maxWidth)
+{
+  const uint64_t hash = HashLayoutKey(text, length, scale, maxWidth);
+  auto itr = cache.find(hash);
+  if (itr != cache.end()) {
+    Entry& e = itr->second;
+    if (e.text.size() == length && memcmp(e.text.data(), text, length) == 0 &&
+      e.scale.x == scale.x && e.scale.y == scale.y && e.maxWidth == maxWidth) {
+      e.lastUsed = useCounter;
+      ++statistics.hitCount;
+      return e.result;
+    }
+  }
+
+  ++statistics.missCount;
+  if (itr == cache.end() && cache.size() >= maxCacheCount) {
+    Compute(text, length, scale, maxWidth, scratch);
+    return scratch;
+  }
+  // nbVlՓ˂ꍇ͐Vŏ㏑
+  Entry& e = (itr != cache.end()) ? itr->second : cache[hash];
+  e.text.assign(text, length);
+  e.scale = scale;
+  e.maxWidth = maxWidth;
+  e.lastUsed = useCounter;
+  Compute(text, length, scale, maxWidth, e.result);
+  return e.result;
+}
+
+/**
+* zu(ʂۑȂ)
+*
+* LayoutƓ
+*
+* @param result zuʂi[ϐ
+*/
+void TextLayout::Compute(const char* text, size_t length,
+  const XMFLOAT2& scale, float maxWidth, TextLayoutResult& result) const
+{
+  result.lines.clear();
+  result.lineHeight = lineHeight * scale.y;
+
+  uint32_t lineBegin = 0;
+  float width = 0;          // s̐擪̕
+  uint32_t contentEnd = 0;  // Ō̋󔒈ȊO̎̈̕ʒu
+  float contentWidth = 0;   // contentEnd܂ł̕
+  bool hasBreak = false;    // ܂Ԃʒu邩
+  uint32_t breakEnd = 0;    // ܂ԂƂ̍s̏I
+  float breakWidth = 0;     // ܂ԂƂ̍s̕
+  uint32_t breakNext = 0;   // ܂ԂƂ̎̍s̐擪
+  float breakNextWidth = 0; // breakNext܂ł̕
+
+  // ܂ԂʒuŉsA̍s̐擪̕ɒ
+  const auto wrap = [&](uint32_t end, float endWidth, uint32_t next, float nextWidth) {
+    result.lines.push_back({ lineBegin, end, endWidth });
+    lineBegin = next;
+    width -= nextWidth;
+    contentWidth = std::max(contentWidth - nextWidth, 0.0f);
+    contentEnd = std::max(contentEnd, next);
+    hasBreak = false;
+  };
+
+  const char* const end = text + length;
+  char32_t prev = 0; // O̕
+  for (const char* p = text; p < end && *p;) {
+    const uint32_t i = static_cast<uint32_t>(p - text);
+    const char32_t c = DecodeUtf8(p, end);
+    const uint32_t next = static_cast<uint32_t>(p - text);
+    if (c == U'\n') {
+      result.lines.push_back({ lineBegin, contentEnd, contentWidth });
+      lineBegin = contentEnd = next;
+      width = contentWidth = 0;
+      hasBreak = false;
+      prev = c;
+      continue;
+    }
+
+    const float advance = GetAdvance(c) * scale.x;
+    if (c == U' ') {
+      // A󔒂̐擪ōsIA󔒂̌ォ玟̍sn߂
+      if (!hasBreak || breakNext != i) {
+        breakEnd = contentEnd;
+        breakWidth = contentWidth;
+      }
+      hasBreak = true;
+      width += advance;
+      breakNext = next;
+      breakNextWidth = width;
+      prev = c;
+      continue;
+    }
+
+    // Sp̑ÓA󔒂ȂĂ܂Ԃ
+    if (i > lineBegin && prev != U' ' && (IsWideCharacter(c) || IsWideCharacter(prev))) {
+      hasBreak = true;
+      breakEnd = contentEnd;
+      breakWidth = contentWidth;
+      breakNext = i;
+      breakNextWidth = width;
+    }
+
+    if (maxWidth > 0 && width + advance > maxWidth && i > lineBegin) {
+      if (hasBreak && breakNext > lineBegin) {
+        wrap(breakEnd, breakWidth, breakNext, breakNextWidth);
+      }
+      if (width + advance > maxWidth && i > lineBegin) {
+        // ܂ԂʒuȂ̂ŁȂ̕OŐ܂Ԃ
+        wrap(i, width, i, width);
+      }
+    }
+    width += advance;
+    contentEnd = next;
+    contentWidth = width;
+    prev = c;
+  }
+  result.lines.push_back({ lineBegin, std::max(contentEnd, lineBegin), contentWidth });
+
+  float maxLineWidth = 0;
+  for (const TextLine& e : result.lines) {
+    maxLineWidth = std::max(maxLineWidth, e.width);
+  }
+  result.size = XMFLOAT2(maxLineWidth, result.lineHeight * static_cast<float>(result.lines.size()));
+}
+
+/**
+* ΂炭gĂȂzuʂj
+*
+* Ăяoтɐオ1i݁AkeepCount̊ԎgȂʂj
+*/
+void TextLayout::EvictUnused(uint32_t keepCount)
+{
+  ++useCounter;
+  for (auto itr = cache.begin(); itr != cache.end();) {
+    if (useCounter - itr->second.lastUsed > keepCount) {
+      itr = cache.erase(itr);
+    } else {
+      ++itr;
+    }
+  }
+}
+
+/**
+* v擾A񐔂0ɖ߂
+*/
+TextLayoutStatistics TextLayout::TakeStatistics()
+{
+  TextLayoutStatistics s = statistics;
+  s.cachedCount = cache.size();
+  statistics = {};
+  return s;
+}
+
+} // namespace DX12
+} // namespace EasyLib
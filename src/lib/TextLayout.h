@@ -0,0 +1,126 @@
+/**
+* @file TextLayout.h
+*/
+#ifndef EASYLIB_DX12_TEXTLAYOUT_H
+#define EASYLIB_DX12_TEXTLAYOUT_H
+#include "GlyphTable.h"
+#include "PortableMath.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace EasyLib {
+namespace DX12 {
+
+/**
+* 1s
+*/
+struct TextLine
+{
+  uint32_t begin; // s̍ŏ̈̕ʒu(oCgP)
+  uint32_t end;   // s̍Ō̎̈̕ʒu(oCgP. s܂Ԃ󔒂܂܂Ȃ)
+  float width;    // s̕(sNZ)
+};
+
+/**
+* ̔zu
+*/
+struct TextLayoutResult
+{
+  std::vector<TextLine> lines;
+  DirectX::XMFLOAT2 size = { 0, 0 }; // ׂĂ̍s͂ދ`̑傫
+  float lineHeight = 0;               // s̊Ԋu
+};
+
+/**
+* s̑
+*/
+enum class TextAlign
+{
+  Left,   // \ʒu[ɂȂ
+  Center, // \ʒuɂȂ
+  Right,  // \ʒuE[ɂȂ
+};
+
+/**
+* ɍ킹āAs̍[\ʒuǂꂾ炷߂
+*/
+inline float GetAlignOffset(const TextLine& line, TextAlign align)
+{
+  switch (align) {
+  case TextAlign::Center: return -line.width * 0.5f;
+  case TextAlign::Right: return -line.width;
+  default: return 0;
+  }
+}
+
+/**
+* zu̓v
+*/
+struct TextLayoutStatistics
+{
+  size_t hitCount = 0;    // ۑʂg
+  size_t missCount = 0;   // zuvZ
+  size_t cachedCount = 0; // ۑĂ錋ʂ̐
+};
+
+/**
+* ̉sA܂ԂA傫̌vZsNX
+*
+* 1̑ŁAsƍő啝ɂ܂Ԃ̈ʒuAes̕AŜ̑傫߂
+* ܂Ԃ͋󔒂̒ォASp(U+3000ȏ)̑OōsAs̋󔒂͕Ɋ܂߂Ȃ
+* ܂ԂʒuȂ܂܍ő啝𒴂ꍇ́Ȃ̕OŐ܂Ԃ
+*
+* UTF-8ŁAs̈ʒu̓oCgPʂŕԂ
+*
+* ʂ(, g嗦, ő啝)Ƃɕۑ̂ŁAωȂ2ڈȍ~vZȂ
+* GPUɂ͐GȂ̂ŁAP̂ŃeXgł
+*/
+class TextLayout
+{
+public:
+  TextLayout() = default;
+  ~TextLayout() = default;
+  TextLayout(const TextLayout&) = delete;
+  TextLayout& operator=(const TextLayout&) = delete;
+
+  void SetFont(const GlyphTable* glyphTable, std::vector<float>&& advances, float lineHeight, float spacing);
+
+  const TextLayoutResult& Layout(const char* text, size_t length,
+    const DirectX::XMFLOAT2& scale, float maxWidth);
+  void Compute(const char* text, size_t length,
+    const DirectX::XMFLOAT2& scale, float maxWidth, TextLayoutResult& result) const;
+
+  void ClearCache() { cache.clear(); }
+  void EvictUnused(uint32_t keepCount);
+
+  // v擾A񐔂0ɖ߂
+  TextLayoutStatistics TakeStatistics();
+
+private:
+  float GetAdvance(char32_t c) const { return glyphTable ? advances[glyphTable->Find(c)] : 0.0f; }
+
+  const GlyphTable* glyphTable = nullptr;
+  std::vector<float> advances = std::vector<float>(1, 0.0f); // ԍ -> 蕝(Ԋu܂)
+  float lineHeight = 0;
+
+  struct Entry {
+    std::string text;
+    DirectX::XMFLOAT2 scale;
+    float maxWidth;
+    TextLayoutResult result;
+    uint32_t lastUsed = 0;
+  };
+  static constexpr size_t maxCacheCount = 512; // ۑ錋ʂ̍ő吔
+  std::unordered_map<uint64_t, Entry> cache;   // Ag嗦Aő啝̃nbVl -> zu
+  uint32_t useCounter = 0;      // EvictUnusedĂԂтɐi
+  TextLayoutResult scratch;     // ۑȂʂ̒uꏊ
+  TextLayoutStatistics statistics;
+};
+
+} // namespace DX12
+} // namespace EasyLib
+
+#endif // EASYLIB_DX12_TEXTLAYOUT_H
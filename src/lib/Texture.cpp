@@ -167,7 +167,7 @@ D3D12_CPU_DESCRIPTOR_HANDLE Texture::GetCPUHandle() const
 */
 uint32_t Texture::GetWidth() const
 {
-	return static_cast<uint32_t>(resource->GetDesc().Width);
+	return width;
 }
 
 /**
@@ -175,7 +175,7 @@ uint32_t Texture::GetWidth() const
 */
 uint32_t Texture::GetHeight() const
 {
-	return static_cast<uint32_t>(resource->GetDesc().Height);
+	return height;
 }
 
 /**
@@ -222,8 +222,14 @@ bool TextureLoader::Upload(const wchar_t* name, const D3D12_RESOURCE_DESC& desc,
 	tex->resource = textureResource;
 	tex->format = desc.Format;
 	tex->descriptor = device->AllocateDescriptor();
+	if (!tex->descriptor) {
+		return false;
+	}
 	tex->name = name;
+	tex->width = static_cast<uint32_t>(desc.Width);
+	tex->height = desc.Height;
 	device->CreateShaderResourceView(tex->GetResource(), nullptr, tex->descriptor->GetCPUHandle());
+	device->CommitDescriptor(*tex->descriptor);
 	textures.push_back(tex);
 
 	trackedResources.push_back(intermediateResource);
@@ -231,10 +237,80 @@ bool TextureLoader::Upload(const wchar_t* name, const D3D12_RESOURCE_DESC& desc,
 	return true;
 }
 
+/**
+* eNX`̈ꕔAbv[hq[voRŏ
+*
+* @param texture eNX`(PIXEL_SHADER_RESOURCEԂł邱)
+* @param x       ͈͂̍[
+* @param y       ͈͂̏[
+* @param desc    ރf[^̌`Ƒ傫
+* @param data    ރf[^
+*/
+bool TextureLoader::UploadRegion(const TexturePtr& texture, uint32_t x, uint32_t y,
+	const D3D12_RESOURCE_DESC& desc, const void* data)
+{
+	D3D12_PLACED_SUBRESOURCE_FOOTPRINT footprint;
+	UINT numRows;
+	UINT64 rowSize;
+	const uint64_t size = device->GetCopyableFootPrint(&desc, footprint, numRows, rowSize);
+	ComPtr<ID3D12Resource> intermediateResource =
+		device->CreateUploadResource(L"Intermediate", size);
+	if (!intermediateResource) {
+		return false;
+	}
+
+	void* p;
+	const D3D12_RANGE readRange = { 0, 0 };
+	if (FAILED(intermediateResource->Map(0, &readRange, &p))) {
+		return false;
+	}
+	const size_t bytesPerRow = static_cast<size_t>(desc.Width) * GetDXGIFormatBytesPerPixel(desc.Format);
+	for (UINT row = 0; row < numRows; ++row) {
+		memcpy(static_cast<uint8_t*>(p) + footprint.Offset + static_cast<size_t>(footprint.Footprint.RowPitch) * row,
+			static_cast<const uint8_t*>(data) + bytesPerRow * row, bytesPerRow);
+	}
+	intermediateResource->Unmap(0, nullptr);
+
+	auto barrierBefore = CD3DX12_RESOURCE_BARRIER::Transition(texture->GetResource(),
+		D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE, D3D12_RESOURCE_STATE_COPY_DEST);
+	list->ResourceBarrier(1, &barrierBefore);
+
+	const CD3DX12_TEXTURE_COPY_LOCATION dst(texture->GetResource(), 0);
+	const CD3DX12_TEXTURE_COPY_LOCATION src(intermediateResource.Get(), footprint);
+	list->CopyTextureRegion(&dst, x, y, 0, &src, nullptr);
+
+	auto barrierAfter = CD3DX12_RESOURCE_BARRIER::Transition(texture->GetResource(),
+		D3D12_RESOURCE_STATE_COPY_DEST, D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
+	list->ResourceBarrier(1, &barrierAfter);
+
+	trackedResources.push_back(intermediateResource);
+
+	return true;
+}
+
 /**
 * eNX`t@CǂݍŁAAbv[hq[vɃRs[
 */
 bool TextureLoader::UploadFromFile(const wchar_t* filename)
+{
+	D3D12_RESOURCE_DESC desc;
+	std::vector<uint8_t> imageData;
+	if (!ReadFromFile(filename, desc, imageData)) {
+		return false;
+	}
+	return Upload(filename, desc, imageData.data());
+}
+
+/**
+* eNX`t@CǂݍCPUɓWJ
+*
+* @param filename   eNX`t@C
+* @param desc       摜̌`Ƒ傫i[ϐ
+* @param imageData  摜f[^i[ϐ
+* @param forceRGBA8 trueȂDXGI_FORMAT_R8G8B8A8_UNORMɕϊ
+*/
+bool TextureLoader::ReadFromFile(const wchar_t* filename,
+	D3D12_RESOURCE_DESC& desc, std::vector<uint8_t>& imageData, bool forceRGBA8)
 {
 	ComPtr<IWICBitmapDecoder> decoder;
 	if (FAILED(imagingFactory->CreateDecoderFromFilename(
@@ -258,13 +334,20 @@ bool TextureLoader::UploadFromFile(const wchar_t* filename)
 		return false;
 	}
 
-	bool imageConverted = false;
-	ComPtr<IWICFormatConverter> converter;
-	if (dxgiFormat == DXGI_FORMAT_UNKNOWN) {
-		const WICPixelFormatGUID compatibleFormat = GetDXGICompatibleWICFormat(wicFormat);
+	// AgXɋl߂摜͌`𑵂Kv
+	WICPixelFormatGUID compatibleFormat = wicFormat;
+	if (forceRGBA8) {
+		compatibleFormat = GUID_WICPixelFormat32bppRGBA;
+	} else if (dxgiFormat == DXGI_FORMAT_UNKNOWN) {
+		compatibleFormat = GetDXGICompatibleWICFormat(wicFormat);
 		if (compatibleFormat == GUID_WICPixelFormatDontCare) {
 			return false;
 		}
+	}
+
+	bool imageConverted = false;
+	ComPtr<IWICFormatConverter> converter;
+	if (compatibleFormat != wicFormat) {
 		dxgiFormat = GetDXGIFormatFromWICFormat(compatibleFormat);
 		if (FAILED(imagingFactory->CreateFormatConverter(converter.GetAddressOf()))) {
 			return false;
@@ -285,7 +368,7 @@ bool TextureLoader::UploadFromFile(const wchar_t* filename)
 
 	const int bytesPerRow = width * GetDXGIFormatBytesPerPixel(dxgiFormat);
 	const int imageSize = bytesPerRow * height;
-	std::vector<uint8_t> imageData(imageSize);
+	imageData.resize(imageSize);
 	if (imageConverted) {
 		if (FAILED(converter->CopyPixels(nullptr, bytesPerRow, imageSize, imageData.data()))) {
 			return false;
@@ -296,8 +379,8 @@ bool TextureLoader::UploadFromFile(const wchar_t* filename)
 		}
 	}
 
-	const D3D12_RESOURCE_DESC desc = CD3DX12_RESOURCE_DESC::Tex2D(dxgiFormat, width, height, 1, 1);
-	return Upload(filename, desc, imageData.data());
+	desc = CD3DX12_RESOURCE_DESC::Tex2D(dxgiFormat, width, height, 1, 1);
+	return true;
 }
 
 /**
@@ -1,6 +1,7 @@
 #ifndef EASYLIBLIB_DX12_TEXTURE_H
 #define EASYLIBLIB_DX12_TEXTURE_H
 #include <d3d12.h>
+#include <DirectXMath.h>
 #include <wincodec.h>
 #include <wrl/client.h>
 #include <vector>
@@ -25,6 +26,7 @@ using CommandQueuePtr = std::shared_ptr<CommandQueue>;
 class Texture
 {
   friend class TextureLoader;
+  friend class TextureAtlas;
 
 public:
   ~Texture() = default;
@@ -34,6 +36,8 @@ public:
   const DescriptorPtr& GetDescriptor() const { return descriptor; }
   uint32_t GetWidth() const;
   uint32_t GetHeight() const;
+  const DirectX::XMFLOAT4& GetUVRect() const { return uvRect; }
+  const std::wstring& GetName() const { return name; }
 
 private:
   Texture() = default;
@@ -42,6 +46,9 @@ private:
   DXGI_FORMAT format;
   DescriptorPtr descriptor;
   std::wstring name;
+  uint32_t width = 0;
+  uint32_t height = 0;
+  DirectX::XMFLOAT4 uvRect = { 0, 0, 1, 1 }; // \[X̎gp͈(, , E, )
 };
 using TexturePtr = std::shared_ptr<Texture>;
 
@@ -56,6 +63,10 @@ public:
   bool Begin(DevicePtr device);
   bool Upload(const wchar_t* name, const D3D12_RESOURCE_DESC& desc, const void* data);
   bool UploadFromFile(const wchar_t* filename);
+  bool UploadRegion(const TexturePtr& texture, uint32_t x, uint32_t y,
+    const D3D12_RESOURCE_DESC& desc, const void* data);
+  bool ReadFromFile(const wchar_t* filename,
+    D3D12_RESOURCE_DESC& desc, std::vector<uint8_t>& imageData, bool forceRGBA8 = false);
   std::vector<TexturePtr> End(CommandQueuePtr queue);
 
 private:
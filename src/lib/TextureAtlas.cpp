@@ -0,0 +1,141 @@
+/**
+* @file TextureAtlas.cpp
+*/
+#define NOMINMAX
+#include "TextureAtlas.h"
+#include "Device.h"
+#include "CommandQueue.h"
+#include <d3dx12.h>
+#include <algorithm>
+
+namespace EasyLib {
+namespace DX12 {
+
+using namespace DirectX;
+
+/**
+* AgX
+*
+* @param device       D3D12foCX
+* @param queue        y[W̍XVɎgR}hL[
+*                     `撆̃y[W邽߁A`ƓL[w肷邱
+* @param pageSize     y[W̕ƍ
+* @param maxEntrySize AgXɋl߂摜̍ő̕ƍ
+*/
+bool TextureAtlas::Initialize(DevicePtr device, CommandQueuePtr queue, uint32_t pageSize, uint32_t maxEntrySize)
+{
+  this->device = device;
+  this->queue = queue;
+  this->pageSize = pageSize;
+  this->maxEntrySize = std::min(maxEntrySize, pageSize - padding * 2);
+  pages.clear();
+  return device && queue;
+}
+
+/**
+* 摜t@CǂݍŃAgXɒǉ
+*
+* @param filename 摜t@C
+*
+* @return 摜\eNX`. ǂݍ߂Ȃꍇnullptr
+*/
+TexturePtr TextureAtlas::LoadTexture(const wchar_t* filename)
+{
+  TextureLoader loader;
+  if (!loader.Begin(device)) {
+    return nullptr;
+  }
+
+  D3D12_RESOURCE_DESC desc;
+  std::vector<uint8_t> imageData;
+  if (!loader.ReadFromFile(filename, desc, imageData, true)) {
+    loader.End(queue);
+    return nullptr;
+  }
+
+  // 傫ȉ摜̓AgXɋl߂ɒPƂ̃eNX`ɂ
+  const uint32_t width = static_cast<uint32_t>(desc.Width);
+  const uint32_t height = desc.Height;
+  if (width > maxEntrySize || height > maxEntrySize) {
+    loader.Upload(filename, desc, imageData.data());
+    auto textures = loader.End(queue);
+    if (textures.empty()) {
+      return nullptr;
+    }
+    return textures[0];
+  }
+
+  // ͂̌Ԃɒ[̃sNZL΂摜
+  const uint32_t paddedWidth = width + padding * 2;
+  const uint32_t paddedHeight = height + padding * 2;
+  std::vector<uint32_t> paddedImage(static_cast<size_t>(paddedWidth) * paddedHeight);
+  const uint32_t* src = reinterpret_cast<const uint32_t*>(imageData.data());
+  for (uint32_t y = 0; y < paddedHeight; ++y) {
+    const uint32_t sy = std::min(std::max(y, padding) - padding, height - 1);
+    for (uint32_t x = 0; x < paddedWidth; ++x) {
+      const uint32_t sx = std::min(std::max(x, padding) - padding, width - 1);
+      paddedImage[y * paddedWidth + x] = src[sy * width + sx];
+    }
+  }
+
+  size_t pageIndex = 0;
+  AtlasRect rect;
+  for (; pageIndex < pages.size(); ++pageIndex) {
+    if (pages[pageIndex].packer.Pack(width, height, rect)) {
+      break;
+    }
+  }
+
+  if (pageIndex < pages.size()) {
+    const D3D12_RESOURCE_DESC regionDesc =
+      CD3DX12_RESOURCE_DESC::Tex2D(DXGI_FORMAT_R8G8B8A8_UNORM, paddedWidth, paddedHeight, 1, 1);
+    loader.UploadRegion(pages[pageIndex].texture, rect.x - padding, rect.y - padding,
+      regionDesc, paddedImage.data());
+    loader.End(queue);
+  } else {
+    // ǂ̃y[WɂȂ΁A摜񂾏Ԃ̐Vy[W
+    Page page;
+    page.packer.Reset(pageSize, pageSize, padding);
+    if (!page.packer.Pack(width, height, rect)) {
+      loader.End(queue);
+      return nullptr;
+    }
+    std::vector<uint32_t> pageImage(static_cast<size_t>(pageSize) * pageSize, 0);
+    for (uint32_t y = 0; y < paddedHeight; ++y) {
+      std::copy_n(paddedImage.data() + y * paddedWidth, paddedWidth,
+        pageImage.data() + (rect.y - padding + y) * pageSize + (rect.x - padding));
+    }
+    wchar_t pageName[] = L"Texture Atlas 0";
+    pageName[std::size(pageName) - 2] += static_cast<wchar_t>(pages.size() % 10);
+    const D3D12_RESOURCE_DESC pageDesc =
+      CD3DX12_RESOURCE_DESC::Tex2D(DXGI_FORMAT_R8G8B8A8_UNORM, pageSize, pageSize, 1, 1);
+    loader.Upload(pageName, pageDesc, pageImage.data());
+    auto textures = loader.End(queue);
+    if (textures.empty()) {
+      return nullptr;
+    }
+    page.texture = textures[0];
+    pages.push_back(std::move(page));
+  }
+
+  // y[W̃\[XLeNX`쐬
+  const Texture& pageTexture = *pages[pageIndex].texture;
+  struct Impl : Texture {};
+  auto tex = std::make_shared<Impl>();
+  tex->resource = pageTexture.resource;
+  tex->format = pageTexture.format;
+  tex->descriptor = pageTexture.descriptor;
+  tex->name = filename;
+  tex->width = width;
+  tex->height = height;
+  const float reciprocalPageSize = 1.0f / static_cast<float>(pageSize);
+  tex->uvRect = XMFLOAT4(
+    static_cast<float>(rect.x) * reciprocalPageSize,
+    static_cast<float>(rect.y) * reciprocalPageSize,
+    static_cast<float>(rect.x + width) * reciprocalPageSize,
+    static_cast<float>(rect.y + height) * reciprocalPageSize);
+  return tex;
+}
+
+} // namespace DX12
+} // namespace EasyLib
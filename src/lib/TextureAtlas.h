@@ -0,0 +1,53 @@
+/**
+* @file TextureAtlas.h
+*/
+#ifndef EASYLIB_DX12_TEXTUREATLAS_H
+#define EASYLIB_DX12_TEXTUREATLAS_H
+#include "Texture.h"
+#include "AtlasPacker.h"
+#include <vector>
+#include <memory>
+
+namespace EasyLib {
+namespace DX12 {
+
+/**
+* ȉ摜傫ȃeNX`(y[W)ɂ܂Ƃ߂NX
+*
+* LoadTextureŕԂeNX`̓y[W̃\[XƃfXNv^LA
+* GetUVRectŃy[W͈̔͂
+* maxEntrySize傫摜͒PƂ̃eNX`Ƃč쐬
+*/
+class TextureAtlas
+{
+public:
+  TextureAtlas() = default;
+  ~TextureAtlas() = default;
+  TextureAtlas(const TextureAtlas&) = delete;
+  TextureAtlas& operator=(const TextureAtlas&) = delete;
+
+  bool Initialize(DevicePtr device, CommandQueuePtr queue, uint32_t pageSize, uint32_t maxEntrySize);
+  TexturePtr LoadTexture(const wchar_t* filename);
+
+  size_t GetPageCount() const { return pages.size(); }
+  const TexturePtr& GetPage(size_t n) const { return pages[n].texture; }
+  float GetOccupancy(size_t n) const { return pages[n].packer.GetOccupancy(); }
+
+private:
+  struct Page {
+    TexturePtr texture;
+    AtlasPacker packer;
+  };
+
+  DevicePtr device;
+  CommandQueuePtr queue;
+  std::vector<Page> pages;
+  uint32_t pageSize = 1024;
+  uint32_t maxEntrySize = 256;
+  uint32_t padding = 2; // oCjAԂŗׂ̉摜ɂ܂Ȃ߂̌
+};
+
+} // namespace DX12
+} // namespace EasyLib
+
+#endif // EASYLIB_DX12_TEXTUREATLAS_H
@@ -0,0 +1,100 @@
+/**
+* @file TextureRegistry.cpp
+*/
+#include "TextureRegistry.h"
+#include "Texture.h"
+#include "Device.h"
+
+namespace EasyLib {
+namespace DX12 {
+
+/**
+* o^ׂĉ
+*
+* @param capacity o^łeNX`̍ő吔(ő65536)
+*/
+bool TextureRegistry::Init(uint32_t capacity)
+{
+  if (!slots.Init(capacity)) {
+    return false;
+  }
+  entries.assign(capacity, Entry());
+  textures.clear();
+  textures.resize(capacity);
+  return true;
+}
+
+/**
+* eNX`o^
+*
+* @param texture o^eNX`
+*
+* @return eNX`nh. o^łȂinvalidTextureHandle
+*/
+TextureHandle TextureRegistry::Register(const TexturePtr& texture)
+{
+  if (!texture || !texture->GetDescriptor()) {
+    return invalidTextureHandle;
+  }
+  const TextureHandle handle = slots.Allocate();
+  if (handle == invalidTextureHandle) {
+    return invalidTextureHandle;
+  }
+  const uint32_t index = SlotAllocator::GetIndex(handle);
+  Entry& e = entries[index];
+  e.texID = static_cast<uint32_t>(texture->GetDescriptor()->GetIndex());
+  e.width = texture->GetWidth();
+  e.height = texture->GetHeight();
+  e.uvRect = texture->GetUVRect();
+  textures[index] = texture;
+  return handle;
+}
+
+/**
+* eNX`̓o^
+*
+* @param handle eNX`̃nh
+*
+* @retval true  
+* @retval false nh
+*/
+bool TextureRegistry::Unregister(TextureHandle handle)
+{
+  if (!slots.Free(handle)) {
+    return false;
+  }
+  const uint32_t index = SlotAllocator::GetIndex(handle);
+  entries[index] = Entry();
+  textures[index].reset();
+  return true;
+}
+
+/**
+* `ɕKvȏ擾
+*
+* @return nhLȂEntrỹAhXAȂnullptr
+*/
+const TextureRegistry::Entry* TextureRegistry::Find(TextureHandle handle) const
+{
+  if (!slots.IsValid(handle)) {
+    return nullptr;
+  }
+  return &entries[SlotAllocator::GetIndex(handle)];
+}
+
+/**
+* eNX`擾
+*
+* @return nhLȂeNX`AȂnullptr
+*/
+const TexturePtr& TextureRegistry::GetTexture(TextureHandle handle) const
+{
+  static const TexturePtr nullTexture;
+  if (!slots.IsValid(handle)) {
+    return nullTexture;
+  }
+  return textures[SlotAllocator::GetIndex(handle)];
+}
+
+} // namespace DX12
+} // namespace EasyLib
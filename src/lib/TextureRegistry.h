@@ -0,0 +1,67 @@
+/**
+* @file TextureRegistry.h
+*/
+#ifndef EASYLIB_DX12_TEXTUREREGISTRY_H
+#define EASYLIB_DX12_TEXTUREREGISTRY_H
+#include "SlotAllocator.h"
+#include "PortableMath.h"
+#include <stdint.h>
+#include <vector>
+#include <memory>
+
+namespace EasyLib {
+namespace DX12 {
+
+class Texture;
+using TexturePtr = std::shared_ptr<Texture>;
+
+/**
+* eNX`nh
+*
+* 16bito^ԍA16bitԍ. 0͖ȃnh
+* o^nh͐ԍȂȂ̂ŖɂȂ
+*/
+using TextureHandle = uint32_t;
+constexpr TextureHandle invalidTextureHandle = SlotAllocator::invalidHandle;
+
+/**
+* eNX`nhŊǗNX
+*
+* eNX`̏L͂̃NX̂ŁAXvCgȂǂ̓nhĂ΂悢
+* `ɕKvȏEntryɂ܂Ƃ߂ĂAnh璼ڈ
+*/
+class TextureRegistry
+{
+public:
+  // `掞ɎQƂ
+  struct Entry {
+    uint32_t texID = 0;  // VF[_猩eNX`ԍ
+    uint32_t width = 0;  // 摜̕
+    uint32_t height = 0; // 摜̍
+    DirectX::XMFLOAT4 uvRect = { 0, 0, 1, 1 }; // eNX`͈̔(, , E, )
+  };
+
+  TextureRegistry() = default;
+  ~TextureRegistry() = default;
+  TextureRegistry(const TextureRegistry&) = delete;
+  TextureRegistry& operator=(const TextureRegistry&) = delete;
+
+  bool Init(uint32_t capacity);
+  TextureHandle Register(const TexturePtr& texture);
+  bool Unregister(TextureHandle handle);
+
+  bool IsValid(TextureHandle handle) const { return slots.IsValid(handle); }
+  const Entry* Find(TextureHandle handle) const;
+  const TexturePtr& GetTexture(TextureHandle handle) const;
+  uint32_t GetCount() const { return slots.GetUsedCount(); }
+
+private:
+  SlotAllocator slots;
+  std::vector<Entry> entries;
+  std::vector<TexturePtr> textures;
+};
+
+} // namespace DX12
+} // namespace EasyLib
+
+#endif // EASYLIB_DX12_TEXTUREREGISTRY_H
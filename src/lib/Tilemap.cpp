@@ -0,0 +1,197 @@
+/**
+* @file Tilemap.cpp
+*/
+#include "Tilemap.h"
+#include <algorithm>
+#include <atomic>
+#include <math.h>
+
+namespace EasyLib {
+
+namespace /* unnamed */ {
+
+std::atomic<uint32_t> serialCounter = 0; // InitŊ蓖Ă鎯ʔԍ
+
+} // unnamed namespace
+
+/**
+* ^C}bv
+*
+* ׂẴ^C͋ɂȂA^Cԍ̕\
+*
+* @param width      }bv̕(^C)
+* @param height     }bv̍(^C)
+* @param tileWidth  ^C̕(sNZ)
+* @param tileHeight ^C̍(sNZ)
+*
+* `N̍W͔x_ŃVF[_ɑ̂ŁA
+* ^C̑傫͋64sNZȉɂƁA^C̈ʒumɕ\
+*/
+bool Tilemap::Init(uint32_t width, uint32_t height, float tileWidth, float tileHeight)
+{
+  if (width == 0 || height == 0 || !(tileWidth > 0) || !(tileHeight > 0)) {
+    return false;
+  }
+  this->width = width;
+  this->height = height;
+  this->tileWidth = tileWidth;
+  this->tileHeight = tileHeight;
+  chunkCountX = (width + chunkSize - 1) / chunkSize;
+  chunkCountY = (height + chunkSize - 1) / chunkSize;
+  chunks.assign(static_cast<size_t>(chunkCountX) * chunkCountY, Chunk());
+  for (Chunk& e : chunks) {
+    e.tiles.assign(chunkSize * chunkSize, emptyTile);
+  }
+  tileImages.clear();
+  serial = ++serialCounter;
+  return true;
+}
+
+/**
+* ^Cԍɉ摜蓖Ă
+*
+* @param image 摜(eNX`nh)
+*
+* @return 蓖Ă^Cԍ. ԍȂemptyTile
+*/
+uint16_t Tilemap::AddTileImage(uint32_t image)
+{
+  if (tileImages.size() >= UINT16_MAX) {
+    return emptyTile;
+  }
+  tileImages.push_back(image);
+  // 摜Ȃԍ̃^C\悤ɂȂ̂ŁAׂẴ`N蒼
+  for (Chunk& e : chunks) {
+    ++e.version;
+  }
+  return static_cast<uint16_t>(tileImages.size());
+}
+
+/**
+* ^Cԍ̉摜擾
+*
+* @return 摜(eNX`nh). 蓖ĂĂȂ0
+*/
+uint32_t Tilemap::GetTileImage(uint16_t tile) const
+{
+  if (tile == emptyTile || tile > tileImages.size()) {
+    return 0;
+  }
+  return tileImages[tile - 1];
+}
+
+/**
+* ^Cݒ肷
+*
+* ͈͊O̍W͖. lςꍇ`N̍XVԍi
+*/
+void Tilemap::SetTile(uint32_t x, uint32_t y, uint16_t tile)
+{
+  if (x >= width || y >= height) {
+    return;
+  }
+  Chunk& chunk = GetChunk(x, y);
+  uint16_t& e = chunk.tiles[(y % chunkSize) * chunkSize + x % chunkSize];
+  if (e == tile) {
+    return;
+  }
+  if (e != emptyTile) {
+    --chunk.tileCount;
+  }
+  if (tile != emptyTile) {
+    ++chunk.tileCount;
+  }
+  e = tile;
+  ++chunk.version;
+}
+
+/**
+* `͈̔͂𓯂^CŖ߂
+*/
+void Tilemap::Fill(uint32_t x, uint32_t y, uint32_t width, uint32_t height, uint16_t tile)
+{
+  const uint32_t right = std::min(x + width, this->width);
+  const uint32_t bottom = std::min(y + height, this->height);
+  for (uint32_t ty = y; ty < bottom; ++ty) {
+    for (uint32_t tx = x; tx < right; ++tx) {
+      SetTile(tx, ty, tile);
+    }
+  }
+}
+
+/**
+* ^C擾
+*
+* @return ^Cԍ. ͈͊OȂemptyTile
+*/
+uint16_t Tilemap::GetTile(uint32_t x, uint32_t y) const
+{
+  if (x >= width || y >= height) {
+    return emptyTile;
+  }
+  return GetChunk(x, y).tiles[(y % chunkSize) * chunkSize + x % chunkSize];
+}
+
+/**
+* `Ñ^Cz擾
+*
+* }bv̒[̃`NŁA}bv̊Oɂ镔͋̃^CɂȂĂ
+*/
+const uint16_t* Tilemap::GetChunkTiles(uint32_t cx, uint32_t cy) const
+{
+  return chunks[cy * chunkCountX + cx].tiles.data();
+}
+
+/**
+* `N̍XVԍ擾
+*
+* ^CύX邽тɒlς̂ŁAۑĂlƔׂ΍蒼Kv
+*/
+uint32_t Tilemap::GetChunkVersion(uint32_t cx, uint32_t cy) const
+{
+  return chunks[cy * chunkCountX + cx].version;
+}
+
+/**
+* `N̋łȂ^C̐擾
+*/
+uint32_t Tilemap::GetChunkTileCount(uint32_t cx, uint32_t cy) const
+{
+  return chunks[cy * chunkCountX + cx].tileCount;
+}
+
+/**
+* ʂɓ`N͈̔͂߂
+*
+* ɌJԂꍇAX͈̔͂̓}bv̊O(̒l`Nȏ)ɂȂ邱Ƃ
+* ̏ꍇ̓`NŊ]肪ۂ̃`NɂȂ
+*
+* @param scrollX    ʂ̍ɕ\}bv̍W
+* @param scrollY
+* @param viewWidth  ʂ̕
+* @param viewHeight ʂ̍
+* @param firstX     ͈͂̍ŏ̃`N(X)i[ϐ
+* @param firstY     ͈͂̍ŏ̃`N(Y)i[ϐ
+* @param lastX      ͈͂̍Ō̃`N(X. ͈͂Ɋ܂)i[ϐ
+* @param lastY      ͈͂̍Ō̃`N(Y. ͈͂Ɋ܂)i[ϐ
+*
+* ʂɓ`NȂ firstX > lastX ܂ firstY > lastY ɂȂ
+*/
+void Tilemap::GetVisibleChunks(float scrollX, float scrollY, float viewWidth, float viewHeight,
+  int& firstX, int& firstY, int& lastX, int& lastY) const
+{
+  const float chunkWidth = tileWidth * chunkSize;
+  const float chunkHeight = tileHeight * chunkSize;
+  firstX = static_cast<int>(floorf(scrollX / chunkWidth));
+  lastX = static_cast<int>(ceilf((scrollX + viewWidth) / chunkWidth)) - 1;
+  firstY = static_cast<int>(floorf(scrollY / chunkHeight));
+  lastY = static_cast<int>(ceilf((scrollY + viewHeight) / chunkHeight)) - 1;
+  firstY = std::max(firstY, 0);
+  lastY = std::min(lastY, static_cast<int>(chunkCountY) - 1);
+  if (!wrapX) {
+    firstX = std::max(firstX, 0);
+    lastX = std::min(lastX, static_cast<int>(chunkCountX) - 1);
+  }
+}
+
+} // namespace EasyLib
@@ -0,0 +1,85 @@
+/**
+* @file Tilemap.h
+*/
+#ifndef EASYLIB_TILEMAP_H
+#define EASYLIB_TILEMAP_H
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+namespace EasyLib {
+
+/**
+* 傫̃^Ciqɕׂ}bv
+*
+* ^C̓^Cԍ(1ȏ. 0͉Ȃ)ŎAԍƂ̉摜(eNX`nh)͕ʂ̕\ŊǗ
+* }bvchunkSize x chunkSize^C̃`NɕĊi[A`NƂɍXVԍ
+* SpriteRenderer::SubmitTilemaṕAʂɓ`NVF[_pf[^ɕϊĕۑA
+* XVԍς܂ōėp. XN[͕`ʒu炷ŁAf[^͍蒼Ȃ
+* Wn̓XvCgƓ(Y͉)ŁA}bv̍オ(0, 0)
+* GPUɂ͈ؐGȂ̂ŁAP̂ŃeXgł
+*/
+class Tilemap
+{
+public:
+  static constexpr uint32_t chunkSize = 32; // `N̕ƍ(^C)
+  static constexpr uint16_t emptyTile = 0;
+
+  Tilemap() = default;
+  ~Tilemap() = default;
+
+  bool Init(uint32_t width, uint32_t height, float tileWidth, float tileHeight);
+
+  // ^CԍƉ摜
+  uint16_t AddTileImage(uint32_t image);
+  uint32_t GetTileImage(uint16_t tile) const;
+  size_t GetTileImageCount() const { return tileImages.size(); }
+
+  // ^C
+  void SetTile(uint32_t x, uint32_t y, uint16_t tile);
+  void Fill(uint32_t x, uint32_t y, uint32_t width, uint32_t height, uint16_t tile);
+  uint16_t GetTile(uint32_t x, uint32_t y) const;
+
+  // ɌJԂǂ
+  void SetWrapX(bool wrap) { wrapX = wrap; }
+  bool GetWrapX() const { return wrapX; }
+
+  uint32_t GetWidth() const { return width; }
+  uint32_t GetHeight() const { return height; }
+  float GetTileWidth() const { return tileWidth; }
+  float GetTileHeight() const { return tileHeight; }
+  uint32_t GetSerial() const { return serial; } // Init̂тɕς鎯ʔԍ
+
+  // `N
+  uint32_t GetChunkCountX() const { return chunkCountX; }
+  uint32_t GetChunkCountY() const { return chunkCountY; }
+  const uint16_t* GetChunkTiles(uint32_t cx, uint32_t cy) const; // chunkSize x chunkSizeAsD
+  uint32_t GetChunkVersion(uint32_t cx, uint32_t cy) const;
+  uint32_t GetChunkTileCount(uint32_t cx, uint32_t cy) const; // łȂ^C̐
+  void GetVisibleChunks(float scrollX, float scrollY, float viewWidth, float viewHeight,
+    int& firstX, int& firstY, int& lastX, int& lastY) const;
+
+private:
+  struct Chunk {
+    std::vector<uint16_t> tiles;
+    uint32_t version = 1;
+    uint32_t tileCount = 0;
+  };
+  Chunk& GetChunk(uint32_t x, uint32_t y) { return chunks[(y / chunkSize) * chunkCountX + x / chunkSize]; }
+  const Chunk& GetChunk(uint32_t x, uint32_t y) const { return chunks[(y / chunkSize) * chunkCountX + x / chunkSize]; }
+
+  uint32_t width = 0;  // }bv̕(^C)
+  uint32_t height = 0; // }bv̍(^C)
+  float tileWidth = 0;  // ^C̕(sNZ)
+  float tileHeight = 0; // ^C̍(sNZ)
+  uint32_t chunkCountX = 0;
+  uint32_t chunkCountY = 0;
+  bool wrapX = false;
+  uint32_t serial = 0;
+  std::vector<Chunk> chunks;
+  std::vector<uint32_t> tileImages; // ^Cԍ-1 -> 摜
+};
+
+} // namespace EasyLib
+
+#endif // EASYLIB_TILEMAP_H
@@ -0,0 +1,140 @@
+/**
+* @file UploadRing.cpp
+*/
+#define NOMINMAX
+#include "UploadRing.h"
+#include <d3dx12.h>
+#include <algorithm>
+
+namespace EasyLib {
+namespace DX12 {
+
+/**
+* Abv[hO
+*
+* @param device   D3D12foCX
+* @param capacity ŏɊmۂoCg
+*/
+bool UploadRing::Init(ID3D12Device* device, uint64_t capacity)
+{
+  this->device = device;
+  retiredBuffers.clear();
+  growCount = 0;
+  return CreateBuffer(capacity);
+}
+
+/**
+* t[̊Jn
+*
+* @param completedFenceValue GPUtFXl
+*/
+void UploadRing::BeginFrame(uint64_t completedFenceValue)
+{
+  ring.Retire(completedFenceValue);
+  retiredBuffers.erase(std::remove_if(retiredBuffers.begin(), retiredBuffers.end(),
+    [completedFenceValue](const RetiredBuffer& e) { return e.fenceValue <= completedFenceValue; }),
+    retiredBuffers.end());
+}
+
+/**
+* ݂̃t[Ŏg̈m
+*
+* @param size      mۂoCg
+* @param alignment 擪ʒũACg(2̗ݏ)
+*
+* @return mۂ̈. sꍇcpuAddressnullptr
+*/
+UploadAllocation UploadRing::Allocate(uint64_t size, uint64_t alignment)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  uint64_t offset = ring.Allocate(size, alignment);
+  if (offset == RingAllocator::invalidOffset) {
+    // ȂΔ{Xő傫ȃobt@ɍ蒼
+    // ݂̃obt@͂̃t[łgĂ̂ŁAEndFramẽtFXl܂ŎcĂ
+    uint64_t newCapacity = std::max<uint64_t>(ring.GetCapacity(), defaultAlignment);
+    while (newCapacity < size + alignment) {
+      newCapacity *= 2;
+    }
+    newCapacity *= 2;
+    retiredBuffers.push_back({ buffer, UINT64_MAX });
+    if (!CreateBuffer(newCapacity)) {
+      return {};
+    }
+    ++growCount;
+    offset = ring.Allocate(size, alignment);
+    if (offset == RingAllocator::invalidOffset) {
+      return {};
+    }
+  }
+
+  UploadAllocation a;
+  a.cpuAddress = mappedAddress + offset;
+  a.gpuAddress = buffer->GetGPUVirtualAddress() + offset;
+  a.size = size;
+  return a;
+}
+
+/**
+* t[̏I
+*
+* @param fenceValue ̃t[̃R}hXgsƂ̃tFXl
+*/
+void UploadRing::EndFrame(uint64_t fenceValue)
+{
+  ring.FinishFrame(fenceValue);
+  for (auto& e : retiredBuffers) {
+    if (e.fenceValue == UINT64_MAX) {
+      e.fenceValue = fenceValue;
+    }
+  }
+}
+
+/**
+* ݂̃t[GPȔIĂ烊\[Xj
+*
+* `ɎgȂ\[XAɔjɍς܂邽߂Ɏg
+*
+* @param resource j郊\[X
+*/
+void UploadRing::DeferRelease(Microsoft::WRL::ComPtr<ID3D12Resource> resource)
+{
+  if (resource) {
+    std::lock_guard<std::mutex> lock(mutex);
+    retiredBuffers.push_back({ std::move(resource), UINT64_MAX });
+  }
+}
+
+/**
+* obt@쐬ă}bv
+*
+* @param capacity oCg
+*/
+bool UploadRing::CreateBuffer(uint64_t capacity)
+{
+  buffer.Reset();
+  mappedAddress = nullptr;
+  ring.Init(0);
+
+  const CD3DX12_HEAP_PROPERTIES properties(D3D12_HEAP_TYPE_UPLOAD);
+  const CD3DX12_RESOURCE_DESC desc = CD3DX12_RESOURCE_DESC::Buffer(capacity);
+  if (FAILED(device->CreateCommittedResource(
+    &properties, D3D12_HEAP_FLAG_NONE, &desc, D3D12_RESOURCE_STATE_GENERIC_READ, nullptr,
+    IID_PPV_ARGS(&buffer)))) {
+    return false;
+  }
+  buffer->SetName(L"Upload Ring");
+
+  // UPLOADq[v͔j܂Ń}bv܂܂ł悢
+  void* p;
+  const D3D12_RANGE range = { 0, 0 };
+  if (FAILED(buffer->Map(0, &range, &p))) {
+    buffer.Reset();
+    return false;
+  }
+  mappedAddress = static_cast<uint8_t*>(p);
+  ring.Init(capacity);
+  return true;
+}
+
+} // namespace DX12
+} // namespace EasyLib
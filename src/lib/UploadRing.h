@@ -0,0 +1,83 @@
+/**
+* @file UploadRing.h
+*/
+#ifndef EASYLIB_DX12_UPLOADRING_H
+#define EASYLIB_DX12_UPLOADRING_H
+#include "RingAllocator.h"
+#include <d3d12.h>
+#include <wrl/client.h>
+#include <stdint.h>
+#include <vector>
+#include <mutex>
+
+namespace EasyLib {
+namespace DX12 {
+
+/**
+* Abv[hOmۂ̈
+*/
+struct UploadAllocation
+{
+  void* cpuAddress = nullptr;               // ݐ
+  D3D12_GPU_VIRTUAL_ADDRESS gpuAddress = 0; // VF[_QƂAhX
+  uint64_t size = 0;
+
+  explicit operator bool() const { return cpuAddress != nullptr; }
+};
+
+/**
+* t[Ƃ̓Iȃf[^uAbv[hobt@
+*
+* obt@͏Ƀ}bv܂܂ɂĂAt[ƂɕKvȂ؂oĎg
+* mۂłȂꍇ͂傫ȃobt@蒼A
+* Âobt@GPUgI܂ŕێĂj
+*
+* 1t[̗:
+* - BeginFrame(ς݂̃tFXl)
+* - AllocateŊmۂ̈Ƀf[^݁AgpuAddressR}hXgɐݒ
+* - R}hXgsAEndFrame(̃tFXl)
+*
+* AllocateDeferReleaséÃXbh瓯ɌĂł悢
+*/
+class UploadRing
+{
+public:
+  static constexpr uint64_t defaultAlignment = 256;
+
+  UploadRing() = default;
+  ~UploadRing() = default;
+  UploadRing(const UploadRing&) = delete;
+  UploadRing& operator=(const UploadRing&) = delete;
+
+  bool Init(ID3D12Device* device, uint64_t capacity);
+  void BeginFrame(uint64_t completedFenceValue);
+  UploadAllocation Allocate(uint64_t size, uint64_t alignment = defaultAlignment);
+  void EndFrame(uint64_t fenceValue);
+  void DeferRelease(Microsoft::WRL::ComPtr<ID3D12Resource> resource);
+
+  uint64_t GetCapacity() const { return ring.GetCapacity(); }
+  uint64_t GetUsedSize() const { return ring.GetUsedSize(); }
+  size_t GetGrowCount() const { return growCount; }
+
+private:
+  bool CreateBuffer(uint64_t capacity);
+
+  Microsoft::WRL::ComPtr<ID3D12Device> device;
+  Microsoft::WRL::ComPtr<ID3D12Resource> buffer;
+  uint8_t* mappedAddress = nullptr;
+  RingAllocator ring;
+
+  // 蒼ȂǂŎgȂȂobt@. GPUgIj
+  struct RetiredBuffer {
+    Microsoft::WRL::ComPtr<ID3D12Resource> buffer;
+    uint64_t fenceValue; // ̃tFXlɒBjł(EndFrame܂łUINT64_MAX)
+  };
+  std::vector<RetiredBuffer> retiredBuffers;
+  size_t growCount = 0;
+  std::mutex mutex; // AllocateADeferRelease̔rp
+};
+
+} // namespace DX12
+} // namespace EasyLib
+
+#endif // EASYLIB_DX12_UPLOADRING_H
@@ -0,0 +1,209 @@
+/**
+* @file Utf8.cpp
+*/
+#include "Utf8.h"
+#include <bit>
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#include <emmintrin.h>
+#define EASYLIB_UTF8_SSE2
+#endif
+
+namespace EasyLib {
+
+/**
+* UTF-82`4oCg̕1o
+*
+* ̃oCg͕sƂāA擪1oCgǂݔ΂replacementCharacterԂ
+* - 擪ɎgȂoCg(0x80`0xC1A0xF5`0xFF)
+* - ̃oCgȂA܂10xxxxxxłȂ
+* - 璷ȕ\ATQ[g(U+D800`U+DFFF)AU+10FFFF𒴂镶R[h
+*
+* @param p   oʒu. ̈̕ʒuɐi
+* @param end ̏I[(p < endł邱)
+*
+* @return R[h
+*/
+char32_t DecodeUtf8Sequence(const char*& p, const char* end)
+{
+  const uint8_t* s = reinterpret_cast<const uint8_t*>(p);
+  const size_t available = static_cast<size_t>(end - p);
+  const uint8_t c = s[0];
+  if (c < 0x80) {
+    ++p;
+    return c;
+  }
+
+  // {̕(U+1000`U+CFFFAU+E000`U+FFFF)̂قƂǂ́A2oCgڂɔ͈͂̐Ȃ3oCg̕
+  if (c >= 0xe1 && c <= 0xef && c != 0xed && available >= 3 &&
+    (s[1] & 0xc0) == 0x80 && (s[2] & 0xc0) == 0x80) {
+    p += 3;
+    return (static_cast<char32_t>(c & 0x0f) << 12) | (static_cast<char32_t>(s[1] & 0x3f) << 6) | (s[2] & 0x3f);
+  }
+
+  // 2oCgڂ͈̔͂́A璷ȕ\TQ[g߂ɐ擪̃oCgƂɈقȂ
+  size_t length;
+  uint8_t secondMin = 0x80;
+  uint8_t secondMax = 0xbf;
+  char32_t code;
+  if (c >= 0xc2 && c <= 0xdf) {
+    length = 2;
+    code = c & 0x1f;
+  } else if (c >= 0xe0 && c <= 0xef) {
+    length = 3;
+    code = c & 0x0f;
+    if (c == 0xe0) {
+      secondMin = 0xa0;
+    } else if (c == 0xed) {
+      secondMax = 0x9f;
+    }
+  } else if (c >= 0xf0 && c <= 0xf4) {
+    length = 4;
+    code = c & 0x07;
+    if (c == 0xf0) {
+      secondMin = 0x90;
+    } else if (c == 0xf4) {
+      secondMax = 0x8f;
+    }
+  } else {
+    ++p;
+    return replacementCharacter;
+  }
+
+  if (available < length || s[1] < secondMin || s[1] > secondMax) {
+    ++p;
+    return replacementCharacter;
+  }
+  code = (code << 6) | (s[1] & 0x3f);
+  for (size_t i = 2; i < length; ++i) {
+    if ((s[i] & 0xc0) != 0x80) {
+      ++p;
+      return replacementCharacter;
+    }
+    code = (code << 6) | (s[i] & 0x3f);
+  }
+  p += length;
+  return code;
+}
+
+/**
+* 擪瑱ASCII̐𒲂ׂ
+*
+* SSE2gꍇ16oCgŏʃrbg𒲂ׂ
+*
+* @param p      
+* @param length ̃oCg
+*
+* @return 擪瑱ASCII̐
+*/
+size_t CountAsciiRun(const char* p, size_t length)
+{
+  size_t i = 0;
+#ifdef EASYLIB_UTF8_SSE2
+  // {̕ł͐擪ASCIIłȂƂ̂ŁA܂1oCgׂ
+  if (length == 0 || static_cast<uint8_t>(p[0]) >= 0x80) {
+    return 0;
+  }
+  for (; i + 16 <= length; i += 16) {
+    const int mask = _mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i)));
+    if (mask) {
+      return i + std::countr_zero(static_cast<unsigned>(mask));
+    }
+  }
+#endif // EASYLIB_UTF8_SSE2
+  for (; i < length && static_cast<uint8_t>(p[i]) < 0x80; ++i) {
+  }
+  return i;
+}
+
+/**
+* UTF-8̕𕶎R[h̔zɕϊ
+*
+* ASCIÍASSE2gꍇ16oCgׁA1oCg1Ƃď
+* ASCIIȊO̕Ԃ́AASCIIT1
+* ({͂̕ł́AASCII͉s␔ȂǒẐA16oCgׂƒxȂ邽)
+*
+* @param text   
+* @param length ̃oCg
+* @param out    ݐ(lengthvfȏ)
+*
+* @return 񂾕
+*/
+size_t DecodeUtf8(const char* text, size_t length, char32_t* out)
+{
+  const char* p = text;
+  const char* const end = text + length;
+  char32_t* q = out;
+  while (p < end) {
+    if (static_cast<uint8_t>(*p) >= 0x80) {
+      // {̕Ԃ́A3oCg̏̕ŕ(ȊODecodeUtf8SequenceŌ)
+      do {
+        const uint8_t* s = reinterpret_cast<const uint8_t*>(p);
+        if (end - p >= 3 && s[0] >= 0xe1 && s[0] <= 0xef && s[0] != 0xed &&
+          ((s[1] | (s[2] << 8)) & 0xc0c0) == 0x8080) {
+          *q++ = (static_cast<char32_t>(s[0] & 0x0f) << 12) | (static_cast<char32_t>(s[1] & 0x3f) << 6) | (s[2] & 0x3f);
+          p += 3;
+        } else {
+          *q++ = DecodeUtf8Sequence(p, end);
+        }
+      } while (p < end && static_cast<uint8_t>(*p) >= 0x80);
+      continue;
+    }
+#ifdef EASYLIB_UTF8_SSE2
+    // 16oCgׂĕR[hɍLď݁AASCII̐i߂
+    // ݐlengthvfȏ゠Aqpɐi܂Ȃ̂ŁA16vfł͈͓Ɏ܂
+    const __m128i zero = _mm_setzero_si128();
+    while (end - p >= 16) {
+      const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+      const __m128i lo = _mm_unpacklo_epi8(v, zero);
+      const __m128i hi = _mm_unpackhi_epi8(v, zero);
+      __m128i* dst = reinterpret_cast<__m128i*>(q);
+      _mm_storeu_si128(dst + 0, _mm_unpacklo_epi16(lo, zero));
+      _mm_storeu_si128(dst + 1, _mm_unpackhi_epi16(lo, zero));
+      _mm_storeu_si128(dst + 2, _mm_unpacklo_epi16(hi, zero));
+      _mm_storeu_si128(dst + 3, _mm_unpackhi_epi16(hi, zero));
+      const int mask = _mm_movemask_epi8(v);
+      if (mask) {
+        const int n = std::countr_zero(static_cast<unsigned>(mask));
+        p += n;
+        q += n;
+        break;
+      }
+      p += 16;
+      q += 16;
+    }
+#endif // EASYLIB_UTF8_SSE2
+    while (p < end && static_cast<uint8_t>(*p) < 0x80) {
+      *q++ = static_cast<uint8_t>(*p++);
+    }
+  }
+  return static_cast<size_t>(q - out);
+}
+
+/**
+* R[hUTF-8Œǉ
+*
+* TQ[gU+10FFFF𒴂镶R[hreplacementCharacterɂ
+*/
+void AppendUtf8(std::string& s, char32_t c)
+{
+  if ((c >= 0xd800 && c <= 0xdfff) || c > 0x10ffff) {
+    c = replacementCharacter;
+  }
+  if (c < 0x80) {
+    s.push_back(static_cast<char>(c));
+  } else if (c < 0x800) {
+    s.push_back(static_cast<char>(0xc0 | (c >> 6)));
+    s.push_back(static_cast<char>(0x80 | (c & 0x3f)));
+  } else if (c < 0x10000) {
+    s.push_back(static_cast<char>(0xe0 | (c >> 12)));
+    s.push_back(static_cast<char>(0x80 | ((c >> 6) & 0x3f)));
+    s.push_back(static_cast<char>(0x80 | (c & 0x3f)));
+  } else {
+    s.push_back(static_cast<char>(0xf0 | (c >> 18)));
+    s.push_back(static_cast<char>(0x80 | ((c >> 12) & 0x3f)));
+    s.push_back(static_cast<char>(0x80 | ((c >> 6) & 0x3f)));
+    s.push_back(static_cast<char>(0x80 | (c & 0x3f)));
+  }
+}
+
+} // namespace EasyLib
@@ -0,0 +1,41 @@
+/**
+* @file Utf8.h
+*/
+#ifndef EASYLIB_UTF8_H
+#define EASYLIB_UTF8_H
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+
+namespace EasyLib {
+
+constexpr char32_t replacementCharacter = 0xfffd; // sȃoCg̑Ɏg
+
+char32_t DecodeUtf8Sequence(const char*& p, const char* end);
+size_t CountAsciiRun(const char* p, size_t length);
+size_t DecodeUtf8(const char* text, size_t length, char32_t* out);
+void AppendUtf8(std::string& s, char32_t c);
+
+/**
+* UTF-8̕񂩂1o
+*
+* ASCII͂̏ŕԂAȊODecodeUtf8SequenceŌȂ畜
+*
+* @param p   oʒu. ̈̕ʒuɐi
+* @param end ̏I[(p < endł邱)
+*
+* @return R[h. sȃoCgȂreplacementCharacter
+*/
+inline char32_t DecodeUtf8(const char*& p, const char* end)
+{
+  const uint8_t c = static_cast<uint8_t>(*p);
+  if (c < 0x80) {
+    ++p;
+    return c;
+  }
+  return DecodeUtf8Sequence(p, end);
+}
+
+} // namespace EasyLib
+
+#endif // EASYLIB_UTF8_H
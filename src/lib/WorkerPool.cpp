@@ -0,0 +1,164 @@
+/**
+* @file WorkerPool.cpp
+*/
+#include "WorkerPool.h"
+
+namespace EasyLib {
+
+/**
+* ƗpXbh쐬
+*
+* @param threadCount 쐬Xbh̐(0ȂĂяoXbhŎs)
+*/
+bool WorkerPool::Init(size_t threadCount)
+{
+  Finalize();
+  quit = false;
+  threads.reserve(threadCount);
+  for (size_t i = 0; i < threadCount; ++i) {
+    threads.emplace_back(&WorkerPool::WorkerMain, this);
+  }
+  return true;
+}
+
+/**
+* ƗpXbhI
+*/
+void WorkerPool::Finalize()
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    quit = true;
+  }
+  cvWork.notify_all();
+  for (auto& e : threads) {
+    e.join();
+  }
+  threads.clear();
+}
+
+/**
+* ^XNs
+*
+* task(0)`task(taskCount - 1)sAׂďI܂ő҂
+* ǂ̃^XNǂ̃XbhŎs邩͌܂ĂȂ
+*
+* @param taskCount ^XN̐
+* @param task      ^XNԍ󂯎Ďs֐
+*/
+void WorkerPool::Run(size_t taskCount, const std::function<void(size_t)>& task)
+{
+  if (taskCount == 0) {
+    return;
+  }
+  if (threads.empty() || taskCount == 1) {
+    for (size_t i = 0; i < taskCount; ++i) {
+      task(i);
+    }
+    return;
+  }
+
+  Job job;
+  job.task = &task;
+  job.taskCount = taskCount;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    jobs.push_back(&job);
+  }
+  cvWork.notify_all();
+
+  // ł^XNsAc͑̃XbhÎ҂
+  while (Execute(job)) {}
+  std::unique_lock<std::mutex> lock(mutex);
+  cvFinish.wait(lock, [&job] { return job.finishedCount.load() == job.taskCount; });
+}
+
+/**
+* n[hEFAXbhAƗpXbh̐߂
+*
+* ĂяoXbh^XNŝŁA̕Ă
+*/
+size_t WorkerPool::GetDefaultThreadCount()
+{
+  const size_t n = std::thread::hardware_concurrency();
+  return n > 1 ? n - 1 : 0;
+}
+
+/**
+* ƗpXbh̏
+*/
+void WorkerPool::WorkerMain()
+{
+  for (;;) {
+    Job* job;
+    size_t index;
+    {
+      // Run߂Job͔ĵŁA^XN̎o܂ŃbN܂܍s
+      std::unique_lock<std::mutex> lock(mutex);
+      cvWork.wait(lock, [this] { return quit || !jobs.empty(); });
+      if (quit) {
+        return;
+      }
+      job = jobs.front();
+      index = Claim(*job);
+    }
+    Finish(*job, index);
+  }
+}
+
+/**
+* Job̃^XNЂƂs
+*
+* @retval true  ^XNs
+* @retval false s^XNcĂȂ
+*/
+bool WorkerPool::Execute(Job& job)
+{
+  size_t index;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (job.nextTask >= job.taskCount) {
+      return false;
+    }
+    index = Claim(job);
+  }
+  Finish(job, index);
+  return true;
+}
+
+/**
+* s^XNo(mutexbNĂĂԂ)
+*
+* @return ^XNԍ
+*/
+size_t WorkerPool::Claim(Job& job)
+{
+  const size_t index = job.nextTask++;
+  // Ō̃^XNoÃXbhȂ悤ɈꗗO
+  if (job.nextTask == job.taskCount) {
+    for (auto itr = jobs.begin(); itr != jobs.end(); ++itr) {
+      if (*itr == &job) {
+        jobs.erase(itr);
+        break;
+      }
+    }
+  }
+  return index;
+}
+
+/**
+* o^XNsAIƂL^
+*
+* Ō̃^XNIRun߂JobĵŁAL^JobɐGȂ
+*/
+void WorkerPool::Finish(Job& job, size_t index)
+{
+  (*job.task)(index);
+  if (job.finishedCount.fetch_add(1) + 1 == job.taskCount) {
+    // ҂ĂXbhʒmƂȂ悤ɁAbNĂʒm
+    std::lock_guard<std::mutex> lock(mutex);
+    cvFinish.notify_all();
+  }
+}
+
+} // namespace EasyLib
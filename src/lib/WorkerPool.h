@@ -0,0 +1,65 @@
+/**
+* @file WorkerPool.h
+*/
+#ifndef EASYLIB_WORKERPOOL_H
+#define EASYLIB_WORKERPOOL_H
+#include <stddef.h>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace EasyLib {
+
+/**
+* ƗpXbh̏W܂
+*
+* Run̓^XNƗpXbhɊUAĂяoXbhꏏɃ^XNsāA
+* ׂẴ^XNI܂ő҂
+* ^XN̒RunĂł悢(҂ĂԂɑ̃^XN~߂邱Ƃ͂Ȃ)
+* GPUɂ͈ؐGȂ̂ŁAP̂ŃeXgx`}[Nł
+*/
+class WorkerPool
+{
+public:
+  WorkerPool() = default;
+  ~WorkerPool() { Finalize(); }
+  WorkerPool(const WorkerPool&) = delete;
+  WorkerPool& operator=(const WorkerPool&) = delete;
+
+  bool Init(size_t threadCount);
+  void Finalize();
+  void Run(size_t taskCount, const std::function<void(size_t)>& task);
+
+  // ĂяoXbh܂ށAɃ^XNsłXbh̐
+  size_t GetConcurrency() const { return threads.size() + 1; }
+  static size_t GetDefaultThreadCount();
+
+private:
+  // RuňĂяoЂƂ̃^XN
+  struct Job {
+    const std::function<void(size_t)>* task;
+    size_t taskCount;
+    size_t nextTask = 0;                  // Ɏs^XNԍ(mutexŕی)
+    std::atomic<size_t> finishedCount{ 0 }; // I^XN̐
+  };
+
+  void WorkerMain();
+  bool Execute(Job& job);
+  size_t Claim(Job& job);
+  void Finish(Job& job, size_t index);
+
+  std::vector<std::thread> threads;
+  std::deque<Job*> jobs; // ^XN̎cĂJob
+  std::mutex mutex;
+  std::condition_variable cvWork;
+  std::condition_variable cvFinish;
+  bool quit = false;
+};
+
+} // namespace EasyLib
+
+#endif // EASYLIB_WORKERPOOL_H
@@ -6,11 +6,14 @@
 #include <d3dcompiler.h>
 #include <DirectXMath.h>
 #include <algorithm>
+#include <memory>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 #include <string>
 #include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
 #include <locale.h>
 #include <time.h>
 #include "lib_2d_game.h"
@@ -19,9 +22,15 @@
 #include "lib/CommandQueue.h"
 #include "lib/Framebuffer.h"
 #include "lib/Texture.h"
+#include "lib/TextureAtlas.h"
 #include "lib/Sprite.h"
 #include "lib/Font.h"
 #include "lib/Audio.h"
+#include "lib/Animation.h"
+#include "lib/Particle.h"
+#include "lib/DrawCapture.h"
+#include "lib/Tilemap.h"
+#include "lib/Utf8.h"
 
 #pragma comment(lib, "d3d12.lib")
 #pragma comment(lib, "dxgi.lib")
@@ -46,14 +55,98 @@ EasyLib::DX12::FramebufferPtr framebuffer;
 EasyLib::DX12::CommandQueuePtr commandQueue;
 EasyLib::DX12::SpriteRenderer spriteRenderer;
 std::vector<EasyLib::DX12::Sprite> spriteBuffer;
-std::unordered_map<std::string, EasyLib::DX12::TexturePtr> textureCache;
+std::unordered_map<std::string, image_handle> textureCache;
 std::unordered_set<std::string> textureMissCache;
+EasyLib::DX12::TextureAtlas textureAtlas;
 
 XMFLOAT2 textScale(1, 1);
 XMFLOAT4 textColor(1, 1, 1, 1);
-std::vector<EasyLib::DX12::Text> textBuffer;
+int textAlign = text_align_left;
+float textWrapWidth = 0;    // 0Ȃ܂ԂȂ
+int textEncoding = text_encoding_utf8;
+std::string convertedText;  // Shift-JISϊ
+std::wstring sjisText;      // Shift-JISϊrUTF-16̕
+
+// t[蒼̔z
+// clearĂvfjÃt[ŕ̗̈悲ƍėp
+// (std::vectorƓO̊֐pӂĂ)
+struct TextList
+{
+  std::vector<EasyLib::DX12::Text> items;
+  size_t count = 0;
+
+  EasyLib::DX12::Text& push() {
+    if (count >= items.size()) {
+      items.emplace_back();
+    }
+    return items[count++];
+  }
+  void clear() { count = 0; }
+  void reserve(size_t n) { items.reserve(n); }
+  const EasyLib::DX12::Text* data() const { return items.data(); }
+  size_t size() const { return count; }
+};
+TextList textBuffer;
 EasyLib::DX12::FontRenderer fontRenderer;
 
+// ͂UTF-8ɂ
+// UTF-8͂̕ASCII͂͂̂̕܂ܕԂ
+// text_encoding_sjisݒ肳Ă΁AShift-JIS(R[hy[W932)UTF-8ɕϊĕԂ
+// ϊʂ͑OɎg̈ɏނ̂ŁA͂ȂȂ胁͊mۂȂ
+// ߂l͎ɌĂԂ܂ŗL
+const char* to_utf8(const char* s, size_t& length)
+{
+  if (textEncoding != text_encoding_sjis ||
+    EasyLib::CountAsciiRun(s, length) == length) {
+    return s;
+  }
+  const int srcLength = static_cast<int>(length);
+  sjisText.resize(length);
+  const int wideLength = MultiByteToWideChar(932, 0, s, srcLength, sjisText.data(), srcLength);
+  // UTF-161UTF-83oCgȉ(TQ[gyA24oCg)
+  convertedText.resize(static_cast<size_t>(wideLength) * 3);
+  const int n = WideCharToMultiByte(CP_UTF8, 0, sjisText.data(), wideLength,
+    convertedText.data(), static_cast<int>(convertedText.size()), nullptr, nullptr);
+  length = static_cast<size_t>(std::max(n, 0));
+  return convertedText.data();
+}
+
+// ͂̉sʒuƑ傫𒲂ׂ(ʂ͎ɌĂԂ܂ŗL)
+//   s      UTF-8̕
+//   length ͂̃oCg
+const EasyLib::DX12::TextLayoutResult& layout_text(const char* s, size_t length)
+{
+  return fontRenderer.Layout(s, length, textScale, textWrapWidth);
+}
+
+// 摜Aj[V
+EasyLib::AnimationSystem animationSystem;
+constexpr uint32_t maxAnimationCount = 16384;
+
+// p[eBN
+EasyLib::ParticleSystem particleSystem;
+constexpr uint32_t maxParticleCount = 100'000;
+
+// ^C}bv(`撆ɃAhXςȂ悤ɌʂɊmۂ)
+std::vector<std::unique_ptr<EasyLib::Tilemap>> tilemaps;
+
+// ^C}bvԍ^C}bv擾
+EasyLib::Tilemap* find_tilemap(int tilemap)
+{
+  if (tilemap < 0 || tilemap >= static_cast<int>(tilemaps.size())) {
+    return nullptr;
+  }
+  return tilemaps[tilemap].get();
+}
+
+// ÓIC[̋L^
+int recordingLayer = -1; // L^̃C[ԍ(-1ȂL^ĂȂ)
+std::vector<EasyLib::DX12::Sprite> staticSpriteBuffer;
+TextList staticTextBuffer;
+
+// `Lv`
+EasyLib::DX12::DrawCaptureWriter drawCapture;
+
 // TODO: DeviceNXɓ邱
 struct RenderCommandContext
 {
@@ -303,6 +396,7 @@ int WINAPI WinMain(
 
   EasyLib::Audio::Engine::Get().Initialize();
 
+  // t@C̕ϊ(ToWString)Ɏg. ͕͂ϊUTF-8̂܂ܕ\
   setlocale(LC_CTYPE, "JPN");
 
   const int result = main();
@@ -351,12 +445,16 @@ int initialize(const std::string& app_name, int clientWidth, int clientHeight)
   spriteBuffer.reserve(1024);
   textureCache.reserve(1024);
   textureMissCache.reserve(1024);
-  spriteRenderer.Initialize(device, framebufferCount, 10'000);
+  textureAtlas.Initialize(device, commandQueue, 1024, 256);
+  spriteRenderer.Initialize(device, framebufferCount);
 
   textBuffer.reserve(1024);
-  fontRenderer.Initialize(device, framebufferCount, 10'000);
+  fontRenderer.Initialize(device, framebufferCount);
   fontRenderer.LoadFromFile("res/font/font.fnt");
 
+  animationSystem.Init(maxAnimationCount);
+  particleSystem.Init(maxParticleCount);
+
   viewport.TopLeftX = 0;
 	viewport.TopLeftY = 0;
 	viewport.Width = static_cast<float>(clientWidth);
@@ -415,6 +513,10 @@ int update()
   spriteBuffer.clear();
   textBuffer.clear();
 
+  // ׂẴAj[V1t[i߂
+  animationSystem.Update(1);
+  particleSystem.Update(1);
+
   return 0;
 }
 
@@ -426,6 +528,7 @@ void render()
   auto& context = device->GetCommandContext(currentFrameIndex);
 
   context.WaitForFence(commandQueue);
+  device->BeginFrame(commandQueue->GetCompletedFenceValue());
 
   context.ResetAllocator();
 
@@ -450,7 +553,7 @@ void render()
 	spriteRenderingInfo.matViewProjection =
     XMMatrixOrthographicOffCenterLH(0, framebuffer->GetWidth(), 0, framebuffer->GetHeight(), 1, 1000);
   spriteRenderingInfo.framebufferIndex = currentFrameIndex;
-  auto spriteCommandList = spriteRenderer.Draw(device, spriteBuffer.data(), spriteBuffer.size(), spriteRenderingInfo);
+  spriteRenderer.SubmitParticles(particleSystem, EasyLib::DX12::BlendMode::Multiply);
 
   EasyLib::DX12::FontRenderingInfo fontRenderingInfo = {};
   fontRenderingInfo.handleRTV = framebuffer->GetRenderTargetHandle(currentFrameIndex);
@@ -460,7 +563,24 @@ void render()
 	fontRenderingInfo.matViewProjection =
     XMMatrixOrthographicOffCenterLH(0, framebuffer->GetWidth(), 0, framebuffer->GetHeight(), 1, 1000);
   fontRenderingInfo.framebufferIndex = currentFrameIndex;
-  auto fontCommandList = fontRenderer.Draw(textBuffer.data(), textBuffer.size(), fontRenderingInfo);
+
+  if (drawCapture.IsOpen()) {
+    drawCapture.WriteFrame(spriteBuffer.data(), spriteBuffer.size(), textBuffer.data(), textBuffer.size());
+  }
+
+  // tHg摜̓ǂݍ݂̓foCXĝŁA񏈗̑Oɍς܂Ă
+  fontRenderer.UpdatePages();
+
+  // XvCgƕ̃R}hXg͕ɋL^(XvCg͓łɕ)
+  const std::vector<ID3D12CommandList*>* spriteCommandLists = nullptr;
+  ID3D12GraphicsCommandList* fontCommandList = nullptr;
+  device->GetWorkerPool().Run(2, [&](size_t i) {
+    if (i == 0) {
+      spriteCommandLists = &spriteRenderer.Draw(device, spriteBuffer.data(), spriteBuffer.size(), spriteRenderingInfo);
+    } else {
+      fontCommandList = fontRenderer.Draw(textBuffer.data(), textBuffer.size(), fontRenderingInfo);
+    }
+  });
 
   ID3D12GraphicsCommandList* listPost = context.GetList(EasyLib::DX12::GraphicsCommandContext::ListType::Post);
   listPost->Reset(context.GetAllocator(), nullptr);
@@ -469,13 +589,20 @@ void render()
   listPost->ResourceBarrier(1, &barrier2);
   listPost->Close();
 
-  ID3D12CommandList* commandLists[] = {
-    listPre,
-    spriteCommandList,
-    fontCommandList,
-    listPost,
-  };
-  context.SetFenceValue(commandQueue->ExecuteCommandLists(std::size(commandLists), commandLists));
+  // `揇ۂ߁AL^ɃL[ɐς(OAXvCgAA㏈)
+  ID3D12CommandList* commandLists[3 + EasyLib::DX12::SpriteRenderer::maxCommandListCount];
+  static_assert(std::size(commandLists) == 3 + EasyLib::DX12::SpriteRenderer::maxChunkCount + 1,
+    "SpriteRenderer::DrawԂ`Nƃp[eBÑXgׂĊi[ł邱");
+  uint32_t commandListCount = 0;
+  commandLists[commandListCount++] = listPre;
+  for (ID3D12CommandList* e : *spriteCommandLists) {
+    commandLists[commandListCount++] = e;
+  }
+  commandLists[commandListCount++] = fontCommandList;
+  commandLists[commandListCount++] = listPost;
+  const uint64_t fenceValue = commandQueue->ExecuteCommandLists(commandListCount, commandLists);
+  context.SetFenceValue(fenceValue);
+  device->EndFrame(fenceValue);
 
   currentFrameIndex = framebuffer->Present(1, 0);
 }
@@ -485,16 +612,17 @@ void render()
 */
 void finalize()
 {
+  drawCapture.Close();
   commandQueue.reset();
 }
 
 // 摜
 image_handle prepare_image(const char* image)
 {
-  image_handle tex;
+  image_handle handle;
   auto itr = textureCache.find(image);
   if (itr != textureCache.end()) {
-    tex = itr->second;
+    handle = itr->second;
   } else {
     std::string s;
     s.reserve(1024);
@@ -502,8 +630,11 @@ image_handle prepare_image(const char* image)
     s += image;
     const std::wstring ws = EasyLib::DX12::ToWString(s.c_str());
 
-    tex = device->LoadTexture(ws.c_str());
-    if (!tex) {
+    const EasyLib::DX12::TexturePtr tex = textureAtlas.LoadTexture(ws.c_str());
+    if (tex) {
+      handle.id = device->GetTextureRegistry().Register(tex);
+    }
+    if (!handle) {
       auto itrMiss = textureMissCache.find(image);
       if (itrMiss == textureMissCache.end()) {
         textureMissCache.emplace(image);
@@ -512,26 +643,34 @@ image_handle prepare_image(const char* image)
       }
       return {};
     }
-    textureCache.emplace(std::string(image), tex);
+    textureCache.emplace(std::string(image), handle);
   }
 
-  return tex;
+  return handle;
 }
 
 // 摜`悷
 void draw_image(double x, double y, const image_handle& image, double scale, double rotation)
 {
-  if (image) {
+  draw_image(x, y, image, scale, rotation, 0, 0);
+}
+
+// C[Ɛ[xw肵ĉ摜`悷
+void draw_image(double x, double y, const image_handle& image, double scale, double rotation, int layer, double depth)
+{
+  const EasyLib::DX12::TextureRegistry::Entry* e = device->GetTextureRegistry().Find(image.id);
+  if (e) {
     EasyLib::DX12::Sprite sprite;
-    sprite.texture = image;
+    sprite.texture = image.id;
     sprite.position.x = static_cast<float>(x);
     sprite.position.y = static_cast<float>(y);
-    sprite.position.z = 100;
+    sprite.position.z = static_cast<float>(depth);
+    sprite.layer = static_cast<uint8_t>(std::clamp(layer, 0, 255));
     sprite.rotation = static_cast<float>(rotation * 3.141592657 / 360.0);
-    sprite.scale.x = static_cast<float>(scale * image->GetWidth());
-    sprite.scale.y = static_cast<float>(scale * image->GetHeight());
+    sprite.scale.x = static_cast<float>(scale * e->width);
+    sprite.scale.y = static_cast<float>(scale * e->height);
     sprite.color = XMFLOAT4(1, 1, 1, 1);
-    spriteBuffer.push_back(sprite);
+    (recordingLayer >= 0 ? staticSpriteBuffer : spriteBuffer).push_back(sprite);
   }
 }
 
@@ -547,17 +686,268 @@ void draw_image(double x, double y, const std::string& image, double scale, doub
   draw_image(x, y, prepare_image(image.c_str()), scale, rotation);
 }
 
+// C[Ɛ[xw肵ĉ摜`悷
+void draw_image(double x, double y, const std::string& image, double scale, double rotation, int layer, double depth)
+{
+  draw_image(x, y, prepare_image(image.c_str()), scale, rotation, layer, depth);
+}
+
+// Aj[V쐬
+int create_animation(const char* const* images, const int* frames, int count, int mode)
+{
+  if (count <= 0) {
+    return -1;
+  }
+  // t@C͂ŉ摜nhɕϊAĐ͕Ȃ悤ɂ
+  std::vector<uint32_t> handles(count);
+  std::vector<uint32_t> durations(count);
+  for (int i = 0; i < count; ++i) {
+    handles[i] = prepare_image(images[i]).id;
+    durations[i] = static_cast<uint32_t>(std::max(frames[i], 0));
+  }
+  EasyLib::AnimationSystem::LoopMode loopMode = EasyLib::AnimationSystem::LoopMode::Loop;
+  if (mode == anime_once) {
+    loopMode = EasyLib::AnimationSystem::LoopMode::Once;
+  } else if (mode == anime_pingpong) {
+    loopMode = EasyLib::AnimationSystem::LoopMode::PingPong;
+  }
+  const uint32_t clip = animationSystem.CreateClip(handles.data(), durations.data(), count, loopMode);
+  if (clip == EasyLib::AnimationSystem::invalidClip) {
+    return -1;
+  }
+  return static_cast<int>(clip);
+}
+
+// Aj[VĐ
+anime_handle play_animation(int animation)
+{
+  anime_handle anime;
+  if (animation >= 0) {
+    anime.id = animationSystem.Play(static_cast<uint32_t>(animation));
+  }
+  return anime;
+}
+
+// ĐAj[V؂ւ
+void change_animation(const anime_handle& anime, int animation)
+{
+  if (animation >= 0) {
+    animationSystem.Change(anime.id, static_cast<uint32_t>(animation));
+  }
+}
+
+// Aj[V̍ĐI
+void stop_animation(anime_handle& anime)
+{
+  animationSystem.Stop(anime.id);
+  anime = {};
+}
+
+// Aj[VŌ܂ōĐꂽׂ
+bool is_animation_finished(const anime_handle& anime)
+{
+  return animationSystem.IsFinished(anime.id);
+}
+
+// Aj[V݂̌̉摜\
+void draw_animation(double x, double y, const anime_handle& anime, double scale, double rotation)
+{
+  image_handle image;
+  image.id = animationSystem.GetImage(anime.id);
+  draw_image(x, y, image, scale, rotation);
+}
+
+// p[eBN쐬
+int create_particle(const char* const* images, int count,
+  double life, double speed_min, double speed_max, double gravity, double scale)
+{
+  if (count <= 0) {
+    return -1;
+  }
+  std::vector<uint32_t> handles(count);
+  for (int i = 0; i < count; ++i) {
+    handles[i] = prepare_image(images[i]).id;
+  }
+  EasyLib::ParticleTypeDesc desc;
+  desc.images = handles.data();
+  desc.imageCount = static_cast<uint32_t>(count);
+  desc.life = static_cast<float>(life);
+  desc.speedMin = static_cast<float>(speed_min);
+  desc.speedMax = static_cast<float>(speed_max);
+  desc.gravity = static_cast<float>(gravity);
+  desc.scale = static_cast<float>(scale);
+  const uint32_t type = particleSystem.CreateType(desc);
+  if (type == EasyLib::ParticleSystem::invalidType) {
+    return -1;
+  }
+  return static_cast<int>(type);
+}
+
+// p[eBN𔭐
+void emit_particles(int particle, double x, double y, int count)
+{
+  if (particle >= 0 && count > 0) {
+    particleSystem.Emit(static_cast<uint32_t>(particle), static_cast<float>(x), static_cast<float>(y), count);
+  }
+}
+
+// ^C}bv쐬
+int create_tilemap(int width, int height, int tile_width, int tile_height)
+{
+  if (width <= 0 || height <= 0) {
+    return -1;
+  }
+  auto tilemap = std::make_unique<EasyLib::Tilemap>();
+  if (!tilemap->Init(width, height, static_cast<float>(tile_width), static_cast<float>(tile_height))) {
+    return -1;
+  }
+  tilemaps.push_back(std::move(tilemap));
+  return static_cast<int>(tilemaps.size() - 1);
+}
+
+// ^C̉摜o^
+int add_tile_image(int tilemap, const char* image)
+{
+  EasyLib::Tilemap* p = find_tilemap(tilemap);
+  const image_handle handle = prepare_image(image);
+  if (!p || !handle) {
+    return 0;
+  }
+  return p->AddTileImage(handle.id);
+}
+
+// ^Cݒ肷
+void set_tile(int tilemap, int x, int y, int tile)
+{
+  EasyLib::Tilemap* p = find_tilemap(tilemap);
+  if (p && x >= 0 && y >= 0 && tile >= 0 && tile <= UINT16_MAX) {
+    p->SetTile(x, y, static_cast<uint16_t>(tile));
+  }
+}
+
+// ^C𒲂ׂ
+int get_tile(int tilemap, int x, int y)
+{
+  const EasyLib::Tilemap* p = find_tilemap(tilemap);
+  if (!p || x < 0 || y < 0) {
+    return 0;
+  }
+  return p->GetTile(x, y);
+}
+
+// ^C}bvɌJԂǂݒ肷
+void set_tilemap_wrap(int tilemap, bool wrap)
+{
+  EasyLib::Tilemap* p = find_tilemap(tilemap);
+  if (p) {
+    p->SetWrapX(wrap);
+  }
+}
+
+// ^C}bv`悷
+void draw_tilemap(int tilemap, double scroll_x, double scroll_y)
+{
+  draw_tilemap(tilemap, scroll_x, scroll_y, 0);
+}
+
+// C[w肵ă^C}bv`悷
+void draw_tilemap(int tilemap, double scroll_x, double scroll_y, int layer)
+{
+  const EasyLib::Tilemap* p = find_tilemap(tilemap);
+  if (p) {
+    spriteRenderer.SubmitTilemap(*p, static_cast<float>(scroll_x), static_cast<float>(scroll_y),
+      static_cast<uint8_t>(std::clamp(layer, 0, 255)), EasyLib::DX12::BlendMode::Multiply);
+  }
+}
+
 // ͂`悷
-void draw_text(double x, double y, const char* format, ...)
+void draw_text_args(double x, double y, const char* format, const EasyLib::TextArg* args, size_t count)
 {
-  va_list ap;
-  va_start(ap, format);
   char tmp[1024];
-  vsnprintf(tmp, sizeof(tmp), format, ap);
-  va_end(ap);
+  size_t length = EasyLib::FormatText(tmp, sizeof(tmp), format, args, count);
+  const char* s = to_utf8(tmp, length);
+  TextList& list = recordingLayer >= 0 ? staticTextBuffer : textBuffer;
+
+  // Ő܂ԂȂ1s͂́̕AzuvZɂ̂܂ܕ\
+  if (textAlign == text_align_left && textWrapWidth <= 0 && !memchr(s, '\n', length)) {
+    EasyLib::DX12::Text& text = list.push();
+    text.position = XMFLOAT2(static_cast<float>(x), static_cast<float>(y));
+    text.scale = textScale;
+    text.color = textColor;
+    text.text.assign(s, length);
+    return;
+  }
 
-  const std::wstring ws = EasyLib::DX12::ToWString(tmp);
-  textBuffer.push_back({ ws, XMFLOAT2(static_cast<float>(x), static_cast<float>(y)), textScale, textColor });
+  // ɍ킹čsƂɈʒu炵A1s\
+  const EasyLib::DX12::TextLayoutResult& layout = layout_text(s, length);
+  for (size_t i = 0; i < layout.lines.size(); ++i) {
+    const EasyLib::DX12::TextLine& line = layout.lines[i];
+    if (line.begin == line.end) {
+      continue;
+    }
+    const float offset = EasyLib::DX12::GetAlignOffset(line, static_cast<EasyLib::DX12::TextAlign>(textAlign));
+    EasyLib::DX12::Text& text = list.push();
+    text.position = XMFLOAT2(static_cast<float>(x) + offset,
+      static_cast<float>(y) + layout.lineHeight * static_cast<float>(i));
+    text.scale = textScale;
+    text.color = textColor;
+    text.text.assign(s + line.begin, line.end - line.begin);
+  }
+}
+
+// ÓIC[̋L^Jn
+bool begin_static_layer(int id)
+{
+  if (id < 0 || recordingLayer >= 0) {
+    return false;
+  }
+  if (spriteRenderer.HasStaticLayer(id) && fontRenderer.HasStaticLayer(id)) {
+    spriteRenderer.SubmitStaticLayer(id);
+    fontRenderer.SubmitStaticLayer(id);
+    return false;
+  }
+  recordingLayer = id;
+  staticSpriteBuffer.clear();
+  staticTextBuffer.clear();
+  return true;
+}
+
+// ÓIC[̋L^I
+void end_static_layer()
+{
+  if (recordingLayer < 0) {
+    return;
+  }
+  spriteRenderer.BuildStaticLayer(device, recordingLayer,
+    staticSpriteBuffer.data(), staticSpriteBuffer.size(), viewport, scissorRect);
+  fontRenderer.BuildStaticLayer(recordingLayer, staticTextBuffer.data(), staticTextBuffer.size(), viewport);
+  spriteRenderer.SubmitStaticLayer(recordingLayer);
+  fontRenderer.SubmitStaticLayer(recordingLayer);
+  recordingLayer = -1;
+}
+
+// ÓIC[j
+void invalidate_static_layer(int id)
+{
+  spriteRenderer.ReleaseStaticLayer(device, id);
+  fontRenderer.ReleaseStaticLayer(id);
+}
+
+// `Lv`Jn
+bool start_draw_capture(const char* filename)
+{
+  const EasyLib::DX12::TextureRegistry& registry = device->GetTextureRegistry();
+  return drawCapture.Open(filename, viewport.Width, viewport.Height,
+    [&registry](EasyLib::DX12::TextureHandle handle) {
+      const EasyLib::DX12::TexturePtr& tex = registry.GetTexture(handle);
+      return tex ? tex->GetName() : std::wstring();
+    });
+}
+
+// `Lv`I
+void stop_draw_capture()
+{
+  drawCapture.Close();
 }
 
 // ̑傫ύX
@@ -576,6 +966,43 @@ void set_text_color(double red, double green, double blue, double alpha)
   textColor.w = static_cast<float>(alpha);
 }
 
+// ͂̑ݒ肷
+void set_text_align(int align)
+{
+  static_assert(text_align_left == static_cast<int>(EasyLib::DX12::TextAlign::Left) &&
+    text_align_center == static_cast<int>(EasyLib::DX12::TextAlign::Center) &&
+    text_align_right == static_cast<int>(EasyLib::DX12::TextAlign::Right), "text_align_* must match TextAlign");
+  textAlign = std::clamp(align, text_align_left, text_align_right);
+}
+
+// ͂܂Ԃݒ肷
+void set_text_wrap(double width)
+{
+  textWrapWidth = std::max(static_cast<float>(width), 0.0f);
+}
+
+// ͂̕R[hݒ肷
+void set_text_encoding(int encoding)
+{
+  textEncoding = std::clamp(encoding, text_encoding_utf8, text_encoding_sjis);
+}
+
+// ͂̕𒲂ׂ
+double get_text_width(const char* text)
+{
+  size_t length = strlen(text);
+  const char* s = to_utf8(text, length);
+  return layout_text(s, length).size.x;
+}
+
+// ͂̍𒲂ׂ
+double get_text_height(const char* text)
+{
+  size_t length = strlen(text);
+  const char* s = to_utf8(text, length);
+  return layout_text(s, length).size.y;
+}
+
 // ʉĐ
 void play_sound(const char* filename, double volume)
 {
@@ -1,11 +1,21 @@
 #ifndef EASYLIB_2D_GAME_H_INCLUDED
 #define EASYLIB_2D_GAME_H_INCLUDED
 #include <string>
-#include <memory>
+#include <type_traits>
+#include <stdint.h>
+#include "lib/TextFormat.h"
 
-// 摜Ǘnh^
-namespace EasyLib { namespace DX12 { class Texture; } }
-using image_handle = std::shared_ptr<EasyLib::DX12::Texture>;
+// 摜Ǘnh^(id0Ȃ疳ȉ摜)
+struct image_handle
+{
+  uint32_t id = 0;
+  explicit operator bool() const { return id != 0; }
+};
+
+// 摜
+//   image    摜t@C
+// ߂ldraw_imageɓnƁAt@Cŉ摜Tȗł
+image_handle prepare_image(const char* image);
 
 // 摜\
 //   x        XW
@@ -17,11 +27,133 @@ void draw_image(double x, double y, const std::string& image);
 void draw_image(double x, double y, const std::string& image, double scale, double rotation);
 void draw_image(double x, double y, const image_handle& image, double scale, double rotation);
 
+// C[Ɛ[xw肵ĉ摜\
+//   layer    C[(0`255. 傫قǎOɕ\)
+//   depth    C[̐[x(傫قǉɕ\)
+// C[Ɛ[x摜͕\wɏdȂ
+// C[w肵Ȃꍇ̓C[0A[x0ɂȂ
+void draw_image(double x, double y, const std::string& image, double scale, double rotation, int layer, double depth);
+void draw_image(double x, double y, const image_handle& image, double scale, double rotation, int layer, double depth);
+
+// Aj[VǗnh^(id0Ȃ疳)
+struct anime_handle
+{
+  uint32_t id = 0;
+  explicit operator bool() const { return id != 0; }
+};
+
+// Aj[V̍Đ@
+constexpr int anime_loop = 0;     // Ō܂ōĐŏɖ߂
+constexpr int anime_once = 1;     // Ō̉摜Ŏ~܂
+constexpr int anime_pingpong = 2; // Ō܂ōĐtɖ߂
+
+// Aj[V쐬
+//   images   摜t@C̔z
+//   frames   摜Ƃ̕\t[̔z
+//   count    z̒
+//   mode     Đ@(anime_loop, anime_once, anime_pingpong ̂ꂩ)
+// ߂l̓Aj[Vԍ(쐬łȂ-1)
+// 摜͂œǂݍ܂̂ŁAQ[̊JnOɈx쐬邱
+int create_animation(const char* const* images, const int* frames, int count, int mode);
+
+// Aj[VĐ
+//   animation Aj[Vԍ
+// ߂l̃nhdraw_animationɓnƁẢ݂摜\
+// Aj[VupdateĂԂт1t[i
+anime_handle play_animation(int animation);
+
+// ĐAj[V؂ւ(ԍȂ牽Ȃ)
+void change_animation(const anime_handle& anime, int animation);
+
+// Aj[V̍ĐI(nh͖ɂȂ)
+void stop_animation(anime_handle& anime);
+
+// anime_oncẽAj[VŌ܂ōĐꂽׂ
+bool is_animation_finished(const anime_handle& anime);
+
+// Aj[V݂̌̉摜\
+//   x        XW
+//   y        YW
+//   anime    Aj[VǗnh
+//   scale    傫
+//   rotation ]
+void draw_animation(double x, double y, const anime_handle& anime, double scale, double rotation);
+
+// p[eBN(RC̔юUȂǂ̌)쐬
+//   images    摜t@C̔z(̊Ԃɐ擪珇ɐ؂ւ)
+//   count     z̒
+//   life      (t[)
+//   speed_min яo̍ŏl(1t[ɐiރsNZ)
+//   speed_max яo̍ől
+//   gravity   ̉x(0Ȃ痎Ȃ)
+//   scale     傫
+// ߂l̓p[eBNԍ(쐬łȂ-1)
+// p[eBN͑SɔяoAupdateĂԂт1t[i
+// 摜XvCǧA͂̑Oɕ\
+int create_particle(const char* const* images, int count,
+  double life, double speed_min, double speed_max, double gravity, double scale);
+
+// p[eBN𔭐
+//   particle p[eBNԍ
+//   x        XW
+//   y        YW
+//   count    鐔
+void emit_particles(int particle, double x, double y, int count);
+
+// ^C}bv쐬
+//   width       ̃^C
+//   height      c̃^C
+//   tile_width  ^C̕(sNZ. 64ȉ̋ɂ邱)
+//   tile_height ^C̍(sNZ. 64ȉ̋ɂ邱)
+// ߂l̓^C}bvԍ(쐬łȂ-1)
+// nʂwî悤ɁA傫̉摜iqɕׂƂɎg
+// 32x32^CƂɂ܂Ƃ߂ĕ\̂ŁẢ摜draw_imageŕ\肸ƌy
+int create_tilemap(int width, int height, int tile_width, int tile_height);
+
+// ^C̉摜o^
+//   tilemap ^C}bvԍ
+//   image   摜t@C
+// ߂l̓^Cԍ(1ȏ. o^łȂ0)
+int add_tile_image(int tilemap, const char* image);
+
+// ^Cݒ肷
+//   tilemap ^C}bvԍ
+//   x       ̈ʒu(^CP)
+//   y       c̈ʒu(^CP)
+//   tile    ^Cԍ(0Ȃ牽\Ȃ)
+void set_tile(int tilemap, int x, int y, int tile);
+
+// ^C𒲂ׂ(͈͊OȂ0)
+int get_tile(int tilemap, int x, int y);
+
+// ^C}bvɌJԂĕ\邩ǂݒ肷
+void set_tilemap_wrap(int tilemap, bool wrap);
+
+// ^C}bv\
+//   tilemap  ^C}bvԍ
+//   scroll_x ʂ̍[ɕ\}bvXW
+//   scroll_y ʂ̏[ɕ\}bvYW
+//   layer    C[(0`255. ̃C[ȏ̉摜ɕ\)
+// XN[Ă\ʒuς邾ŁA^C蒼͍sȂ
+void draw_tilemap(int tilemap, double scroll_x, double scroll_y);
+void draw_tilemap(int tilemap, double scroll_x, double scroll_y, int layer);
+
 // ͂\
 //   x        XW
 //   y        YW
-//   format   \镶
-void draw_text(double x, double y, const char* format, ...);
+//   format   \镶(UTF-8. printfƓg)
+//   args     ɖߍޒl
+// ƒl̐^̓RpCɌAȂ΃RpCG[ɂȂ
+// ɕϊw(%d Ȃ)ȂAll1̏ꍇ́A͂̌ɐl\
+//   draw_text(800, 100, "SCORE:", score); // draw_text(800, 100, "SCORE:%d", score) Ɠ
+// l╶̕ϊ̓mۂɍŝŁAt[\lɎgĂ悢
+void draw_text_args(double x, double y, const char* format, const EasyLib::TextArg* args, size_t count);
+template<typename... Args>
+void draw_text(double x, double y, EasyLib::TextFormatString<std::type_identity_t<Args>...> format, const Args&... args)
+{
+  const EasyLib::TextArg list[] = { EasyLib::TextArg(args)..., EasyLib::TextArg() };
+  draw_text_args(x, y, format.Get(), list, sizeof...(Args));
+}
 
 // ͂̑傫ݒ肷
 //   scale_x ̑傫
@@ -35,6 +167,65 @@ void set_text_scale(double scale_x, double scale_y);
 //   alpha x(0.0= 1.0=s)
 void set_text_color(double red, double green, double blue, double alpha);
 
+// ͂̑
+constexpr int text_align_left = 0;   // XW[ɂȂ
+constexpr int text_align_center = 1; // XWɂȂ
+constexpr int text_align_right = 2;  // XWE[ɂȂ
+
+// ͂̑ݒ肷
+//   align text_align_leftAtext_align_centerAtext_align_right̂ꂩ
+// s͍͂̕sƂɑ
+void set_text_align(int align);
+
+// ͂܂Ԃݒ肷
+//   width 1s̍ő啝(0Ȃ܂ԂȂ)
+// 󔒂̌ォSp̑OŐ܂Ԃ. s̊Ԋȗ͕傫ɍ킹Č܂
+void set_text_wrap(double width);
+
+// ͂̕R[h
+constexpr int text_encoding_utf8 = 0; // UTF-8()
+constexpr int text_encoding_sjis = 1; // Shift-JIS(\OUTF-8ɕϊ)
+
+// ͂̕R[hݒ肷
+//   encoding text_encoding_utf8Atext_encoding_sjiŝꂩ
+// ͂UTF-8̂܂ܕ\. Shift-JISŕۑ\[Xt@C͂̕\ꍇ
+// text_encoding_sjisݒ肷(\邽тɕϊs)
+void set_text_encoding(int encoding);
+
+// ͂̕ƍ𒲂ׂ(̑傫Ɛ܂Ԃ݂͌̐ݒg)
+//   text \镶
+// ʂ͕͂Ƃɕۑ̂ŁAt[ׂĂ悢
+double get_text_width(const char* text);
+double get_text_height(const char* text);
+
+// ÓIC[
+// t[ωȂ摜╶͂܂Ƃ߂ĕۑÃt[͕ϊGPUւ̓]ȗ
+//
+//   if (begin_static_layer(0)) {
+//     draw_image(...); // (܂͔j)s
+//     end_static_layer();
+//   }
+//
+// begin_static_layer  C[Ε`\񂵂falseԂ
+//                     Ȃ΋L^JntrueԂ
+//                     L^draw_imageAdraw_text̓C[ɕۑ
+// end_static_layer    L^IAC[쐬ĕ`\񂷂
+// invalidate_static_layer C[j(eςƂɎg)
+// ÓIC[͗\񂵂ɁAʏ̉摜╶͂ɕ\
+//   id       C[ԍ(0ȏ)
+bool begin_static_layer(int id);
+void end_static_layer();
+void invalidate_static_layer(int id);
+
+// `Lv`
+// t[̉摜ƕ͂̕\et@Cɕۑ
+// ۑt@C tools/draw_replay ŃQ[𓮂ɍĐArł
+// ÓIC[̓e͕ۑȂ
+//   filename ۑt@C
+// ߂l ۑJnłtrue
+bool start_draw_capture(const char* filename);
+void stop_draw_capture(); // ۑI
+
 // 
 void play_sound(const char* filename); // ʉĐ
 void play_sound(const char* filename, double volume); // ʉĐ
@@ -11,7 +11,7 @@ int scene_number = 0;
 // @̕ϐ
 double player_x = 400;
 double player_y = 600;
-int player_anime = 0;
+anime_handle player_anime;
 double jump = 0;
 int score = 0;
 
@@ -20,6 +20,9 @@ double sabo_x = 0;
 double sabo_y = 600;
 int sabo_type = 0;
 
+// Aj[Vԍ
+int dino_run_animation = -1;
+
 // ̑̕ϐ
 double cloud_x = 0;
 double cloud_y = 300;
@@ -34,7 +37,8 @@ void title()
     play_bgm("bgm_prehistoric.mp3");
     player_x = 400;
     player_y = 600;
-    player_anime = 0;
+    stop_animation(player_anime);
+    player_anime = play_animation(dino_run_animation);
     jump = 0;
     score = 0;
 
@@ -49,7 +53,9 @@ void title()
   draw_image(640, 350 + sin(dy) * 20, "logo_title_jp.png");
   dy += 0.025;
 
-  draw_text(500, 600, "PRESS ENTER KEY");
+  set_text_align(text_align_center);
+  draw_text(640, 600, "PRESS ENTER KEY");
+  set_text_align(text_align_left);
 }
 
 //
@@ -99,16 +105,7 @@ void game()
 
   draw_text(800, 100, "SCORE:%d", score);
 
-  player_anime = (player_anime + 1) % 16;
-  if (player_anime < 4) {
-    draw_image(player_x, player_y, "dino_0.png", 2, 0);
-  } else if (player_anime < 8) {
-    draw_image(player_x, player_y, "dino_1.png", 2, 0);
-  } else if (player_anime < 12) {
-    draw_image(player_x, player_y, "dino_0.png", 2, 0);
-  } else if (player_anime < 16) {
-    draw_image(player_x, player_y, "dino_2.png", 2, 0);
-  }
+  draw_animation(player_x, player_y, player_anime, 2, 0);
 
   if (sabo_type == 0) {
     draw_image(sabo_x, sabo_y, "saboten_0.png", 2, 0);
@@ -136,8 +133,10 @@ void gameover()
   }
 
   draw_image(640, 360, "bg_violet.png");
-  draw_text(540, 360, "GAME OVER");
-  draw_text(540, 440, "SCORE:%d", score);
+  set_text_align(text_align_center);
+  draw_text(640, 360, "GAME OVER");
+  draw_text(640, 440, "SCORE:%d", score);
+  set_text_align(text_align_left);
 }
 
 //
@@ -148,6 +147,11 @@ int main()
   // vȌ
   initialize("", 1280, 720);
 
+  // Aj[V쐬
+  const char* dino_run_images[] = { "dino_0.png", "dino_1.png", "dino_0.png", "dino_2.png" };
+  const int dino_run_frames[] = { 4, 4, 4, 4 };
+  dino_run_animation = create_animation(dino_run_images, dino_run_frames, 4, anime_loop);
+
   play_bgm("bgm_stroll.mp3");
 
   // Q[[v
@@ -0,0 +1,318 @@
+/**
+* @file draw_replay.cpp
+*
+* `Lv`Đc[
+*
+* g:
+*   draw_replay <Lv`t@C> [null|sort|software] [JԂ]
+*     Lv`t[Aw肵`揈ɌJԂnĎԂv
+*     null     t[̓WJs
+*     sort     SpriteRendererƓ\[gL[ĕ`揇vZ
+*     software SoftwareRendererŕ`悷(摜͖OPF̉摜g)
+*   draw_replay diff <Lv`t@CA> <Lv`t@CB>
+*     2̃Lv`̕`erAقȂ镔\
+*/
+#include "../../src/lib/DrawCapture.h"
+#include "../../src/lib/SoftwareRenderer.h"
+#include "../../src/lib/SpriteSort.h"
+#include "../../src/lib/WorkerPool.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace EasyLib;
+using namespace EasyLib::DX12;
+
+namespace /* unnamed */ {
+
+/**
+* `揈̊NX
+*/
+class Backend
+{
+public:
+  virtual ~Backend() = default;
+  virtual void Draw(const std::vector<Sprite>& sprites, const std::vector<Text>& texts) = 0;
+  virtual uint64_t GetChecksum() const { return checksum; }
+
+protected:
+  uint64_t checksum = 0; // œKŏȂ悤ɂ邽߂̒l
+};
+
+/**
+* `悵Ȃ
+*/
+class NullBackend : public Backend
+{
+public:
+  void Draw(const std::vector<Sprite>& sprites, const std::vector<Text>& texts) override {
+    checksum += sprites.size() + texts.size();
+  }
+};
+
+/**
+* SpriteRendererƓ@ŕ`揇vZ
+*/
+class SortBackend : public Backend
+{
+public:
+  void Draw(const std::vector<Sprite>& sprites, const std::vector<Text>&) override {
+    keys.resize(sprites.size());
+    for (size_t i = 0; i < sprites.size(); ++i) {
+      const Sprite& e = sprites[i];
+      keys[i] = SpriteSortKey::Make(e.layer, SpriteSortKey::FromDepth(e.position.z),
+        static_cast<uint32_t>(e.blendMode), SlotAllocator::GetIndex(e.texture), i);
+    }
+    sorter.Sort(keys.data(), keys.size());
+    if (sorter.GetCount() > 0) {
+      checksum += sorter.GetOrder()[0];
+    }
+  }
+
+private:
+  std::vector<uint64_t> keys;
+  SpriteSorter sorter;
+};
+
+/**
+* SoftwareRendererŕ`悷
+*/
+class SoftwareBackend : public Backend
+{
+public:
+  bool Initialize(const DrawCaptureReader& reader) {
+    workerPool.Init(WorkerPool::GetDefaultThreadCount());
+    if (!renderer.Initialize(static_cast<uint32_t>(reader.GetWidth()),
+      static_cast<uint32_t>(reader.GetHeight()), &workerPool)) {
+      return false;
+    }
+    // 摜t@C͓ǂݍ܂Ȃ̂ŁAOƂɈႤF̉摜g
+    constexpr uint32_t size = 32;
+    std::vector<uint32_t> pixels(size * size);
+    const auto& names = reader.GetTextureNames();
+    for (size_t i = 0; i < names.size(); ++i) {
+      uint32_t hash = 2166136261u;
+      for (const wchar_t c : names[i]) {
+        hash = (hash ^ static_cast<uint32_t>(c)) * 16777619u;
+      }
+      std::fill(pixels.begin(), pixels.end(), hash | 0xff00'0000u);
+      renderer.SetImage(static_cast<TextureHandle>(i + 1), size, size, pixels.data());
+    }
+    return true;
+  }
+
+  void Draw(const std::vector<Sprite>& sprites, const std::vector<Text>& texts) override {
+    renderer.Clear(0xff66'33ccu);
+    renderer.Draw(sprites.data(), sprites.size(), texts.data(), texts.size());
+    checksum += renderer.GetPixels()[0];
+  }
+
+  const SoftwareRendererStatistics& GetStatistics() const { return renderer.GetStatistics(); }
+
+private:
+  WorkerPool workerPool;
+  SoftwareRenderer renderer;
+};
+
+/**
+* Lv`ĐĎԂv
+*/
+int Replay(const char* filename, const char* backendName, int loopCount)
+{
+  DrawCaptureReader reader;
+  if (!reader.Load(filename)) {
+    fprintf(stderr, "ERROR: %sǂݍ߂܂\n", filename);
+    return 1;
+  }
+
+  // WJ̎Ԃ܂߂Ȃ悤ɁAɂׂẴt[WJĂ
+  const size_t frameCount = reader.GetFrameCount();
+  std::vector<std::vector<Sprite>> frameSprites(frameCount);
+  std::vector<std::vector<Text>> frameTexts(frameCount);
+  size_t spriteCount = 0;
+  size_t textCount = 0;
+  for (size_t i = 0; i < frameCount; ++i) {
+    reader.ReadFrame(i, frameSprites[i], frameTexts[i]);
+    spriteCount += frameSprites[i].size();
+    textCount += frameTexts[i].size();
+  }
+  printf("%s: %zu frames, %zu textures, %zu bytes, %zu sprites, %zu texts\n", filename, frameCount,
+    reader.GetTextureNames().size(), reader.GetByteCount(), spriteCount, textCount);
+  if (frameCount == 0) {
+    return 0;
+  }
+
+  std::unique_ptr<Backend> backend;
+  SoftwareBackend* softwareBackend = nullptr;
+  if (strcmp(backendName, "null") == 0) {
+    backend = std::make_unique<NullBackend>();
+  } else if (strcmp(backendName, "sort") == 0) {
+    backend = std::make_unique<SortBackend>();
+  } else if (strcmp(backendName, "software") == 0) {
+    auto p = std::make_unique<SoftwareBackend>();
+    if (!p->Initialize(reader)) {
+      fprintf(stderr, "ERROR: SoftwareRendererł܂\n");
+      return 1;
+    }
+    softwareBackend = p.get();
+    backend = std::move(p);
+  } else {
+    fprintf(stderr, "ERROR: sȕ`揈ł: %s\n", backendName);
+    return 1;
+  }
+
+  using Clock = std::chrono::steady_clock;
+  uint64_t minNanoseconds = UINT64_MAX;
+  uint64_t maxNanoseconds = 0;
+  uint64_t totalNanoseconds = 0;
+  uint64_t pixelCount = 0;
+  for (int loop = 0; loop < loopCount; ++loop) {
+    for (size_t i = 0; i < frameCount; ++i) {
+      const auto start = Clock::now();
+      backend->Draw(frameSprites[i], frameTexts[i]);
+      const uint64_t ns = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count());
+      minNanoseconds = std::min(minNanoseconds, ns);
+      maxNanoseconds = std::max(maxNanoseconds, ns);
+      totalNanoseconds += ns;
+      if (softwareBackend) {
+        pixelCount += softwareBackend->GetStatistics().pixelCount;
+      }
+    }
+  }
+
+  const double drawCount = static_cast<double>(frameCount) * loopCount;
+  printf("%s x %d: avg %.3f ms, min %.3f ms, max %.3f ms per frame (checksum %llu)\n",
+    backendName, loopCount, static_cast<double>(totalNanoseconds) / drawCount * 1e-6,
+    static_cast<double>(minNanoseconds) * 1e-6, static_cast<double>(maxNanoseconds) * 1e-6,
+    static_cast<unsigned long long>(backend->GetChecksum()));
+  if (softwareBackend) {
+    printf("  %.1f Mpixel/s\n", static_cast<double>(pixelCount) / (static_cast<double>(totalNanoseconds) * 1e-9) * 1e-6);
+  }
+  return 0;
+}
+
+bool Equals(const DirectX::XMFLOAT4& a, const DirectX::XMFLOAT4& b)
+{
+  return a.x == b.x && a.y == b.y && a.z == b.z && a.w == b.w;
+}
+
+/**
+* 2̃Lv`r
+*
+* eNX`ԍ̓Lv`ƂɈႤ̂ŁAOŔr
+*
+* @return Ȃ0AႢ1
+*/
+int Diff(const char* filenameA, const char* filenameB)
+{
+  DrawCaptureReader readers[2];
+  const char* filenames[2] = { filenameA, filenameB };
+  for (int i = 0; i < 2; ++i) {
+    if (!readers[i].Load(filenames[i])) {
+      fprintf(stderr, "ERROR: %sǂݍ߂܂\n", filenames[i]);
+      return 1;
+    }
+  }
+
+  constexpr int maxReportCount = 20;
+  int reportCount = 0;
+  size_t differentFrameCount = 0;
+  const auto report = [&reportCount](size_t frame, const char* format, size_t index) {
+    if (reportCount++ < maxReportCount) {
+      printf("frame %zu: ", frame);
+      printf(format, index);
+      printf("\n");
+    }
+  };
+
+  const auto& namesA = readers[0].GetTextureNames();
+  const auto& namesB = readers[1].GetTextureNames();
+  const auto nameOf = [](const std::vector<std::wstring>& names, TextureHandle handle) -> const std::wstring& {
+    static const std::wstring empty;
+    return (handle >= 1 && handle <= names.size()) ? names[handle - 1] : empty;
+  };
+
+  const size_t frameCount = std::min(readers[0].GetFrameCount(), readers[1].GetFrameCount());
+  if (readers[0].GetFrameCount() != readers[1].GetFrameCount()) {
+    printf("frame count: %zu != %zu\n", readers[0].GetFrameCount(), readers[1].GetFrameCount());
+  }
+  std::vector<Sprite> spritesA, spritesB;
+  std::vector<Text> textsA, textsB;
+  for (size_t frame = 0; frame < frameCount; ++frame) {
+    readers[0].ReadFrame(frame, spritesA, textsA);
+    readers[1].ReadFrame(frame, spritesB, textsB);
+    const int prevReportCount = reportCount;
+    if (spritesA.size() != spritesB.size()) {
+      report(frame, "sprite count differs (%zu)", spritesA.size());
+    }
+    for (size_t i = 0; i < std::min(spritesA.size(), spritesB.size()); ++i) {
+      const Sprite& a = spritesA[i];
+      const Sprite& b = spritesB[i];
+      if (nameOf(namesA, a.texture) != nameOf(namesB, b.texture)) {
+        report(frame, "sprite %zu: texture differs", i);
+      } else if (a.position.x != b.position.x || a.position.y != b.position.y ||
+        a.position.z != b.position.z || a.rotation != b.rotation ||
+        a.scale.x != b.scale.x || a.scale.y != b.scale.y ||
+        !Equals(a.color, b.color) || a.layer != b.layer || a.blendMode != b.blendMode) {
+        report(frame, "sprite %zu: parameter differs", i);
+      }
+    }
+    if (textsA.size() != textsB.size()) {
+      report(frame, "text count differs (%zu)", textsA.size());
+    }
+    for (size_t i = 0; i < std::min(textsA.size(), textsB.size()); ++i) {
+      const Text& a = textsA[i];
+      const Text& b = textsB[i];
+      if (a.text != b.text || a.position.x != b.position.x || a.position.y != b.position.y ||
+        a.scale.x != b.scale.x || a.scale.y != b.scale.y || !Equals(a.color, b.color)) {
+        report(frame, "text %zu differs", i);
+      }
+    }
+    if (reportCount != prevReportCount) {
+      ++differentFrameCount;
+    }
+  }
+
+  if (reportCount > maxReportCount) {
+    printf("... (%d more)\n", reportCount - maxReportCount);
+  }
+  printf("%zu / %zu frames differ\n", differentFrameCount, frameCount);
+  const bool same = differentFrameCount == 0 &&
+    readers[0].GetFrameCount() == readers[1].GetFrameCount();
+  return same ? 0 : 1;
+}
+
+void PrintUsage()
+{
+  printf("usage: draw_replay <capture> [null|sort|software] [loop count]\n");
+  printf("       draw_replay diff <capture A> <capture B>\n");
+}
+
+} // unnamed namespace
+
+/**
+* Gg[|Cg
+*/
+int main(int argc, char** argv)
+{
+  if (argc < 2) {
+    PrintUsage();
+    return 1;
+  }
+  if (strcmp(argv[1], "diff") == 0) {
+    if (argc < 4) {
+      PrintUsage();
+      return 1;
+    }
+    return Diff(argv[2], argv[3]);
+  }
+  const char* backendName = argc >= 3 ? argv[2] : "null";
+  const int loopCount = argc >= 4 ? std::max(atoi(argv[3]), 1) : 10;
+  return Replay(argv[1], backendName, loopCount);
+}
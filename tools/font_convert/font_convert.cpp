@@ -0,0 +1,85 @@
+/**
+* @file font_convert.cpp
+*
+* BMFont̃eLXg`(.fnt)ϊς݌`(.fntb)ɕϊc[
+*
+* g:
+*   font_convert <̓t@C(.fnt)> [o̓t@C(.fntb)]
+*     o̓t@CȗƁA̓t@C̊gq.fntbɒuOɂȂ
+*     ϊǍ`̓ǂݍݎԂvĕ\
+*/
+#include "../../src/lib/FontData.h"
+#include <stdio.h>
+#include <algorithm>
+#include <chrono>
+#include <string>
+
+using namespace EasyLib::DX12;
+
+namespace /* unnamed */ {
+
+/**
+* ǂݍ݂ɂ鎞Ԃv
+*
+* ŏ1(t@CLbVɍڂĂȂ\)ƁA
+* ̌̌JԂ̍ŏlԂ
+*/
+template<typename F>
+void Measure(F&& load, double& firstMs, double& bestMs)
+{
+  using Clock = std::chrono::steady_clock;
+  constexpr int loopCount = 20;
+  bestMs = 1e30;
+  for (int i = 0; i <= loopCount; ++i) {
+    const auto start = Clock::now();
+    load();
+    const double ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    if (i == 0) {
+      firstMs = ms;
+    } else {
+      bestMs = std::min(bestMs, ms);
+    }
+  }
+}
+
+} // unnamed namespace
+
+/**
+* Gg[|Cg
+*/
+int main(int argc, char** argv)
+{
+  if (argc < 2) {
+    printf("usage: font_convert <input.fnt> [output.fntb]\n");
+    return 1;
+  }
+  const char* inputFilename = argv[1];
+  const std::string outputFilename = argc >= 3 ? argv[2] : FontData::GetBinaryFilename(inputFilename);
+
+  FontData text;
+  if (!text.LoadFromText(inputFilename)) {
+    fprintf(stderr, "ERROR: %s̓ǂݍ݂Ɏs(line=%d)\n", inputFilename, text.errorLine);
+    return 1;
+  }
+  if (!text.SaveToBinary(outputFilename.c_str(), inputFilename)) {
+    fprintf(stderr, "ERROR: %sɏ߂܂\n", outputFilename.c_str());
+    return 1;
+  }
+
+  // 񂾃t@CǂݒāAeƂmF
+  FontData binary;
+  if (!binary.LoadFromBinary(outputFilename.c_str(), inputFilename) || !binary.IsSameData(text)) {
+    fprintf(stderr, "ERROR: %s̓eϊƈv܂\n", outputFilename.c_str());
+    return 1;
+  }
+  printf("%s -> %s: %zu glyphs, %zu pages\n", inputFilename, outputFilename.c_str(),
+    text.codePoints.size(), text.pages.size());
+
+  double textFirst, textBest, binaryFirst, binaryBest;
+  FontData work;
+  Measure([&] { work.LoadFromText(inputFilename); }, textFirst, textBest);
+  Measure([&] { work.LoadFromBinary(outputFilename.c_str(), inputFilename); }, binaryFirst, binaryBest);
+  printf("  text:   first %.3f ms, best %.3f ms\n", textFirst, textBest);
+  printf("  binary: first %.3f ms, best %.3f ms\n", binaryFirst, binaryBest);
+  return 0;
+}
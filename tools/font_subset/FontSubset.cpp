@@ -0,0 +1,261 @@
+/**
+* @file FontSubset.cpp
+*/
+#include "FontSubset.h"
+#include "../../src/lib/DrawCapture.h"
+#include "../../src/lib/Utf8.h"
+#include <ctype.h>
+#include <math.h>
+#include <algorithm>
+
+namespace EasyLib {
+namespace DX12 {
+
+namespace /* unnamed */ {
+
+/**
+* \镶ǂ(䕶ƕsȃoCg)
+*/
+bool IsDrawable(char32_t c)
+{
+  return c >= 0x20 && c != 0x7f && c != replacementCharacter;
+}
+
+/**
+* ̃y[W̕摜͈̔͂߂
+*/
+AtlasRect GetSourceRect(const FontData& font, const FontInfoInShader& glyph)
+{
+  AtlasRect rect;
+  rect.x = static_cast<uint32_t>(lroundf(glyph.uv[0].x * font.textureSize.x));
+  rect.y = static_cast<uint32_t>(lroundf(glyph.uv[0].y * font.textureSize.y));
+  rect.width = static_cast<uint32_t>(glyph.size.x);
+  rect.height = static_cast<uint32_t>(glyph.size.y);
+  return rect;
+}
+
+} // unnamed namespace
+
+/**
+* UTF-8ׂ͂̂̕Ă̕ǉ
+*
+* \̂悤ɁA\镶͂ꂽt@CɎg
+*/
+void AddTextCodePoints(const char* text, size_t length, std::vector<uint32_t>& codePoints)
+{
+  const char* p = text;
+  const char* const end = text + length;
+  while (p < end) {
+    const char32_t c = DecodeUtf8(p, end);
+    if (IsDrawable(c)) {
+      codePoints.push_back(c);
+    }
+  }
+}
+
+/**
+* C++̃\[Xt@CA񃊃e̒̕ǉ
+*
+* Rgƕe͓ǂݔ΂. GXP[vV[PX́A\"A\\A\'𕶎ƂĈAق͓ǂݔ΂
+* \[Xt@CUTF-8ł邱
+*/
+void AddStringLiteralCodePoints(const char* source, size_t length, std::vector<uint32_t>& codePoints)
+{
+  const char* p = source;
+  const char* const end = source + length;
+  while (p < end) {
+    const char c = *p++;
+    if (c == '/' && p < end && *p == '/') {
+      while (p < end && *p != '\n') {
+        ++p;
+      }
+    } else if (c == '/' && p < end && *p == '*') {
+      for (++p; p < end && !(p[0] == '*' && p + 1 < end && p[1] == '/'); ++p) {
+      }
+      p = std::min(p + 2, end);
+    } else if (c == '"' || c == '\'') {
+      while (p < end && *p != c && *p != '\n') {
+        if (*p == '\\' && p + 1 < end) {
+          if (c == '"' && (p[1] == '"' || p[1] == '\\' || p[1] == '\'')) {
+            codePoints.push_back(static_cast<uint8_t>(p[1]));
+          }
+          // lŏGXP[vV[PX́A̕܂œǂݔ΂
+          const char kind = p[1];
+          p += 2;
+          if (kind == 'x' || kind == 'u' || kind == 'U') {
+            while (p < end && isxdigit(static_cast<uint8_t>(*p))) {
+              ++p;
+            }
+          } else if (kind >= '0' && kind <= '7') {
+            for (int i = 0; i < 2 && p < end && *p >= '0' && *p <= '7'; ++i) {
+              ++p;
+            }
+          }
+          continue;
+        }
+        const char32_t code = DecodeUtf8(p, end);
+        if (c == '"' && IsDrawable(code)) {
+          codePoints.push_back(code);
+        }
+      }
+      if (p < end) {
+        ++p;
+      }
+    }
+  }
+}
+
+/**
+* `f[^̃Lv`t@CA\ꂽ͂̕ǉ
+*
+* @retval true  ǉ
+* @retval false t@Cǂݍ߂Ȃ
+*/
+bool AddCaptureCodePoints(const char* filename, std::vector<uint32_t>& codePoints)
+{
+  DrawCaptureReader reader;
+  if (!reader.Load(filename)) {
+    return false;
+  }
+  std::vector<Sprite> sprites;
+  std::vector<Text> texts;
+  for (size_t i = 0; i < reader.GetFrameCount(); ++i) {
+    if (!reader.ReadFrame(i, sprites, texts)) {
+      return false;
+    }
+    for (const Text& e : texts) {
+      AddTextCodePoints(e.text.data(), e.text.size(), codePoints);
+    }
+  }
+  return true;
+}
+
+/**
+* \łASCII(󔒂'~'܂)ǉ
+*
+* Ŗߍސl̂悤ɁA\[Xt@CɌȂ₤߂Ɏg
+*/
+void AddPrintableAsciiCodePoints(std::vector<uint32_t>& codePoints)
+{
+  for (uint32_t c = 0x20; c < 0x7f; ++c) {
+    codePoints.push_back(c);
+  }
+}
+
+/**
+* gW߂tHg쐬
+*
+* 摜ɕׂĂA肫ŏ̑傫̃AgXɋl߂
+* AgX̑傫́Aƍ2ׂ̂ŁAƓ2{̂̂Ɏ
+* 蕝A\ʒûA]͌̃tHgƓlg
+*
+* @param source     ̃tHg
+* @param codePoints g(dĂĂ悢)
+* @param padding    摜̎͂Ɋmۂ錄Ԃ̃sNZ
+* @param maxSize    AgX̕ƍ̍ől
+* @param pageName   kł̃AgX̃t@C(tHgt@C̑΃pX)
+* @param subset     쐬tHgi[ϐ
+*
+* @retval true  쐬
+* @retval false maxSizẽAgXɓ肫Ȃ
+*/
+bool BuildFontSubset(const FontData& source, std::vector<uint32_t> codePoints,
+  uint32_t padding, uint32_t maxSize, const std::string& pageName, FontSubset& subset)
+{
+  std::sort(codePoints.begin(), codePoints.end());
+  codePoints.erase(std::unique(codePoints.begin(), codePoints.end()), codePoints.end());
+
+  // ̃tHgɂ镶AR[ĥ܂܏W߂
+  std::vector<size_t> indices;
+  subset.missing.clear();
+  for (uint32_t c : codePoints) {
+    const auto itr = std::lower_bound(source.codePoints.begin(), source.codePoints.end(), c);
+    if (itr == source.codePoints.end() || *itr != c) {
+      subset.missing.push_back(c);
+      continue;
+    }
+    indices.push_back(static_cast<size_t>(itr - source.codePoints.begin()));
+  }
+
+  // 摜̂镶A(Ȃ畝̍L)ɋl߂
+  std::vector<size_t> order;
+  uint64_t totalArea = 0;
+  for (size_t i = 0; i < indices.size(); ++i) {
+    const FontInfoInShader& glyph = source.glyphs[indices[i]];
+    if (glyph.size.x > 0 && glyph.size.y > 0) {
+      order.push_back(i);
+      totalArea += static_cast<uint64_t>(glyph.size.x + padding * 2) * static_cast<uint64_t>(glyph.size.y + padding * 2);
+    }
+  }
+  std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+    const FontInfoInShader& ga = source.glyphs[indices[a]];
+    const FontInfoInShader& gb = source.glyphs[indices[b]];
+    return ga.size.y != gb.size.y ? ga.size.y > gb.size.y : ga.size.x > gb.size.x;
+  });
+
+  std::vector<AtlasRect> rects(indices.size());
+  uint32_t width = 1;
+  uint32_t height = 1;
+  AtlasPacker packer;
+  for (;;) {
+    if (width > maxSize || height > maxSize) {
+      return false;
+    }
+    if (static_cast<uint64_t>(width) * height >= totalArea) {
+      packer.Reset(width, height, padding);
+      bool packed = true;
+      for (size_t i : order) {
+        const FontInfoInShader& glyph = source.glyphs[indices[i]];
+        if (!packer.Pack(static_cast<uint32_t>(glyph.size.x), static_cast<uint32_t>(glyph.size.y), rects[i])) {
+          packed = false;
+          break;
+        }
+      }
+      if (packed) {
+        break;
+      }
+    }
+    if (width == height) {
+      width *= 2;
+    } else {
+      height *= 2;
+    }
+  }
+
+  FontData& font = subset.font;
+  font.Clear();
+  font.fontSize = source.fontSize;
+  font.paddingUp = source.paddingUp;
+  font.paddingRight = source.paddingRight;
+  font.paddingDown = source.paddingDown;
+  font.paddingLeft = source.paddingLeft;
+  font.textureSize = DirectX::XMFLOAT2(static_cast<float>(width), static_cast<float>(height));
+  font.pages.assign(1, pageName);
+  font.codePoints.reserve(indices.size());
+  font.advances.reserve(indices.size());
+  font.glyphs.reserve(indices.size());
+  subset.copies.clear();
+  const DirectX::XMFLOAT2 reciprocalTextureSize(1.0f / font.textureSize.x, 1.0f / font.textureSize.y);
+  for (size_t i = 0; i < indices.size(); ++i) {
+    const FontInfoInShader& src = source.glyphs[indices[i]];
+    FontInfoInShader glyph = src;
+    glyph.page = 0;
+    if (src.size.x > 0 && src.size.y > 0) {
+      const AtlasRect& dest = rects[i];
+      glyph.uv[0].x = static_cast<float>(dest.x) * reciprocalTextureSize.x;
+      glyph.uv[0].y = static_cast<float>(dest.y) * reciprocalTextureSize.y;
+      glyph.uv[1].x = static_cast<float>(dest.x + dest.width) * reciprocalTextureSize.x;
+      glyph.uv[1].y = static_cast<float>(dest.y + dest.height) * reciprocalTextureSize.y;
+      subset.copies.push_back({ src.page, GetSourceRect(source, src), dest });
+    } else {
+      glyph.uv[0] = glyph.uv[1] = DirectX::XMFLOAT2(0, 0);
+    }
+    font.codePoints.push_back(source.codePoints[indices[i]]);
+    font.advances.push_back(source.advances[indices[i]]);
+    font.glyphs.push_back(glyph);
+  }
+  return true;
+}
+
+} // namespace DX12
+} // namespace EasyLib
@@ -0,0 +1,47 @@
+/**
+* @file FontSubset.h
+*/
+#ifndef EASYLIB_DX12_FONTSUBSET_H
+#define EASYLIB_DX12_FONTSUBSET_H
+#include "../../src/lib/FontData.h"
+#include "../../src/lib/AtlasPacker.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace EasyLib {
+namespace DX12 {
+
+void AddTextCodePoints(const char* text, size_t length, std::vector<uint32_t>& codePoints);
+void AddStringLiteralCodePoints(const char* source, size_t length, std::vector<uint32_t>& codePoints);
+bool AddCaptureCodePoints(const char* filename, std::vector<uint32_t>& codePoints);
+void AddPrintableAsciiCodePoints(std::vector<uint32_t>& codePoints);
+
+/**
+* kł̃AgXɕ摜ʂ@
+*/
+struct FontSubsetCopy
+{
+  uint32_t sourcePage; // ̃y[Wԍ
+  AtlasRect source;    // ̃y[W͈̔
+  AtlasRect dest;      // kł̃AgX͈̔
+};
+
+/**
+* gW߂tHg
+*/
+struct FontSubset
+{
+  FontData font;                      // kł̃tHg(y[W1)
+  std::vector<FontSubsetCopy> copies; // 摜̎ʂ
+  std::vector<uint32_t> missing;      // ̃tHgɂȂ
+};
+
+bool BuildFontSubset(const FontData& source, std::vector<uint32_t> codePoints,
+  uint32_t padding, uint32_t maxSize, const std::string& pageName, FontSubset& subset);
+
+} // namespace DX12
+} // namespace EasyLib
+
+#endif // EASYLIB_DX12_FONTSUBSET_H
@@ -0,0 +1,416 @@
+/**
+* @file font_subset.cpp
+*
+* gW߂kł̃tHg쐬c[
+*
+* g:
+*   font_subset [-noascii] [-padding ] [-maxsize őTCY] <̓t@C(.fnt)> <o̓t@C(.fnt)> <̎W...>
+*     ̎W͊gqňς
+*       .edc             `f[^̃Lv`. \ꂽׂ͂̂Ă̕
+*       .cpp, .h, .hpp   C++̃\[Xt@C. 񃊃e̒̕
+*       ȊO         UTF-8̕\. t@ĈׂĂ̕
+*     ŖߍސlȂǂɔāA\łASCII͏ɒǉ(-noasciiŒǉȂ)
+*     o̓t@CƓꏊɁAAgX(.png)ƕϊς݌`(.fntb)쐬
+*     쐬ÃtHgƏkł̃tHg̑傫ƓǂݍݎԂ\
+*/
+#define NOMINMAX
+#include "FontSubset.h"
+#include <Windows.h>
+#include <wincodec.h>
+#include <wrl/client.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#pragma comment(lib, "windowscodecs.lib")
+
+using namespace EasyLib::DX12;
+using Microsoft::WRL::ComPtr;
+
+namespace /* unnamed */ {
+
+/**
+* 32bit RGBẢ摜
+*/
+struct Image
+{
+  uint32_t width = 0;
+  uint32_t height = 0;
+  std::vector<uint8_t> pixels;
+};
+
+/**
+* ǂݍ݂ɂ鎞Ԃv
+*
+* ŏ1(t@CLbVɍڂĂȂ\)ƁA
+* ̌̌JԂ̍ŏlԂ
+*/
+template<typename F>
+void Measure(F&& load, double& firstMs, double& bestMs)
+{
+  using Clock = std::chrono::steady_clock;
+  constexpr int loopCount = 20;
+  bestMs = 1e30;
+  for (int i = 0; i <= loopCount; ++i) {
+    const auto start = Clock::now();
+    load();
+    const double ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    if (i == 0) {
+      firstMs = ms;
+    } else {
+      bestMs = std::min(bestMs, ms);
+    }
+  }
+}
+
+/**
+* }`oCgChɕϊ
+*/
+std::wstring ToWString(const std::string& s)
+{
+  const int length = MultiByteToWideChar(CP_ACP, 0, s.c_str(), -1, nullptr, 0);
+  std::wstring ws(static_cast<size_t>(std::max(length, 1)), L'\0');
+  MultiByteToWideChar(CP_ACP, 0, s.c_str(), -1, ws.data(), length);
+  ws.resize(wcslen(ws.c_str()));
+  return ws;
+}
+
+/**
+* t@CfBNg(̋؂蕶܂)o
+*/
+std::string GetDirectory(const std::string& filename)
+{
+  const size_t n = filename.find_last_of("/\\");
+  return n == std::string::npos ? std::string() : filename.substr(0, n + 1);
+}
+
+/**
+* t@Cgq()o
+*/
+std::string GetExtension(const std::string& filename)
+{
+  const size_t n = filename.find_last_of("./\\");
+  if (n == std::string::npos || filename[n] != '.') {
+    return std::string();
+  }
+  std::string ext = filename.substr(n);
+  for (char& c : ext) {
+    if (c >= 'A' && c <= 'Z') {
+      c = static_cast<char>(c - 'A' + 'a');
+    }
+  }
+  return ext;
+}
+
+/**
+* t@C̑傫擾
+*/
+uint64_t GetFileBytes(const std::string& filename)
+{
+  WIN32_FILE_ATTRIBUTE_DATA data;
+  if (!GetFileAttributesExA(filename.c_str(), GetFileExInfoStandard, &data)) {
+    return 0;
+  }
+  return (static_cast<uint64_t>(data.nFileSizeHigh) << 32) | data.nFileSizeLow;
+}
+
+/**
+* t@C̓eׂēǂݍ
+*/
+bool ReadTextFile(const char* filename, std::string& content)
+{
+  FILE* fp = fopen(filename, "rb");
+  if (!fp) {
+    return false;
+  }
+  content.clear();
+  char buffer[4096];
+  for (size_t n; (n = fread(buffer, 1, sizeof(buffer), fp)) > 0; ) {
+    content.append(buffer, n);
+  }
+  fclose(fp);
+  return true;
+}
+
+/**
+* 摜t@C32bit RGBAœǂݍ
+*/
+bool LoadRgbaImage(IWICImagingFactory* factory, const std::string& filename, Image& image)
+{
+  ComPtr<IWICBitmapDecoder> decoder;
+  HRESULT hr = factory->CreateDecoderFromFilename(ToWString(filename).c_str(), nullptr,
+    GENERIC_READ, WICDecodeMetadataCacheOnDemand, &decoder);
+  if (FAILED(hr)) {
+    return false;
+  }
+  ComPtr<IWICBitmapFrameDecode> frame;
+  hr = decoder->GetFrame(0, &frame);
+  if (FAILED(hr)) {
+    return false;
+  }
+  ComPtr<IWICFormatConverter> converter;
+  hr = factory->CreateFormatConverter(&converter);
+  if (FAILED(hr)) {
+    return false;
+  }
+  hr = converter->Initialize(frame.Get(), GUID_WICPixelFormat32bppRGBA,
+    WICBitmapDitherTypeNone, nullptr, 0, WICBitmapPaletteTypeCustom);
+  if (FAILED(hr)) {
+    return false;
+  }
+  hr = converter->GetSize(&image.width, &image.height);
+  if (FAILED(hr)) {
+    return false;
+  }
+  const UINT stride = image.width * 4;
+  image.pixels.resize(static_cast<size_t>(stride) * image.height);
+  hr = converter->CopyPixels(nullptr, stride, static_cast<UINT>(image.pixels.size()), image.pixels.data());
+  return SUCCEEDED(hr);
+}
+
+/**
+* 32bit RGBẢ摜PNGt@Cɏ
+*/
+bool SavePng(IWICImagingFactory* factory, const std::string& filename, const Image& image)
+{
+  ComPtr<IWICStream> stream;
+  HRESULT hr = factory->CreateStream(&stream);
+  if (FAILED(hr)) {
+    return false;
+  }
+  hr = stream->InitializeFromFilename(ToWString(filename).c_str(), GENERIC_WRITE);
+  if (FAILED(hr)) {
+    return false;
+  }
+  ComPtr<IWICBitmapEncoder> encoder;
+  hr = factory->CreateEncoder(GUID_ContainerFormatPng, nullptr, &encoder);
+  if (FAILED(hr)) {
+    return false;
+  }
+  hr = encoder->Initialize(stream.Get(), WICBitmapEncoderNoCache);
+  if (FAILED(hr)) {
+    return false;
+  }
+  ComPtr<IWICBitmapFrameEncode> frame;
+  hr = encoder->CreateNewFrame(&frame, nullptr);
+  if (FAILED(hr)) {
+    return false;
+  }
+  hr = frame->Initialize(nullptr);
+  if (FAILED(hr)) {
+    return false;
+  }
+  hr = frame->SetSize(image.width, image.height);
+  if (FAILED(hr)) {
+    return false;
+  }
+  WICPixelFormatGUID format = GUID_WICPixelFormat32bppRGBA;
+  hr = frame->SetPixelFormat(&format);
+  if (FAILED(hr) || format != GUID_WICPixelFormat32bppRGBA) {
+    return false;
+  }
+  const UINT stride = image.width * 4;
+  hr = frame->WritePixels(image.height, stride, static_cast<UINT>(image.pixels.size()),
+    const_cast<BYTE*>(image.pixels.data()));
+  if (FAILED(hr)) {
+    return false;
+  }
+  hr = frame->Commit();
+  if (FAILED(hr)) {
+    return false;
+  }
+  return SUCCEEDED(encoder->Commit());
+}
+
+/**
+* ̃y[Wkł̃AgXɕ摜ʂ
+*/
+bool ComposeAtlas(const FontSubset& subset, const std::vector<Image>& pages, Image& atlas)
+{
+  atlas.width = static_cast<uint32_t>(subset.font.textureSize.x);
+  atlas.height = static_cast<uint32_t>(subset.font.textureSize.y);
+  atlas.pixels.assign(static_cast<size_t>(atlas.width) * atlas.height * 4, 0);
+  for (const FontSubsetCopy& e : subset.copies) {
+    if (e.sourcePage >= pages.size()) {
+      return false;
+    }
+    const Image& page = pages[e.sourcePage];
+    if (e.source.x + e.source.width > page.width || e.source.y + e.source.height > page.height) {
+      return false;
+    }
+    for (uint32_t y = 0; y < e.source.height; ++y) {
+      const uint8_t* src = &page.pixels[(static_cast<size_t>(e.source.y + y) * page.width + e.source.x) * 4];
+      uint8_t* dest = &atlas.pixels[(static_cast<size_t>(e.dest.y + y) * atlas.width + e.dest.x) * 4];
+      memcpy(dest, src, static_cast<size_t>(e.source.width) * 4);
+    }
+  }
+  return true;
+}
+
+/**
+* kł̃AgXƃtHgt@C݁ÃtHgƔׂʂ\
+*/
+bool WriteSubset(IWICImagingFactory* factory, const char* inputFilename, const FontData& source,
+  const std::string& outputFilename, const std::string& pageFilename, const FontSubset& subset)
+{
+  // ̃y[WǂݍŁAg̉摜ʂ
+  const std::string inputDirectory = GetDirectory(inputFilename);
+  std::vector<Image> pages(source.pages.size());
+  for (size_t j = 0; j < source.pages.size(); ++j) {
+    if (!LoadRgbaImage(factory, inputDirectory + source.pages[j], pages[j])) {
+      fprintf(stderr, "ERROR: %s̓ǂݍ݂Ɏs\n", (inputDirectory + source.pages[j]).c_str());
+      return false;
+    }
+  }
+  Image atlas;
+  if (!ComposeAtlas(subset, pages, atlas)) {
+    fprintf(stderr, "ERROR: 摜y[W͈̔͊Oɂ܂\n");
+    return false;
+  }
+  if (!SavePng(factory, pageFilename, atlas)) {
+    fprintf(stderr, "ERROR: %sɏ߂܂\n", pageFilename.c_str());
+    return false;
+  }
+  const std::string binaryFilename = FontData::GetBinaryFilename(outputFilename.c_str());
+  if (!subset.font.SaveToText(outputFilename.c_str()) ||
+    !subset.font.SaveToBinary(binaryFilename.c_str(), outputFilename.c_str())) {
+    fprintf(stderr, "ERROR: %sɏ߂܂\n", outputFilename.c_str());
+    return false;
+  }
+
+  // 傫ƓǂݍݎԂׂ
+  // Q[̏ŕ̂́AtHg̓ǂݍ݂ƃy[W摜̓WJ
+  uint64_t sourceFileBytes = 0;
+  uint64_t sourceTextureBytes = 0;
+  for (size_t j = 0; j < pages.size(); ++j) {
+    sourceFileBytes += GetFileBytes(inputDirectory + source.pages[j]);
+    sourceTextureBytes += pages[j].pixels.size();
+  }
+  printf("%s -> %s: %zu -> %zu glyphs (%zu missing)\n", inputFilename, outputFilename.c_str(),
+    source.codePoints.size(), subset.font.codePoints.size(), subset.missing.size());
+  printf("  atlas: %zu pages %.0fx%.0f -> 1 page %ux%u\n", source.pages.size(),
+    source.textureSize.x, source.textureSize.y, atlas.width, atlas.height);
+  printf("  texture: %llu -> %zu bytes, png: %llu -> %llu bytes\n",
+    static_cast<unsigned long long>(sourceTextureBytes), atlas.pixels.size(),
+    static_cast<unsigned long long>(sourceFileBytes),
+    static_cast<unsigned long long>(GetFileBytes(pageFilename)));
+
+  double sourceFirst, sourceBest, subsetFirst, subsetBest;
+  FontData work;
+  Image image;
+  Measure([&] {
+    work.Load(inputFilename);
+    for (const std::string& e : source.pages) {
+      LoadRgbaImage(factory, inputDirectory + e, image);
+    }
+  }, sourceFirst, sourceBest);
+  Measure([&] {
+    work.Load(outputFilename.c_str());
+    LoadRgbaImage(factory, pageFilename, image);
+  }, subsetFirst, subsetBest);
+  printf("  load: first %.3f -> %.3f ms, best %.3f -> %.3f ms\n",
+    sourceFirst, subsetFirst, sourceBest, subsetBest);
+  return true;
+}
+
+} // unnamed namespace
+
+/**
+* Gg[|Cg
+*/
+int main(int argc, char** argv)
+{
+  bool addAscii = true;
+  uint32_t padding = 1;
+  uint32_t maxSize = 4096;
+  int i = 1;
+  for (; i < argc && argv[i][0] == '-'; ++i) {
+    if (strcmp(argv[i], "-noascii") == 0) {
+      addAscii = false;
+    } else if (strcmp(argv[i], "-padding") == 0 && i + 1 < argc) {
+      padding = static_cast<uint32_t>(atoi(argv[++i]));
+    } else if (strcmp(argv[i], "-maxsize") == 0 && i + 1 < argc) {
+      maxSize = static_cast<uint32_t>(atoi(argv[++i]));
+    } else {
+      fprintf(stderr, "ERROR: sȃIvV%s\n", argv[i]);
+      return 1;
+    }
+  }
+  if (argc - i < 3) {
+    printf("usage: font_subset [-noascii] [-padding n] [-maxsize n] <input.fnt> <output.fnt> <sources...>\n");
+    return 1;
+  }
+  const char* inputFilename = argv[i];
+  const std::string outputFilename = argv[i + 1];
+
+  // gW߂
+  std::vector<uint32_t> codePoints;
+  if (addAscii) {
+    AddPrintableAsciiCodePoints(codePoints);
+  }
+  for (int j = i + 2; j < argc; ++j) {
+    const std::string ext = GetExtension(argv[j]);
+    if (ext == ".edc") {
+      if (!AddCaptureCodePoints(argv[j], codePoints)) {
+        fprintf(stderr, "ERROR: %s̓ǂݍ݂Ɏs\n", argv[j]);
+        return 1;
+      }
+      continue;
+    }
+    std::string content;
+    if (!ReadTextFile(argv[j], content)) {
+      fprintf(stderr, "ERROR: %sJ܂\n", argv[j]);
+      return 1;
+    }
+    if (ext == ".cpp" || ext == ".h" || ext == ".hpp") {
+      AddStringLiteralCodePoints(content.data(), content.size(), codePoints);
+    } else {
+      AddTextCodePoints(content.data(), content.size(), codePoints);
+    }
+  }
+
+  FontData source;
+  if (!source.Load(inputFilename)) {
+    fprintf(stderr, "ERROR: %s̓ǂݍ݂Ɏs(line=%d)\n", inputFilename, source.errorLine);
+    return 1;
+  }
+
+  // AgX̃t@ĆAo̓t@C̊gq.pngɒu
+  const std::string outputDirectory = GetDirectory(outputFilename);
+  std::string pageFilename = outputFilename;
+  const size_t dot = pageFilename.find_last_of("./\\");
+  if (dot != std::string::npos && pageFilename[dot] == '.') {
+    pageFilename.resize(dot);
+  }
+  pageFilename += ".png";
+  const std::string pageName = pageFilename.substr(outputDirectory.size());
+
+  FontSubset subset;
+  if (!BuildFontSubset(source, codePoints, padding, maxSize, pageName, subset)) {
+    fprintf(stderr, "ERROR: %ux%ũAgXɓ肫܂\n", maxSize, maxSize);
+    return 1;
+  }
+  for (uint32_t c : subset.missing) {
+    fprintf(stderr, "WARNING: U+%04X̓tHgɂ܂\n", c);
+  }
+
+  if (FAILED(CoInitializeEx(nullptr, COINIT_MULTITHREADED))) {
+    fprintf(stderr, "ERROR: COM̏Ɏs\n");
+    return 1;
+  }
+  bool result = false;
+  {
+    ComPtr<IWICImagingFactory> factory;
+    if (SUCCEEDED(CoCreateInstance(CLSID_WICImagingFactory, nullptr, CLSCTX_INPROC_SERVER, IID_PPV_ARGS(&factory)))) {
+      result = WriteSubset(factory.Get(), inputFilename, source, outputFilename, pageFilename, subset);
+    } else {
+      fprintf(stderr, "ERROR: WIC̏Ɏs\n");
+    }
+  }
+  CoUninitialize();
+  return result ? 0 : 1;
+}
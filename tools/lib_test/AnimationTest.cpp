@@ -0,0 +1,216 @@
+/**
+* @file AnimationTest.cpp
+*
+* AnimationSystem̃eXgƃx`}[N
+*/
+#include "LibTest.h"
+#include "../../src/lib/Animation.h"
+#include <stdio.h>
+#include <vector>
+
+using namespace EasyLib;
+
+namespace /* unnamed */ {
+
+/**
+* 1Ԃi߂ȂAẻ摜W߂
+*/
+std::vector<uint32_t> CollectImages(AnimationSystem& system, uint32_t handle, size_t ticks)
+{
+  std::vector<uint32_t> images;
+  images.push_back(system.GetImage(handle));
+  for (size_t i = 1; i < ticks; ++i) {
+    system.Update(1);
+    images.push_back(system.GetImage(handle));
+  }
+  return images;
+}
+
+} // unnamed namespace
+
+/**
+* Loop͕\Ԃǂɉ摜؂ւAŌ܂ōsŏɖ߂邱
+*/
+LIB_TEST(Animation_Loop)
+{
+  AnimationSystem system;
+  LIB_CHECK(system.Init(16));
+  const uint32_t images[] = { 10, 20, 30 };
+  const uint32_t durations[] = { 2, 1, 3 };
+  const uint32_t clip = system.CreateClip(images, durations, 3, AnimationSystem::LoopMode::Loop);
+  LIB_CHECK(clip != AnimationSystem::invalidClip);
+  const uint32_t handle = system.Play(clip);
+  LIB_CHECK(handle != AnimationSystem::invalidHandle);
+
+  const std::vector<uint32_t> expected = { 10, 10, 20, 30, 30, 30, 10, 10, 20, 30, 30, 30, 10 };
+  LIB_CHECK(CollectImages(system, handle, expected.size()) == expected);
+  LIB_CHECK(!system.IsFinished(handle));
+}
+
+/**
+* PingPong͗[̉摜JԂɉ邱
+*/
+LIB_TEST(Animation_PingPong)
+{
+  AnimationSystem system;
+  LIB_CHECK(system.Init(16));
+  const uint32_t images[] = { 1, 2, 3, 4 };
+  const uint32_t durations[] = { 1, 2, 1, 1 };
+  const uint32_t clip = system.CreateClip(images, durations, 4, AnimationSystem::LoopMode::PingPong);
+  const uint32_t handle = system.Play(clip);
+
+  const std::vector<uint32_t> expected = { 1, 2, 2, 3, 4, 3, 2, 2, 1, 2, 2, 3, 4 };
+  LIB_CHECK(CollectImages(system, handle, expected.size()) == expected);
+  LIB_CHECK(!system.IsFinished(handle));
+
+  // 摜ЂƂȂLoopƓ
+  const uint32_t single = system.CreateClip(images, durations, 1, AnimationSystem::LoopMode::PingPong);
+  const uint32_t singleHandle = system.Play(single);
+  LIB_CHECK(CollectImages(system, singleHandle, 3) == std::vector<uint32_t>({ 1, 1, 1 }));
+}
+
+/**
+* xɐi߂Ԃ́A1i߂ꍇƓʒuɂȂ邱
+* Once͍Ō̉摜Ŏ~܂AŏIƂɂȂ
+*/
+LIB_TEST(Animation_Accumulate)
+{
+  AnimationSystem system;
+  LIB_CHECK(system.Init(16));
+  const uint32_t images[] = { 10, 20, 30 };
+  const uint32_t durations[] = { 2, 1, 3 };
+  const uint32_t loop = system.CreateClip(images, durations, 3, AnimationSystem::LoopMode::Loop);
+  const uint32_t pingPong = system.CreateClip(images, durations, 3, AnimationSystem::LoopMode::PingPong);
+  const uint32_t once = system.CreateClip(images, durations, 3, AnimationSystem::LoopMode::Once);
+
+  // 1i߂Ƃ̉摜ƁA܂Ƃ߂Đi߂Ƃ̉摜ׂ
+  for (uint32_t clip : { loop, pingPong, once }) {
+    const uint32_t a = system.Play(clip);
+    std::vector<uint32_t> ticks;
+    for (uint32_t t = 1; t <= 40; ++t) {
+      system.Update(1);
+      ticks.push_back(system.GetImage(a));
+    }
+    system.Stop(a);
+    for (uint32_t t = 1; t <= 40; ++t) {
+      const uint32_t b = system.Play(clip);
+      system.Update(t);
+      LIB_CHECK(system.GetImage(b) == ticks[t - 1]);
+      system.Stop(b);
+    }
+    // 2ɕĐi߂Ă
+    const uint32_t c = system.Play(clip);
+    system.Update(17);
+    system.Change(c, clip); // Nbvւ̕ύXł͎Ԃ͖߂Ȃ
+    system.Update(9);
+    LIB_CHECK(system.GetImage(c) == ticks[25]);
+    system.Stop(c);
+  }
+
+  const uint32_t handle = system.Play(once);
+  system.Update(4);
+  LIB_CHECK(!system.IsFinished(handle));
+  system.Update(1);
+  LIB_CHECK(system.IsFinished(handle));
+  system.Update(100);
+  LIB_CHECK(system.GetImage(handle) == 30);
+}
+
+/**
+* Nbv̏IɒBƂI֐Ă΂A̒StopĂ悢
+*/
+LIB_TEST(Animation_FinishCallback)
+{
+  AnimationSystem system;
+  LIB_CHECK(system.Init(16));
+  const uint32_t images[] = { 1, 2, 3 };
+  const uint32_t durations[] = { 1, 1, 1 };
+  const uint32_t once = system.CreateClip(images, durations, 3, AnimationSystem::LoopMode::Once);
+  const uint32_t loop = system.CreateClip(images, durations, 3, AnimationSystem::LoopMode::Loop);
+  const uint32_t pingPong = system.CreateClip(images, durations, 3, AnimationSystem::LoopMode::PingPong);
+
+  std::vector<uint32_t> finished;
+  system.SetFinishCallback([&](uint32_t handle) { finished.push_back(handle); });
+  const uint32_t a = system.Play(once);
+  const uint32_t b = system.Play(loop);
+  const uint32_t c = system.Play(pingPong);
+
+  system.Update(1);
+  LIB_CHECK(finished.empty());
+  system.Update(1); // OnceŌ̉摜ɒB
+  LIB_CHECK(finished == std::vector<uint32_t>({ a }));
+  finished.clear();
+  system.Update(1); // Loop1(Once͎~܂܂܂Ȃ̂ŌĂ΂Ȃ)
+  LIB_CHECK(finished == std::vector<uint32_t>({ b }));
+  finished.clear();
+  system.Update(1); // PingPong1(1, 2, 3, 2)
+  LIB_CHECK(finished == std::vector<uint32_t>({ c }));
+  finished.clear();
+  system.Update(7); // 7ԂLoopPingPong1͏Iz
+  LIB_CHECK(finished.size() == 2);
+  finished.clear();
+
+  // I֐̒Ŏ~߂CX^X͖ɂȂÃCX^X͂̂܂ܐi
+  const uint32_t d = system.Play(once);
+  system.SetFinishCallback([&](uint32_t handle) {
+    if (handle == d) {
+      system.Stop(handle);
+    }
+  });
+  system.Update(2);
+  LIB_CHECK(!system.IsValid(d));
+  LIB_CHECK(system.IsValid(b));
+  LIB_CHECK(system.GetInstanceCount() == 3);
+}
+
+/**
+* StopŖ̃CX^Xl߂ĂÃnh̉摜ςȂ
+*/
+LIB_TEST(Animation_Stop)
+{
+  AnimationSystem system;
+  LIB_CHECK(system.Init(4));
+  const uint32_t images[] = { 1, 2, 3, 4 };
+  const uint32_t durations[] = { 1, 1, 1, 1 };
+  std::vector<uint32_t> clips;
+  for (int i = 0; i < 4; ++i) {
+    clips.push_back(system.CreateClip(images + i, durations, 1, AnimationSystem::LoopMode::Loop));
+  }
+  std::vector<uint32_t> handles;
+  for (uint32_t clip : clips) {
+    handles.push_back(system.Play(clip));
+  }
+  LIB_CHECK(system.Play(clips[0]) == AnimationSystem::invalidHandle);
+  LIB_CHECK(system.Stop(handles[1]));
+  LIB_CHECK(!system.Stop(handles[1]));
+  LIB_CHECK(system.GetImage(handles[0]) == 1);
+  LIB_CHECK(system.GetImage(handles[2]) == 3);
+  LIB_CHECK(system.GetImage(handles[3]) == 4);
+  LIB_CHECK(system.GetImage(handles[1]) == 0);
+}
+
+/**
+* ̃CX^XUpdateŐi߂鎞
+*
+* ̈Ⴄ8̃NbvɊ蓖Ă
+*/
+LIB_BENCHMARK(Animation_Update)
+{
+  for (uint32_t count : { 1'000u, 10'000u, 65'536u }) {
+    AnimationSystem system;
+    system.Init(count);
+    std::vector<uint32_t> clips;
+    for (uint32_t i = 0; i < 8; ++i) {
+      const uint32_t images[] = { i * 4, i * 4 + 1, i * 4 + 2, i * 4 + 3 };
+      const uint32_t durations[] = { 3 + i, 4, 5, 6 + i };
+      const auto mode = static_cast<AnimationSystem::LoopMode>(i % 3);
+      clips.push_back(system.CreateClip(images, durations, 4, mode));
+    }
+    for (uint32_t i = 0; i < count; ++i) {
+      system.Play(clips[i % clips.size()]);
+    }
+    char name[64];
+    snprintf(name, sizeof(name), "Update %u instances", count);
+    LibTest::Measure(name, 100, count, [&] { system.Update(1); });
+  }
+}
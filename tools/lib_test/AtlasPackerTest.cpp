@@ -0,0 +1,251 @@
+/**
+* @file AtlasPackerTest.cpp
+*
+* AtlasPacker̃eXgƃx`}[N
+*/
+#include "LibTest.h"
+#include "../../src/lib/AtlasPacker.h"
+#include <stdio.h>
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <vector>
+
+using namespace EasyLib::DX12;
+
+namespace /* unnamed */ {
+
+/**
+* 摜̑傫
+*/
+struct ImageSize
+{
+  uint32_t width;
+  uint32_t height;
+};
+
+/**
+* PNGt@CIHDR`N摜̑傫ǂݎ
+*/
+bool ReadPngSize(const std::filesystem::path& filename, ImageSize& size)
+{
+  std::ifstream ifs(filename, std::ios::binary);
+  uint8_t header[24];
+  if (!ifs.read(reinterpret_cast<char*>(header), sizeof(header))) {
+    return false;
+  }
+  static const uint8_t signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n' };
+  if (!std::equal(std::begin(signature), std::end(signature), header)) {
+    return false;
+  }
+  const auto readU32 = [](const uint8_t* p) {
+    return (uint32_t(p[0]) << 24) | (uint32_t(p[1]) << 16) | (uint32_t(p[2]) << 8) | uint32_t(p[3]);
+  };
+  size.width = readU32(header + 16);
+  size.height = readU32(header + 20);
+  return true;
+}
+
+/**
+* Q[̉摜tH_ɂPNG̑傫At@CɏW߂
+*/
+std::vector<ImageSize> LoadGameImageSizes()
+{
+  // res/摜
+  const std::filesystem::path folder = std::filesystem::path(LibTest::GetResourceDirectory()) / u8"摜";
+  std::vector<std::filesystem::path> files;
+  std::error_code ec;
+  for (const auto& e : std::filesystem::directory_iterator(folder, ec)) {
+    if (e.path().extension() == ".png") {
+      files.push_back(e.path());
+    }
+  }
+  std::sort(files.begin(), files.end());
+  std::vector<ImageSize> sizes;
+  for (const auto& e : files) {
+    ImageSize size;
+    if (ReadPngSize(e, size)) {
+      sizes.push_back(size);
+    }
+  }
+  return sizes;
+}
+
+/**
+* TextureAtlasƓ@ŉ摜y[Wɋl߂
+*/
+struct AtlasResult
+{
+  std::vector<AtlasPacker> pages;
+  std::vector<int> textures;  // 摜Ƃ̃eNX`(0ȏ̓y[WԍA̒l͒PƂ̃eNX`)
+  size_t standaloneCount = 0; // 傫ăAgXɓȂ摜̐
+};
+
+/**
+* TextureAtlasƓ@ŉ摜y[Wɋl߂
+*
+* ő̑傫𒴂摜͒PƂ̃eNX`ɂAق͐擪̃y[W珇ɓꏊT
+*/
+AtlasResult PackLikeTextureAtlas(const std::vector<ImageSize>& sizes,
+  uint32_t pageSize, uint32_t maxEntrySize, uint32_t padding)
+{
+  AtlasResult result;
+  for (const ImageSize& e : sizes) {
+    if (e.width > maxEntrySize || e.height > maxEntrySize) {
+      ++result.standaloneCount;
+      result.textures.push_back(-static_cast<int>(result.standaloneCount));
+      continue;
+    }
+    AtlasRect rect;
+    int page = -1;
+    for (size_t i = 0; i < result.pages.size(); ++i) {
+      if (result.pages[i].Pack(e.width, e.height, rect)) {
+        page = static_cast<int>(i);
+        break;
+      }
+    }
+    if (page < 0) {
+      page = static_cast<int>(result.pages.size());
+      result.pages.emplace_back(pageSize, pageSize, padding);
+      result.pages.back().Pack(e.width, e.height, rect);
+    }
+    result.textures.push_back(page);
+  }
+  return result;
+}
+
+/**
+* `揇ɕׂ摜̃eNX`؂ւ+1(eNX`ݒ肷`Pʂ̐)Ԃ
+*/
+size_t CountBatches(const std::vector<uint32_t>& drawOrder, const std::vector<int>& textures)
+{
+  size_t count = 0;
+  int current = 0;
+  for (size_t i = 0; i < drawOrder.size(); ++i) {
+    const int texture = textures[drawOrder[i]];
+    if (i == 0 || texture != current) {
+      ++count;
+      current = texture;
+    }
+  }
+  return count;
+}
+
+// Q[TextureAtlas̐ݒ(lib_2d_game.cppinitializeƓl)
+constexpr uint32_t atlasPageSize = 1024;
+constexpr uint32_t atlasMaxEntrySize = 256;
+constexpr uint32_t atlasPadding = 2;
+
+} // unnamed namespace
+
+/**
+* l߂`AԂ܂߂ăAgX̓Ɏ܂A݂ɏdȂȂ
+*/
+LIB_TEST(AtlasPacker_NoOverlap)
+{
+  constexpr uint32_t padding = 2;
+  std::mt19937 rand(1);
+  std::uniform_int_distribution<uint32_t> size(1, 96);
+  AtlasPacker packer(512, 512, padding);
+  std::vector<AtlasRect> rects;
+  for (int i = 0; i < 1000; ++i) {
+    AtlasRect rect;
+    if (packer.Pack(size(rand), size(rand), rect)) {
+      rects.push_back(rect);
+    }
+  }
+  LIB_CHECK(!rects.empty());
+  LIB_CHECK(packer.GetRectCount() == rects.size());
+  LIB_CHECK(packer.GetOccupancy() > 0 && packer.GetOccupancy() <= 1);
+  for (size_t i = 0; i < rects.size(); ++i) {
+    const AtlasRect& a = rects[i];
+    LIB_CHECK(a.x >= padding && a.y >= padding);
+    LIB_CHECK(a.x + a.width + padding <= 512 && a.y + a.height + padding <= 512);
+    for (size_t j = i + 1; j < rects.size(); ++j) {
+      const AtlasRect& b = rects[j];
+      const bool separated = a.x + a.width + padding * 2 <= b.x || b.x + b.width + padding * 2 <= a.x ||
+        a.y + a.height + padding * 2 <= b.y || b.y + b.height + padding * 2 <= a.y;
+      LIB_CHECK(separated);
+    }
+  }
+}
+
+/**
+* 肫Ȃ傫ƁA傫0̋`͋l߂Ȃ
+*/
+LIB_TEST(AtlasPacker_Reject)
+{
+  AtlasPacker packer(64, 64, 2);
+  AtlasRect rect;
+  LIB_CHECK(!packer.Pack(61, 10, rect));
+  LIB_CHECK(!packer.Pack(0, 10, rect));
+  LIB_CHECK(packer.Pack(60, 60, rect));
+  LIB_CHECK(!packer.Pack(1, 1, rect));
+  LIB_CHECK(packer.GetRectCount() == 1);
+}
+
+/**
+* res/摜PNGQ[ƓݒŃAgXɋl߂鎞ԁAy[WƁA1t[̕`Pʂ̐
+*
+* AgXȂꍇ́A摜1ƂɃeNX`(ƃfXNv^)KvɂȂ
+* `Pʂ́A摜_ȏ2000`ꍇɁAeNX`؂ւ邽т1
+*/
+LIB_BENCHMARK(AtlasPacker_GameImages)
+{
+  const std::vector<ImageSize> sizes = LoadGameImageSizes();
+  if (sizes.empty()) {
+    printf("  no images in %s (use -r to set the resource folder)\n", LibTest::GetResourceDirectory().c_str());
+    return;
+  }
+  AtlasResult result;
+  LibTest::Measure("Pack res images", 1000, sizes.size(), [&] {
+    result = PackLikeTextureAtlas(sizes, atlasPageSize, atlasMaxEntrySize, atlasPadding);
+  });
+  size_t packedCount = 0;
+  for (size_t i = 0; i < result.pages.size(); ++i) {
+    printf("  page %zu: %zu images, occupancy %.1f%%\n",
+      i, result.pages[i].GetRectCount(), result.pages[i].GetOccupancy() * 100);
+    packedCount += result.pages[i].GetRectCount();
+  }
+  printf("  %zu images: %zu in %zu atlas page(s) + %zu standalone = %zu textures (was %zu)\n",
+    sizes.size(), packedCount, result.pages.size(), result.standaloneCount,
+    result.pages.size() + result.standaloneCount, sizes.size());
+
+  std::mt19937 rand(1);
+  std::uniform_int_distribution<uint32_t> image(0, static_cast<uint32_t>(sizes.size() - 1));
+  std::vector<uint32_t> drawOrder(2000);
+  for (uint32_t& e : drawOrder) {
+    e = image(rand);
+  }
+  std::vector<int> imageTextures(sizes.size());
+  for (size_t i = 0; i < imageTextures.size(); ++i) {
+    imageTextures[i] = static_cast<int>(i);
+  }
+  printf("  %zu draws: %zu batches with the atlas (was %zu)\n", drawOrder.size(),
+    CountBatches(drawOrder, result.textures), CountBatches(drawOrder, imageTextures));
+}
+
+/**
+* ʂ̏ȉ摜l߂鎞ԂƐL
+*/
+LIB_BENCHMARK(AtlasPacker_Random)
+{
+  std::mt19937 rand(1);
+  std::uniform_int_distribution<uint32_t> size(16, 128);
+  std::vector<ImageSize> sizes(2000);
+  for (ImageSize& e : sizes) {
+    e.width = size(rand);
+    e.height = size(rand);
+  }
+  AtlasResult result;
+  LibTest::Measure("Pack 2000 random images", 20, sizes.size(), [&] {
+    result = PackLikeTextureAtlas(sizes, atlasPageSize, atlasMaxEntrySize, atlasPadding);
+  });
+  float occupancy = 0;
+  for (const AtlasPacker& e : result.pages) {
+    occupancy += e.GetOccupancy();
+  }
+  printf("  %zu pages, average occupancy %.1f%%\n",
+    result.pages.size(), occupancy * 100 / static_cast<float>(result.pages.size()));
+}
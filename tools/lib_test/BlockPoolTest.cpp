@@ -0,0 +1,68 @@
+/**
+* @file BlockPoolTest.cpp
+*
+* BlockPool̃eXg
+*/
+#include "LibTest.h"
+#include "../../src/lib/BlockPool.h"
+#include <algorithm>
+#include <vector>
+
+using namespace EasyLib::DX12;
+
+/**
+* y[Wǉ܂ł͊mۂłAy[W̃ubNg؂ƊmۂłȂȂ邱
+*/
+LIB_TEST(BlockPool_AddPage)
+{
+  BlockPool pool;
+  pool.Init(4, 2);
+  LIB_CHECK(pool.Allocate() == BlockPool::invalidBlock);
+
+  pool.AddPage();
+  pool.AddPage();
+  LIB_CHECK(pool.GetPageCount() == 2);
+  std::vector<uint32_t> blocks;
+  for (int i = 0; i < 8; ++i) {
+    const uint32_t block = pool.Allocate();
+    LIB_CHECK(block != BlockPool::invalidBlock);
+    blocks.push_back(block);
+  }
+  LIB_CHECK(pool.Allocate() == BlockPool::invalidBlock);
+  LIB_CHECK(pool.GetUsedCount() == 8);
+
+  // ׂĈقȂubNŁAy[Wƃy[Ẅʒuɕ
+  std::sort(blocks.begin(), blocks.end());
+  for (uint32_t i = 0; i < 8; ++i) {
+    LIB_CHECK(blocks[i] == i);
+    LIB_CHECK(pool.GetPage(blocks[i]) == i / 4);
+    LIB_CHECK(pool.GetIndexInPage(blocks[i]) == i % 4);
+  }
+}
+
+/**
+* ubŃAreuseDelayt[o܂ōėpȂ
+*/
+LIB_TEST(BlockPool_ReuseDelay)
+{
+  BlockPool pool;
+  pool.Init(2, 2);
+  pool.AddPage();
+  const uint32_t a = pool.Allocate();
+  LIB_CHECK(pool.Allocate() != BlockPool::invalidBlock);
+  pool.Free(a);
+  pool.Free(BlockPool::invalidBlock); // ȃubN͖
+  LIB_CHECK(pool.GetUsedCount() == 1);
+  LIB_CHECK(pool.Allocate() == BlockPool::invalidBlock);
+  pool.NextFrame();
+  LIB_CHECK(pool.Allocate() == BlockPool::invalidBlock);
+  pool.NextFrame();
+  LIB_CHECK(pool.Allocate() == a);
+
+  // xȂΓt[ōėpł
+  pool.Init(2, 0);
+  pool.AddPage();
+  const uint32_t c = pool.Allocate();
+  pool.Free(c);
+  LIB_CHECK(pool.Allocate() == c);
+}
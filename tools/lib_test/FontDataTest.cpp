@@ -0,0 +1,253 @@
+/**
+* @file FontDataTest.cpp
+*
+* FontDatãeXgƃx`}[N
+*/
+#include "LibTest.h"
+#include "../../src/lib/FontData.h"
+#include "../../src/lib/Utf8.h"
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+using namespace EasyLib::DX12;
+
+namespace /* unnamed */ {
+
+/**
+* Q[̃tHgt@C
+*/
+std::string GetGameFontFilename()
+{
+  return LibTest::GetResourceDirectory() + "/font/font.fnt";
+}
+
+/**
+* ̕gy[W̃rbgԂ
+*
+* tHgɂȂ͖
+*/
+uint32_t CollectPages(const FontData& font, const char8_t* text)
+{
+  uint32_t pageMask = 0;
+  const char* p = reinterpret_cast<const char*>(text);
+  const char* const end = p + strlen(p);
+  while (p < end) {
+    const char32_t c = EasyLib::DecodeUtf8(p, end);
+    const auto itr = std::lower_bound(font.codePoints.begin(), font.codePoints.end(), static_cast<uint32_t>(c));
+    if (itr != font.codePoints.end() && *itr == c) {
+      pageMask |= 1u << font.glyphs[itr - font.codePoints.begin()].page;
+    }
+  }
+  return pageMask;
+}
+
+/**
+* t@CLbVɂȂԂAVFontDataɓǂݍގԂv
+*
+* 1ڂ̎ԂƁAc̍ŏԂ\
+*/
+template<typename F>
+void MeasureColdLoad(const char* name, const char* filename, size_t count, F&& load)
+{
+  constexpr int loopCount = 5;
+  uint64_t first = 0;
+  uint64_t best = UINT64_MAX;
+  for (int i = 0; i < loopCount; ++i) {
+    if (!LibTest::DropFileCache(filename)) {
+      printf("  %-40s (cannot drop the file cache on this platform)\n", name);
+      return;
+    }
+    FontData font;
+    const uint64_t start = LibTest::Now();
+    load(font);
+    const uint64_t ns = LibTest::Now() - start;
+    if (i == 0) {
+      first = ns;
+    } else if (ns < best) {
+      best = ns;
+    }
+  }
+  LibTest::PrintMeasure(name, first, best, count);
+}
+
+} // unnamed namespace
+
+/**
+* ϊς݃t@CɕۑēǂݍނƁAf[^ɂȂ邱
+*/
+LIB_TEST(FontData_BinaryRoundTrip)
+{
+  FontData font;
+  font.fontSize = 32;
+  font.paddingUp = 3;
+  font.paddingLeft = 2;
+  font.textureSize = { 256, 128 };
+  font.pages = { "a.png", "b.png" };
+  for (uint32_t c : { 0x20u, 0x41u, 0x3042u }) {
+    FontInfoInShader glyph = {};
+    glyph.page = c > 0x80 ? 1 : 0;
+    glyph.size = { static_cast<float>(c % 32), 20 };
+    font.codePoints.push_back(c);
+    font.advances.push_back(static_cast<float>(c % 17));
+    font.glyphs.push_back(glyph);
+  }
+  const char filename[] = "lib_test_font.tmp";
+  LIB_CHECK(font.SaveToBinary(filename, nullptr));
+  FontData loaded;
+  LIB_CHECK(loaded.LoadFromBinary(filename));
+  remove(filename);
+  LIB_CHECK(loaded.isBinary);
+  LIB_CHECK(loaded.fontSize == 32 && loaded.paddingUp == 3 && loaded.paddingLeft == 2);
+  LIB_CHECK(loaded.textureSize.x == 256 && loaded.textureSize.y == 128);
+  LIB_CHECK(loaded.pages == font.pages);
+  LIB_CHECK(loaded.codePoints == font.codePoints);
+  LIB_CHECK(loaded.advances == font.advances);
+  LIB_CHECK(loaded.glyphs.size() == 3 && loaded.glyphs[2].page == 1 && loaded.glyphs[1].size.x == 0x41 % 32);
+}
+
+/**
+* Q[̃tHgeLXg`ƕϊς݌`œǂݍނƁAf[^ɂȂ邱
+*
+* font_convertƓAϊ̃t@CL^ĕۑAw肵ēǂݍ
+*/
+LIB_TEST(FontData_GameFontTextMatchesBinary)
+{
+  const std::string filename = GetGameFontFilename();
+  FontData text;
+  LIB_CHECK(text.LoadFromText(filename.c_str()));
+  LIB_CHECK(!text.isBinary && text.codePoints.size() > 0);
+  const char binaryFilename[] = "lib_test_font.tmp";
+  LIB_CHECK(text.SaveToBinary(binaryFilename, filename.c_str()));
+  FontData binary;
+  LIB_CHECK(binary.LoadFromBinary(binaryFilename, filename.c_str()));
+  remove(binaryFilename);
+  LIB_CHECK(binary.isBinary);
+  LIB_CHECK(binary.IsSameData(text));
+  LIB_CHECK(binary.codePoints.size() == text.codePoints.size());
+  LIB_CHECK(binary.pages == text.pages);
+
+  // 1łႦΓƂ݂͂ȂȂ
+  binary.advances.back() += 1;
+  LIB_CHECK(!binary.IsSameData(text));
+}
+
+/**
+* Q[̃tHg̓ǂݍݎ
+*
+* eLXg`(fscanfŉ͂)ƁAfont_convertŕϊoCi`ׂ
+* cold́At@CLbVǂot@CVFontDataɓǂݍގ(Nɑ)
+*/
+LIB_BENCHMARK(FontData_Load)
+{
+  const std::string filename = GetGameFontFilename();
+  const char binaryFilename[] = "lib_test_font.tmp";
+  FontData font;
+  if (!font.LoadFromText(filename.c_str())) {
+    printf("  cannot load %s (use -r to set the resource folder)\n", filename.c_str());
+    return;
+  }
+  if (!font.SaveToBinary(binaryFilename, nullptr)) {
+    printf("  cannot write %s\n", binaryFilename);
+    return;
+  }
+  const size_t count = font.codePoints.size();
+  MeasureColdLoad("FontData::LoadFromText (cold)", filename.c_str(), count, [&](FontData& e) {
+    e.LoadFromText(filename.c_str());
+  });
+  MeasureColdLoad("FontData::LoadFromBinary (cold)", binaryFilename, count, [&](FontData& e) {
+    e.LoadFromBinary(binaryFilename);
+  });
+  LibTest::Measure("FontData::LoadFromText", 10, count, [&] {
+    font.LoadFromText(filename.c_str());
+  });
+  LibTest::Measure("FontData::LoadFromBinary", 10, count, [&] {
+    font.LoadFromBinary(binaryFilename);
+  });
+  remove(binaryFilename);
+  printf("  %zu glyphs, %zu pages\n", font.codePoints.size(), font.pages.size());
+}
+
+/**
+* Q[̃tHgŁAʂƂɕKvȃtHg摜
+*
+* NɂׂẴy[WǂݍޏꍇƁAzuƂɕKvȃy[Wǂݍޏꍇ
+* N̓ǂݍݎԂƏ풓(RGBA8̃eNX`Ƃ)ׂ
+* NԂ̓t@CLbVɂȂԂ̓ǂݍݎԂŁAPNG̓WJGPUւ̓]͊܂܂Ȃ
+*/
+LIB_BENCHMARK(FontData_GamePages)
+{
+  const std::string filename = GetGameFontFilename();
+  FontData font;
+  if (!font.LoadFromText(filename.c_str())) {
+    printf("  cannot load %s (use -r to set the resource folder)\n", filename.c_str());
+    return;
+  }
+  const size_t pageBytes = static_cast<size_t>(font.textureSize.x) * static_cast<size_t>(font.textureSize.y) * 4;
+  printf("  %zu glyphs, %zu pages of %.0fx%.0f (%.1f MB each)\n", font.codePoints.size(), font.pages.size(),
+    font.textureSize.x, font.textureSize.y, static_cast<double>(pageBytes) / (1024 * 1024));
+  printf("  load all pages at startup: %.1f MB\n",
+    static_cast<double>(pageBytes * font.pages.size()) / (1024 * 1024));
+
+  // Nɓǂݍރt@C: O̓tHgt@CƂׂẴy[WA̓tHgt@C
+  const std::string directory = LibTest::GetResourceDirectory() + "/font/";
+  uint64_t fontNanoseconds = 0;
+  LibTest::DropFileCache(filename.c_str());
+  {
+    FontData cold;
+    const uint64_t start = LibTest::Now();
+    cold.LoadFromText(filename.c_str());
+    fontNanoseconds = LibTest::Now() - start;
+  }
+  uint64_t pageNanoseconds = 0;
+  size_t pageFileBytes = 0;
+  size_t missingPageCount = 0;
+  std::vector<char> buffer;
+  for (const std::string& page : font.pages) {
+    const std::string path = directory + page;
+    LibTest::DropFileCache(path.c_str());
+    const uint64_t start = LibTest::Now();
+    FILE* fp = fopen(path.c_str(), "rb");
+    if (!fp) {
+      ++missingPageCount;
+      continue;
+    }
+    fseek(fp, 0, SEEK_END);
+    buffer.resize(static_cast<size_t>(ftell(fp)));
+    fseek(fp, 0, SEEK_SET);
+    pageFileBytes += fread(buffer.data(), 1, buffer.size(), fp);
+    fclose(fp);
+    pageNanoseconds += LibTest::Now() - start;
+  }
+  printf("  startup before: font %.3f ms + %zu page file(s) %.3f ms (%zu bytes, %zu missing), %.1f MB resident\n",
+    static_cast<double>(fontNanoseconds) * 1e-6, font.pages.size() - missingPageCount,
+    static_cast<double>(pageNanoseconds) * 1e-6, pageFileBytes, missingPageCount,
+    static_cast<double>(pageBytes * font.pages.size()) / (1024 * 1024));
+  printf("  startup after:  font %.3f ms, 0 pages, 0.0 MB resident (pages load on first use, below)\n",
+    static_cast<double>(fontNanoseconds) * 1e-6);
+
+  struct Scene {
+    const char* name;
+    std::vector<const char8_t*> texts;
+  };
+  const Scene scenes[] = {
+    { "title", { u8"PRESS ENTER KEY" } },
+    { "game", { u8"SCORE:0123456789" } },
+    { "game over", { u8"GAME OVER", u8"SCORE:0123456789" } },
+    { "japanese", { u8"" } },
+  };
+  for (const Scene& scene : scenes) {
+    uint32_t pageMask = 0;
+    for (const char8_t* text : scene.texts) {
+      pageMask |= CollectPages(font, text);
+    }
+    size_t pageCount = 0;
+    for (uint32_t mask = pageMask; mask; mask &= mask - 1) {
+      ++pageCount;
+    }
+    printf("  %-12s page mask 0x%x: %zu page(s), %.1f MB\n", scene.name, pageMask, pageCount,
+      static_cast<double>(pageBytes * pageCount) / (1024 * 1024));
+  }
+}
@@ -0,0 +1,210 @@
+/**
+* @file FontSubsetTest.cpp
+*
+* font_subsetōkł̃tHg̃eXgƃx`}[N
+*/
+#include "LibTest.h"
+#include "../font_subset/FontSubset.h"
+#include "../../src/lib/GlyphTable.h"
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+using namespace EasyLib::DX12;
+
+namespace /* unnamed */ {
+
+/**
+* Q[ŕ\镶
+*/
+const char8_t gameText[] =
+  u8"PRESS ENTER KEY\nSCORE:0123456789\nGAME OVER\n";
+
+/**
+* kł̃tHgt@C(AgX̃t@C͊gq.pngɂ)
+*/
+const char subsetFilename[] = "lib_test_font_subset.fnt";
+const char subsetPageName[] = "lib_test_font_subset.png";
+
+/**
+* font_subsetƓA\łASCIIƕ͂̕W߂
+*/
+std::vector<uint32_t> CollectGameCodePoints()
+{
+  std::vector<uint32_t> codePoints;
+  AddPrintableAsciiCodePoints(codePoints);
+  const char* text = reinterpret_cast<const char*>(gameText);
+  AddTextCodePoints(text, strlen(text), codePoints);
+  return codePoints;
+}
+
+/**
+* RGBA8̃eNX`ƂĂ̑傫
+*/
+double GetTextureMegabytes(const FontData& font)
+{
+  return font.textureSize.x * font.textureSize.y * 4 * static_cast<double>(font.pages.size()) / (1024 * 1024);
+}
+
+/**
+* t@CLbVɂȂԂƁAԂŁAVFontDataɓǂݍގԂv
+*/
+template<typename F>
+void MeasureLoad(const char* name, const char* filename, size_t count, F&& load)
+{
+  constexpr int loopCount = 5;
+  uint64_t first = 0;
+  uint64_t best = UINT64_MAX;
+  for (int i = 0; i < loopCount; ++i) {
+    LibTest::DropFileCache(filename);
+    FontData font;
+    const uint64_t start = LibTest::Now();
+    load(font);
+    const uint64_t ns = LibTest::Now() - start;
+    if (i == 0) {
+      first = ns;
+    } else if (ns < best) {
+      best = ns;
+    }
+  }
+  LibTest::PrintMeasure((std::string(name) + " (cold)").c_str(), first, best, count);
+  FontData font;
+  LibTest::Measure(name, 10, count, [&] { load(font); });
+}
+
+} // unnamed namespace
+
+/**
+* 񃊃e̒̕W߁ARgAeAGXP[vV[PX̐܂߂Ȃ
+*/
+LIB_TEST(FontSubset_StringLiteral)
+{
+  const char source[] =
+    "// \"X\"\n"
+    "/* \"Y\" */\n"
+    "const char* a = \"A\\\"B\\x41\\n\";\n"
+    "char c = 'Z';\n";
+  std::vector<uint32_t> codePoints;
+  AddStringLiteralCodePoints(source, strlen(source), codePoints);
+  LIB_CHECK(codePoints == std::vector<uint32_t>({ 'A', '"', 'B' }));
+}
+
+/**
+* Q[̃tHgkłAۑēǂݍނƁAW߂ׂĈ邱
+*
+* 蕝A傫A\ʒû͌̃tHgƓŁA摜̓AgX̒ɏdȂ炸ɒu邱
+*/
+LIB_TEST(FontSubset_RoundTrip)
+{
+  const std::string filename = LibTest::GetResourceDirectory() + "/font/font.fnt";
+  FontData source;
+  LIB_CHECK(source.LoadFromText(filename.c_str()));
+  std::vector<uint32_t> codePoints = CollectGameCodePoints();
+  codePoints.push_back(0x1f600); // tHgɂȂ(G)
+  FontSubset subset;
+  LIB_CHECK(BuildFontSubset(source, codePoints, 1, 4096, subsetPageName, subset));
+  LIB_CHECK(subset.missing == std::vector<uint32_t>({ 0x1f600 }));
+  codePoints.pop_back();
+
+  const std::string binaryFilename = FontData::GetBinaryFilename(subsetFilename);
+  LIB_CHECK(subset.font.SaveToText(subsetFilename));
+  LIB_CHECK(subset.font.SaveToBinary(binaryFilename.c_str(), subsetFilename));
+  FontData text;
+  LIB_CHECK(text.LoadFromText(subsetFilename));
+  FontData binary;
+  LIB_CHECK(binary.Load(subsetFilename));
+  remove(subsetFilename);
+  remove(binaryFilename.c_str());
+  LIB_CHECK(binary.isBinary && binary.IsSameData(text));
+  LIB_CHECK(text.pages == std::vector<std::string>({ subsetPageName }));
+  LIB_CHECK(text.textureSize.x <= 4096 && text.textureSize.y <= 4096);
+
+  GlyphTable sourceTable;
+  LIB_CHECK(sourceTable.Build(source.codePoints.data(), source.codePoints.size()));
+  GlyphTable table;
+  LIB_CHECK(table.Build(text.codePoints.data(), text.codePoints.size()));
+  for (uint32_t c : codePoints) {
+    const uint32_t index = table.Find(c);
+    LIB_CHECK(index != GlyphTable::noGlyph);
+    if (index == GlyphTable::noGlyph) {
+      continue;
+    }
+    const uint32_t sourceIndex = sourceTable.Find(c);
+    const FontInfoInShader& glyph = text.glyphs[index - 1];
+    const FontInfoInShader& sourceGlyph = source.glyphs[sourceIndex - 1];
+    LIB_CHECK(text.advances[index - 1] == source.advances[sourceIndex - 1]);
+    LIB_CHECK(glyph.page == 0);
+    LIB_CHECK(glyph.size.x == sourceGlyph.size.x && glyph.size.y == sourceGlyph.size.y);
+    LIB_CHECK(glyph.offset.x == sourceGlyph.offset.x && glyph.offset.y == sourceGlyph.offset.y);
+    LIB_CHECK(glyph.uv[0].x >= 0 && glyph.uv[0].y >= 0 && glyph.uv[1].x <= 1 && glyph.uv[1].y <= 1);
+  }
+  LIB_CHECK(text.codePoints.size() == 0x7f - 0x20 + 4); // ASCIIƁuv
+
+  const uint32_t width = static_cast<uint32_t>(text.textureSize.x);
+  const uint32_t height = static_cast<uint32_t>(text.textureSize.y);
+  for (size_t i = 0; i < subset.copies.size(); ++i) {
+    const AtlasRect& a = subset.copies[i].dest;
+    LIB_CHECK(a.x + a.width <= width && a.y + a.height <= height);
+    for (size_t j = i + 1; j < subset.copies.size(); ++j) {
+      const AtlasRect& b = subset.copies[j].dest;
+      LIB_CHECK(a.x + a.width <= b.x || b.x + b.width <= a.x || a.y + a.height <= b.y || b.y + b.height <= a.y);
+    }
+  }
+}
+
+/**
+* Q[̃tHgƁAQ[ŕ\镶̏kł́AAgX̑傫Ɠǂݍݎ
+*
+* AgX̑傫RGBA8̃eNX`ƂČvZ
+* ǂݍݎԂ̓tHg񂾂ŁAPNG̓WJ͊܂܂Ȃ(font_subsetWindowsŗvĕ\)
+* cold́At@CLbVǂot@CVFontDataɓǂݍގ(Nɑ)
+*/
+LIB_BENCHMARK(FontSubset_GameText)
+{
+  const std::string filename = LibTest::GetResourceDirectory() + "/font/font.fnt";
+  FontData source;
+  if (!source.LoadFromText(filename.c_str())) {
+    printf("  cannot load %s (use -r to set the resource folder)\n", filename.c_str());
+    return;
+  }
+  const std::vector<uint32_t> codePoints = CollectGameCodePoints();
+  FontSubset subset;
+  const uint64_t start = LibTest::Now();
+  if (!BuildFontSubset(source, codePoints, 1, 4096, subsetPageName, subset)) {
+    printf("  cannot pack %zu glyphs\n", codePoints.size());
+    return;
+  }
+  const uint64_t buildNanoseconds = LibTest::Now() - start;
+  const std::string binaryFilename = FontData::GetBinaryFilename(subsetFilename);
+  const std::string sourceBinaryFilename = "lib_test_font_source.fntb";
+  if (!subset.font.SaveToText(subsetFilename) ||
+    !subset.font.SaveToBinary(binaryFilename.c_str(), subsetFilename) ||
+    !source.SaveToBinary(sourceBinaryFilename.c_str(), nullptr)) {
+    printf("  cannot write %s\n", subsetFilename);
+    return;
+  }
+
+  const FontData& font = subset.font;
+  printf("  glyphs: %zu -> %zu (built in %.3f ms)\n", source.codePoints.size(), font.codePoints.size(),
+    static_cast<double>(buildNanoseconds) * 1e-6);
+  printf("  atlas:  %zu page(s) %.0fx%.0f (%.1f MB) -> %zu page %.0fx%.0f (%.3f MB)\n",
+    source.pages.size(), source.textureSize.x, source.textureSize.y, GetTextureMegabytes(source),
+    font.pages.size(), font.textureSize.x, font.textureSize.y, GetTextureMegabytes(font));
+
+  MeasureLoad("before: font.fnt", filename.c_str(), source.codePoints.size(), [&](FontData& e) {
+    e.LoadFromText(filename.c_str());
+  });
+  MeasureLoad("before: font.fntb", sourceBinaryFilename.c_str(), source.codePoints.size(), [&](FontData& e) {
+    e.LoadFromBinary(sourceBinaryFilename.c_str());
+  });
+  MeasureLoad("after: subset .fnt", subsetFilename, font.codePoints.size(), [&](FontData& e) {
+    e.LoadFromText(subsetFilename);
+  });
+  MeasureLoad("after: subset .fntb", binaryFilename.c_str(), font.codePoints.size(), [&](FontData& e) {
+    e.LoadFromBinary(binaryFilename.c_str());
+  });
+  remove(subsetFilename);
+  remove(binaryFilename.c_str());
+  remove(sourceBinaryFilename.c_str());
+}
@@ -0,0 +1,211 @@
+/**
+* @file GlyphLayoutTest.cpp
+*
+* LayoutGlyphs̃eXgƃx`}[N
+*/
+#include "LibTest.h"
+#include "../../src/lib/GlyphLayout.h"
+#include "../../src/lib/Utf8.h"
+#include <stdio.h>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace EasyLib;
+using namespace EasyLib::DX12;
+
+namespace /* unnamed */ {
+
+/**
+* eXgp̃tHg
+*
+* ASCIỈpƋ󔒁A̓{̕. 󔒂͉摜̂Ȃɂ
+* 蕝͎ۂ̃tHgƓɂ
+*/
+struct TestFont
+{
+  GlyphTable glyphTable;
+  std::vector<float> advances;
+  std::vector<uint8_t> visible;
+  GlyphLayoutFont font;
+
+  TestFont() {
+    std::vector<uint32_t> codePoints;
+    for (uint32_t c = 0x20; c < 0x7f; ++c) {
+      codePoints.push_back(c);
+    }
+    const uint32_t japanese[] = { 0x3042, 0x3044, 0x3046, 0x65e5, 0x672c, 0x8a9e, 0x3002 }; // {B
+    codePoints.insert(codePoints.end(), std::begin(japanese), std::end(japanese));
+    glyphTable.Build(codePoints.data(), codePoints.size());
+
+    // 0Ԃ͕\ɂȂ. 摜͂Ȃ蕝͂
+    advances.push_back(12);
+    visible.push_back(0);
+    for (uint32_t c : codePoints) {
+      advances.push_back(c < 0x80 ? static_cast<float>(8 + c % 5) : 24);
+      visible.push_back(c == ' ' ? 0 : 1);
+    }
+    font.glyphTable = &glyphTable;
+    font.advances = advances.data();
+    font.visible = visible.data();
+    font.lineHeight = 28;
+  }
+};
+
+/**
+* LayoutGlyphsLayoutGlyphsScalařʂv邩ׂ
+*
+* g嗦́A蕝Ƃ̐ςmɕ\lg
+*/
+bool LayoutMatchesScalar(const TestFont& font, const std::string& text, const DirectX::XMFLOAT2& scale)
+{
+  std::vector<GlyphInShader> expected(text.size() + 1);
+  std::vector<GlyphInShader> actual(text.size() + 1);
+  const size_t expectedCount = LayoutGlyphsScalar(text.data(), text.size(), font.font, scale, 3, expected.data());
+  const size_t actualCount = LayoutGlyphs(text.data(), text.size(), font.font, scale, 3, actual.data());
+  if (expectedCount != actualCount) {
+    return false;
+  }
+  for (size_t i = 0; i < actualCount; ++i) {
+    const GlyphInShader& a = expected[i];
+    const GlyphInShader& b = actual[i];
+    if (a.offset.x != b.offset.x || a.offset.y != b.offset.y || a.fontIndex != b.fontIndex || a.run != b.run) {
+      return false;
+    }
+  }
+  return true;
+}
+
+const DirectX::XMFLOAT2 testScales[] = { { 1, 1 }, { 2, 2 }, { 0.5f, 0.5f }, { 1.5f, 0.75f } };
+
+} // unnamed namespace
+
+/**
+* ̈ʒuƕԍ
+*/
+LIB_TEST(GlyphLayout_Positions)
+{
+  const TestFont font;
+  const std::string text = "A b\n\xe6\x97\xa5"; // "A b\n"
+  GlyphInShader glyphs[8];
+  const size_t count = LayoutGlyphs(text.data(), text.size(), font.font, { 2, 2 }, 5, glyphs);
+  LIB_CHECK(count == 3);
+  // 'A'(0x41)̑蕝8 + 0x41 % 5 = 8A󔒂8 + 0x20 % 5 = 10
+  LIB_CHECK(glyphs[0].offset.x == 0 && glyphs[0].offset.y == 0);
+  LIB_CHECK(glyphs[0].fontIndex == font.glyphTable.Find('A') && glyphs[0].run == 5);
+  LIB_CHECK(glyphs[1].offset.x == (8 + 10) * 2 && glyphs[1].offset.y == 0);
+  LIB_CHECK(glyphs[1].fontIndex == font.glyphTable.Find('b'));
+  // sgA\ɂȂ(0)̑蕝i(ȑO̔zuƓ)
+  LIB_CHECK(glyphs[2].offset.x == 12 * 2 && glyphs[2].offset.y == 28 * 2);
+  LIB_CHECK(glyphs[2].fontIndex == font.glyphTable.Find(0x65e5));
+}
+
+/**
+* ASCII̕ŁAQƗp̔ėpłƌʂv邱
+*/
+LIB_TEST(GlyphLayout_MatchesScalar_Ascii)
+{
+  const TestFont font;
+  for (const auto& scale : testScales) {
+    LIB_CHECK(LayoutMatchesScalar(font, "", scale));
+    LIB_CHECK(LayoutMatchesScalar(font, "SCORE:12345", scale));
+    LIB_CHECK(LayoutMatchesScalar(font, "PRESS ENTER KEY  ", scale));
+  }
+}
+
+/**
+* {܂ޕŁAQƗp̔ėpłƌʂv邱
+*/
+LIB_TEST(GlyphLayout_MatchesScalar_Japanese)
+{
+  const TestFont font;
+  for (const auto& scale : testScales) {
+    LIB_CHECK(LayoutMatchesScalar(font, "\xe6\x97\xa5\xe6\x9c\xac\xe8\xaa\x9e", scale)); // {
+    LIB_CHECK(LayoutMatchesScalar(font, "x\xe3\x81\x82y\xe3\x81\x84 z\xe3\x80\x82", scale)); // xy zB
+  }
+}
+
+/**
+* s܂ޕŁAQƗp̔ėpłƌʂv邱
+*/
+LIB_TEST(GlyphLayout_MatchesScalar_Newline)
+{
+  const TestFont font;
+  for (const auto& scale : testScales) {
+    LIB_CHECK(LayoutMatchesScalar(font, "GAME\nOVER", scale));
+    LIB_CHECK(LayoutMatchesScalar(font, "\n\nA\n", scale));
+    LIB_CHECK(LayoutMatchesScalar(font, "\xe3\x81\x82\n\xe3\x81\x84\nB", scale)); // \n\nB
+  }
+}
+
+/**
+* tHgɂȂsȃoCg܂ޕŁAQƗp̔ėpłƌʂv邱
+*/
+LIB_TEST(GlyphLayout_MatchesScalar_MissingGlyph)
+{
+  const TestFont font;
+  for (const auto& scale : testScales) {
+    LIB_CHECK(LayoutMatchesScalar(font, "A\xe6\xbc\xa2Z", scale)); // ̓tHgɂȂ
+    LIB_CHECK(LayoutMatchesScalar(font, "\xf0\x9f\x98\x80!", scale)); // 4oCg̕
+    LIB_CHECK(LayoutMatchesScalar(font, "\xff\xe3\x81Q\x80", scale)); // sȃoCg
+    LIB_CHECK(LayoutMatchesScalar(font, "\t\x7f", scale)); // 䕶
+  }
+}
+
+/**
+* _ȕŁAQƗp̔ėpłƌʂv邱
+*/
+LIB_TEST(GlyphLayout_MatchesScalar_Random)
+{
+  const TestFont font;
+  const char32_t alphabet[] = { 'a', 'Z', '0', ' ', '\n', 0x3042, 0x65e5, 0x6f22, 0x1f600, 0x7f };
+  std::mt19937 rand(1);
+  std::uniform_int_distribution<size_t> length(0, 80);
+  std::uniform_int_distribution<size_t> letter(0, std::size(alphabet) - 1);
+  bool same = true;
+  for (int i = 0; i < 2000; ++i) {
+    std::string text;
+    for (size_t n = length(rand); n > 0; --n) {
+      AppendUtf8(text, alphabet[letter(rand)]);
+    }
+    same &= LayoutMatchesScalar(font, text, testScales[i % std::size(testScales)]);
+  }
+  LIB_CHECK(same);
+}
+
+/**
+* 10zu鎞ԂƁA1t[̃Abv[h
+*
+* _[W\̂悤ȒZ񂪑ʂɂʂz肷
+* 񂲂Ƃ̃f[^ɂ܂Ƃ߂ÓA1Ƃ64oCg̕f[^𑗂Ă
+*/
+LIB_BENCHMARK(GlyphLayout_Benchmark)
+{
+  constexpr size_t glyphCount = 100'000;
+  const TestFont font;
+  std::vector<std::string> texts;
+  size_t length = 0;
+  for (int i = 0; length < glyphCount; ++i) {
+    texts.push_back("DMG " + std::to_string(100000 + i * 7919 % 900000));
+    length += texts.back().size();
+  }
+  std::vector<GlyphInShader> glyphs(length);
+  size_t count = 0;
+  LibTest::Measure("LayoutGlyphs", 50, length, [&] {
+    count = 0;
+    for (size_t i = 0; i < texts.size(); ++i) {
+      count += LayoutGlyphs(texts[i].data(), texts[i].size(), font.font, { 1, 1 },
+        static_cast<uint32_t>(i), glyphs.data() + count);
+    }
+  });
+  LibTest::Measure("LayoutGlyphsScalar", 50, length, [&] {
+    count = 0;
+    for (size_t i = 0; i < texts.size(); ++i) {
+      count += LayoutGlyphsScalar(texts[i].data(), texts[i].size(), font.font, { 1, 1 },
+        static_cast<uint32_t>(i), glyphs.data() + count);
+    }
+  });
+  const size_t bytes = sizeof(GlyphRunInShader) * texts.size() + sizeof(GlyphInShader) * count;
+  printf("  %zu strings, %zu glyphs: %zu bytes (%zu per string + %zu per glyph), was %zu bytes (64 per glyph)\n",
+    texts.size(), count, bytes, sizeof(GlyphRunInShader), sizeof(GlyphInShader), size_t(64) * count);
+}
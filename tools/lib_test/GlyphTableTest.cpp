@@ -0,0 +1,202 @@
+/**
+* @file GlyphTableTest.cpp
+*
+* GlyphTablẽeXgƃx`}[N
+*/
+#include "LibTest.h"
+#include "../../src/lib/GlyphTable.h"
+#include "../../src/lib/FontData.h"
+#include <stdio.h>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace EasyLib::DX12;
+
+/**
+* ŏ̃y[W(ASCII)̕邱
+*/
+LIB_TEST(GlyphTable_FirstPage)
+{
+  const uint32_t codePoints[] = { 0x20, 'A', 'z', 0x7e };
+  GlyphTable table;
+  LIB_CHECK(table.Build(codePoints, std::size(codePoints)));
+  LIB_CHECK(table.Find(0x20) == 1);
+  LIB_CHECK(table.Find('A') == 2);
+  LIB_CHECK(table.Find('z') == 3);
+  LIB_CHECK(table.Find(0x7e) == 4);
+  LIB_CHECK(table.GetPageCount() == 2); // ̃y[Wƍŏ̃y[W
+}
+
+/**
+* ̏ȂCJK̃y[WłAo^邱
+*
+* Ԃɂ镶̂Ȃy[W͋̃y[WLAy[WɐȂ
+*/
+LIB_TEST(GlyphTable_SparseCjkPage)
+{
+  const uint32_t codePoints[] = { 'A', 0x3042, 0x65e5, 0x672c, 0x8a9e }; // A{
+  GlyphTable table;
+  LIB_CHECK(table.Build(codePoints, std::size(codePoints)));
+  LIB_CHECK(table.Find(0x3042) == 2);
+  LIB_CHECK(table.Find(0x65e5) == 3);
+  LIB_CHECK(table.Find(0x672c) == 4);
+  LIB_CHECK(table.Find(0x8a9e) == 5);
+  LIB_CHECK(table.Find(0x3043) == GlyphTable::noGlyph); // y[W̓o^ĂȂ
+  LIB_CHECK(table.Find(0x65e4) == GlyphTable::noGlyph);
+  LIB_CHECK(table.GetPageCount() == 6); // ̃y[W + 0x00, 0x30, 0x65, 0x67, 0x8a
+}
+
+/**
+* \ɂȂ́A\͈̔͂̓OǂłnoGlyphɂȂ邱
+*/
+LIB_TEST(GlyphTable_Miss)
+{
+  const uint32_t codePoints[] = { 'A', 0x3042 };
+  GlyphTable table;
+  LIB_CHECK(table.Build(codePoints, std::size(codePoints)));
+  LIB_CHECK(table.Find('B') == GlyphTable::noGlyph);     // ̂y[W
+  LIB_CHECK(table.Find(0x1000) == GlyphTable::noGlyph);  // ̂Ȃy[W
+  LIB_CHECK(table.Find(0x3100) == GlyphTable::noGlyph);  // Ō̃y[W
+  LIB_CHECK(table.Find(GlyphTable::maxCodePoint + 1) == GlyphTable::noGlyph);
+  LIB_CHECK(table.Find(UINT32_MAX) == GlyphTable::noGlyph);
+
+  // ̕\ׂ͂noGlyph
+  GlyphTable empty;
+  LIB_CHECK(empty.Find('A') == GlyphTable::noGlyph);
+  LIB_CHECK(empty.Build(codePoints, 0));
+  LIB_CHECK(empty.Find(0) == GlyphTable::noGlyph);
+}
+
+/**
+* 0xFFFF𒴂镶R[h邱. 0x10FFFF𒴂镶R[h΍쐬Ɏs邱
+*/
+LIB_TEST(GlyphTable_AboveBmp)
+{
+  const uint32_t codePoints[] = { 'A', 0xffff, 0x10000, 0x1f600, GlyphTable::maxCodePoint };
+  GlyphTable table;
+  LIB_CHECK(table.Build(codePoints, std::size(codePoints)));
+  LIB_CHECK(table.Find(0xffff) == 2);
+  LIB_CHECK(table.Find(0x10000) == 3);
+  LIB_CHECK(table.Find(0x1f600) == 4); // G
+  LIB_CHECK(table.Find(GlyphTable::maxCodePoint) == 5);
+  LIB_CHECK(table.Find(0x1f601) == GlyphTable::noGlyph);
+  LIB_CHECK(table.Find(0xf600) == GlyphTable::noGlyph); // 16bitƍȂ
+
+  const uint32_t outOfRange[] = { 'A', GlyphTable::maxCodePoint + 1 };
+  LIB_CHECK(!table.Build(outOfRange, std::size(outOfRange)));
+  LIB_CHECK(table.Find('A') == GlyphTable::noGlyph);
+}
+
+namespace /* unnamed */ {
+
+/**
+* GlyphTablegOFontRendererAR[hƂɎĂ
+*/
+struct FlatFontInfo
+{
+  int id = -1;
+  int page = 0;
+  DirectX::XMFLOAT2 uv[2];
+  DirectX::XMFLOAT2 size;
+  DirectX::XMFLOAT2 offset;
+  float xadvance = 0;
+};
+
+/**
+* ̑蕝̍vAGlyphTablegO65,536vf̔zŋ߂
+*/
+float SumAdvancesFlat(const std::vector<FlatFontInfo>& fontList, const std::vector<uint32_t>& text)
+{
+  float x = 0;
+  for (uint32_t c : text) {
+    if (c < fontList.size()) {
+      x += fontList[c].xadvance;
+    }
+  }
+  return x;
+}
+
+/**
+* ̑蕝̍vAGlyphTableƕԍƂ̔zŋ߂
+*/
+float SumAdvancesTable(const GlyphTable& table, const std::vector<float>& advances, const std::vector<uint32_t>& text)
+{
+  float x = 0;
+  for (uint32_t c : text) {
+    x += advances[table.Find(c)];
+  }
+  return x;
+}
+
+} // unnamed namespace
+
+/**
+* Q[̃tHgŁAR[h瑗蕝Ԃƃ
+*
+* GlyphTablegÓAR[hŒڈ65,536vf̔zƔׂ
+* ̓fR[hς݂̕R[hŁAASCIÎ̂ƁAtHgCJK̕I񂾂̂g
+*/
+LIB_BENCHMARK(GlyphTable_Lookup)
+{
+  const std::string filename = LibTest::GetResourceDirectory() + "/font/font.fnt";
+  FontData data;
+  if (!data.LoadFromText(filename.c_str())) {
+    printf("  cannot load %s (use -r to set the resource folder)\n", filename.c_str());
+    return;
+  }
+
+  // O: R[h -> 
+  std::vector<FlatFontInfo> fontList(65536);
+  for (size_t i = 0; i < data.codePoints.size(); ++i) {
+    if (data.codePoints[i] < fontList.size()) {
+      fontList[data.codePoints[i]].id = static_cast<int>(data.codePoints[i]);
+      fontList[data.codePoints[i]].xadvance = data.advances[i];
+    }
+  }
+  // : R[h -> ԍ -> 蕝(0Ԃ͕ȂƂ)
+  GlyphTable table;
+  table.Build(data.codePoints.data(), data.codePoints.size());
+  std::vector<float> advances(1, 0.0f);
+  advances.insert(advances.end(), data.advances.begin(), data.advances.end());
+
+  const size_t flatBytes = fontList.size() * (sizeof(FlatFontInfo) + sizeof(FontInfoInShader));
+  // FontRendererԍƂɎ: FontInfo(傫Ƒ蕝)A蕝A摜̗LAy[W̃rbg
+  constexpr size_t glyphCpuBytes = sizeof(float) * 3 + sizeof(float) + sizeof(uint8_t) + sizeof(uint32_t);
+  const size_t glyphBytes = (data.codePoints.size() + 1) * (glyphCpuBytes + sizeof(FontInfoInShader));
+  printf("  %zu glyphs, %zu table pages\n", data.codePoints.size(), table.GetPageCount());
+  printf("  before: 65536 x (%zu B FontInfo + %zu B FontInfoInShader) = %zu B\n",
+    sizeof(FlatFontInfo), sizeof(FontInfoInShader), flatBytes);
+  printf("  after:  GlyphTable %zu B + %zu x (%zu B CPU data + %zu B FontInfoInShader) = %zu B\n",
+    table.GetMemorySize(), data.codePoints.size() + 1, glyphCpuBytes, sizeof(FontInfoInShader),
+    table.GetMemorySize() + glyphBytes);
+
+  constexpr size_t length = 4096;
+  std::mt19937 rand(1);
+  std::vector<uint32_t> ascii(length);
+  for (uint32_t& c : ascii) {
+    c = 0x20 + rand() % 0x5f;
+  }
+  std::vector<uint32_t> cjkCodePoints;
+  for (uint32_t c : data.codePoints) {
+    if (c >= 0x3000 && c < 0x10000) {
+      cjkCodePoints.push_back(c);
+    }
+  }
+  if (cjkCodePoints.empty()) {
+    printf("  no CJK glyphs in %s\n", filename.c_str());
+    return;
+  }
+  std::vector<uint32_t> cjk(length);
+  for (uint32_t& c : cjk) {
+    c = cjkCodePoints[rand() % cjkCodePoints.size()];
+  }
+
+  volatile float sink = 0;
+  LibTest::Measure("65536 array, ASCII", 200, length, [&] { sink = SumAdvancesFlat(fontList, ascii); });
+  LibTest::Measure("GlyphTable, ASCII", 200, length, [&] { sink = SumAdvancesTable(table, advances, ascii); });
+  LibTest::Measure("65536 array, CJK", 200, length, [&] { sink = SumAdvancesFlat(fontList, cjk); });
+  LibTest::Measure("GlyphTable, CJK", 200, length, [&] { sink = SumAdvancesTable(table, advances, cjk); });
+  (void)sink;
+}
@@ -0,0 +1,96 @@
+/**
+* @file LibTest.h
+*
+* lib_testŎgAeXgƃx`}[N̓o^p}N
+*/
+#ifndef LIBTEST_LIBTEST_H
+#define LIBTEST_LIBTEST_H
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+
+namespace LibTest {
+
+using Function = void(*)();
+
+/**
+* eXg܂̓x`}[No^
+*
+* LIB_TESTALIB_BENCHMARK}Ng. ÓIϐ̏ŌĂ΂̂ŁAo^̓t@C̏ɂȂ
+*/
+struct Registrar
+{
+  Registrar(bool isBenchmark, const char* name, Function func);
+};
+
+// eXg̎sL^
+void ReportFailure(const char* file, int line, const char* expression);
+
+// 摜r̊摜utH_ƁA摜XV邩ǂ
+const std::string& GetGoldenDirectory();
+bool IsUpdateGolden();
+
+// Q[̉摜tHgutH_(x`}[NŎۂ̃f[^g)
+const std::string& GetResourceDirectory();
+
+// Ԍvp̊֐
+uint64_t Now();
+void PrintMeasure(const char* name, uint64_t firstNanoseconds, uint64_t bestNanoseconds, size_t count);
+
+// t@COS̃t@CLbVǂo(N̓ǂݍݎԂ𑪂邽)
+bool DropFileCache(const char* filename);
+
+/**
+* Ԃv
+*
+* 1ڂ̎ԂƁAc̍ŏԂ\
+*
+* @param name      \
+* @param loopCount v
+* @param count     1񂠂̏(1vf̎Ԃ\邽. 0Ȃ\Ȃ)
+* @param func      v鏈
+*/
+template<typename F>
+void Measure(const char* name, int loopCount, size_t count, F&& func)
+{
+  uint64_t first = 0;
+  uint64_t best = UINT64_MAX;
+  for (int i = 0; i < loopCount; ++i) {
+    const uint64_t start = Now();
+    func();
+    const uint64_t ns = Now() - start;
+    if (i == 0) {
+      first = ns;
+    } else if (ns < best) {
+      best = ns;
+    }
+  }
+  PrintMeasure(name, first, best == UINT64_MAX ? first : best, count);
+}
+
+} // namespace LibTest
+
+#define LIB_TEST_CONCAT2(a, b) a##b
+#define LIB_TEST_CONCAT(a, b) LIB_TEST_CONCAT2(a, b)
+
+// eXg`
+#define LIB_TEST(name) \
+  static void name(); \
+  static const LibTest::Registrar LIB_TEST_CONCAT(registrar_, name)(false, #name, name); \
+  static void name()
+
+// x`}[N`(lib_test benchŎs)
+#define LIB_BENCHMARK(name) \
+  static void name(); \
+  static const LibTest::Registrar LIB_TEST_CONCAT(registrar_, name)(true, #name, name); \
+  static void name()
+
+// UȂeXgsɂ(eXg͑s)
+#define LIB_CHECK(expression) \
+  do { \
+    if (!(expression)) { \
+      LibTest::ReportFailure(__FILE__, __LINE__, #expression); \
+    } \
+  } while (0)
+
+#endif // LIBTEST_LIBTEST_H
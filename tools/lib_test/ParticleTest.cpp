@@ -0,0 +1,114 @@
+/**
+* @file ParticleTest.cpp
+*
+* ParticleSystem̍XVƁAVF[_pf[^ւ̕ϊ̃eXgƃx`}[N
+*/
+#include "LibTest.h"
+#include "../../src/lib/SpritePack.h"
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include <vector>
+
+using namespace EasyLib;
+using namespace EasyLib::DX12;
+
+namespace /* unnamed */ {
+
+/**
+* p[eBN̉摜\(6R}̃Aj[V2)
+*/
+struct ParticleImageTable
+{
+  std::vector<uint16_t> texIDs;
+  std::vector<uint64_t> uvRects;
+  std::vector<float> widths;
+  std::vector<float> heights;
+
+  explicit ParticleImageTable(size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+      texIDs.push_back(static_cast<uint16_t>(i + 1));
+      uvRects.push_back(0xffff'ffff'0000'0000ull);
+      widths.push_back(64);
+      heights.push_back(64);
+    }
+  }
+  ParticleImages Get() const { return { texIDs.data(), uvRects.data(), widths.data(), heights.data() }; }
+};
+
+/**
+* coin_0-5explosion_big_0-5͂p[eBN
+*
+* x`}[N̓rŏȂ悤ɁA͏\ɒĂ
+*/
+void EmitParticles(ParticleSystem& particles, size_t count)
+{
+  const uint32_t images[] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12 };
+  ParticleTypeDesc desc;
+  desc.images = images;
+  desc.imageCount = 6;
+  desc.life = 1e9f;
+  desc.gravity = 0.25f;
+  const uint32_t coin = particles.CreateType(desc);
+  desc.images = images + 6;
+  desc.gravity = 0;
+  desc.scale = 2;
+  const uint32_t explosion = particles.CreateType(desc);
+  for (size_t i = 0; i < count; i += 100) {
+    particles.Emit(i % 200 ? coin : explosion, static_cast<float>(i % 1280), 360, std::min<size_t>(100, count - i));
+  }
+}
+
+/**
+* ϊʂoCgPʂňv邩ׂ
+*/
+bool IsSame(const std::vector<SpriteInShader>& a, const std::vector<SpriteInShader>& b)
+{
+  return a.size() == b.size() && (a.empty() || memcmp(a.data(), b.data(), sizeof(SpriteInShader) * a.size()) == 0);
+}
+
+constexpr float viewHeight = 720;
+
+} // unnamed namespace
+
+/**
+* p[eBNAVX2łƔėpł̌ʂv邱
+*/
+LIB_TEST(PackParticles_MatchesScalar)
+{
+  ParticleSystem particles;
+  particles.Init(1003);
+  EmitParticles(particles, 1003);
+  particles.Update(3);
+  const ParticleImageTable table(particles.GetImageTableSize());
+  std::vector<SpriteInShader> expected(particles.GetCount());
+  std::vector<SpriteInShader> actual(particles.GetCount());
+  PackParticlesScalar(particles, particles.GetCount(), table.Get(), viewHeight, expected.data());
+  PackParticles(particles, particles.GetCount(), table.Get(), viewHeight, actual.data());
+  LIB_CHECK(IsSame(expected, actual));
+}
+
+/**
+* 10p[eBN̍XVƕϊ̎
+*/
+LIB_BENCHMARK(Particles_Benchmark)
+{
+  constexpr size_t count = 100'000;
+  ParticleSystem particles;
+  particles.Init(count);
+  EmitParticles(particles, count);
+  const ParticleImageTable table(particles.GetImageTableSize());
+  std::vector<SpriteInShader> p(count);
+  LibTest::Measure("ParticleSystem::Update", 50, count, [&] { particles.Update(1); });
+  LibTest::Measure("PackParticles", 50, count, [&] {
+    PackParticles(particles, particles.GetCount(), table.Get(), viewHeight, p.data());
+  });
+  LibTest::Measure("PackParticlesScalar", 50, count, [&] {
+    PackParticlesScalar(particles, particles.GetCount(), table.Get(), viewHeight, p.data());
+  });
+  LibTest::Measure("Update + PackParticles", 50, count, [&] {
+    particles.Update(1);
+    PackParticles(particles, particles.GetCount(), table.Get(), viewHeight, p.data());
+  });
+  printf("  %zu live particles\n", particles.GetCount());
+}
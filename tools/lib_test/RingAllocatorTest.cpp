@@ -0,0 +1,163 @@
+/**
+* @file RingAllocatorTest.cpp
+*
+* RingAllocator̃eXg
+*/
+#include "LibTest.h"
+#include "../../src/lib/RingAllocator.h"
+
+using namespace EasyLib::DX12;
+
+namespace /* unnamed */ {
+
+/**
+* GPŨtFX̑ɁAtFXl蓮Ői߂NX
+*/
+struct FakeFence
+{
+  uint64_t nextValue = 1;      // SignalŕԂl
+  uint64_t completedValue = 0; // GPUƂɂl
+
+  uint64_t Signal() { return nextValue++; }
+  void Complete(uint64_t value) { completedValue = value; }
+};
+
+} // unnamed namespace
+
+/**
+* ACgĘAʒuɊmۂ邱
+*/
+LIB_TEST(RingAllocator_Allocate)
+{
+  RingAllocator ring(1024);
+  LIB_CHECK(ring.Allocate(0, 16) == RingAllocator::invalidOffset);
+  LIB_CHECK(ring.Allocate(1025, 16) == RingAllocator::invalidOffset);
+  LIB_CHECK(ring.Allocate(10, 16) == 0);
+  LIB_CHECK(ring.Allocate(10, 16) == 16);
+  LIB_CHECK(ring.Allocate(4, 256) == 256);
+  LIB_CHECK(ring.GetUsedSize() == 260);
+  LIB_CHECK(ring.GetFrameSize() == 260);
+}
+
+/**
+* ɓȂmۂ͐擪ɐ܂ԂAĂȂ͎̈gȂ
+*/
+LIB_TEST(RingAllocator_WrapAround)
+{
+  FakeFence fence;
+  RingAllocator ring(1024);
+  LIB_CHECK(ring.Allocate(400, 1) == 0);
+  const uint64_t fence1 = fence.Signal();
+  ring.FinishFrame(fence1);
+  LIB_CHECK(ring.Allocate(400, 1) == 400);
+  const uint64_t fence2 = fence.Signal();
+  ring.FinishFrame(fence2);
+
+  // ŏ̃t[܂ł͐܂ԂȂ
+  LIB_CHECK(ring.Allocate(300, 1) == RingAllocator::invalidOffset);
+  fence.Complete(fence1);
+  ring.Retire(fence.completedValue);
+  LIB_CHECK(ring.GetPendingFrameCount() == 1);
+
+  // 224oCgɂ͓Ȃ̂Ő擪ɐ܂Ԃ. ]gpƂĐ
+  LIB_CHECK(ring.Allocate(300, 1) == 0);
+  LIB_CHECK(ring.GetUsedSize() == 400 + 224 + 300);
+  LIB_CHECK(ring.GetFrameSize() == 224 + 300);
+  // ܂ԂƂ́A2ڂ̃t[̐擪(400)܂łgȂ
+  LIB_CHECK(ring.Allocate(101, 1) == RingAllocator::invalidOffset);
+  LIB_CHECK(ring.Allocate(100, 1) == 300);
+  const uint64_t fence3 = fence.Signal();
+  ring.FinishFrame(fence3);
+
+  fence.Complete(fence2);
+  ring.Retire(fence.completedValue);
+  LIB_CHECK(ring.GetUsedSize() == 224 + 400);
+}
+
+/**
+* 󂫂ȂȂmۂɎsAƍĂъmۂł邱
+*/
+LIB_TEST(RingAllocator_Full)
+{
+  FakeFence fence;
+  RingAllocator ring(256);
+  LIB_CHECK(ring.Allocate(128, 1) == 0);
+  LIB_CHECK(ring.Allocate(128, 1) == 128);
+  LIB_CHECK(ring.GetUsedSize() == 256);
+  LIB_CHECK(ring.Allocate(1, 1) == RingAllocator::invalidOffset);
+  const uint64_t value = fence.Signal();
+  ring.FinishFrame(value);
+  LIB_CHECK(ring.Allocate(1, 1) == RingAllocator::invalidOffset);
+
+  // ĂȂtFXlł͉Ȃ
+  ring.Retire(fence.completedValue);
+  LIB_CHECK(ring.GetUsedSize() == 256);
+  fence.Complete(value);
+  ring.Retire(fence.completedValue);
+  LIB_CHECK(ring.GetUsedSize() == 0);
+  LIB_CHECK(ring.Allocate(256, 1) == 0);
+}
+
+/**
+* t[͊mۂɂȂ
+*
+* ̃t[̃tFXlɊĂAÕt[܂ł͉Ȃ
+* ܂AÂlRetireĂłNȂ
+*/
+LIB_TEST(RingAllocator_RetireOutOfOrder)
+{
+  RingAllocator ring(1024);
+  ring.Allocate(100, 1);
+  ring.FinishFrame(5);
+  ring.Allocate(100, 1);
+  ring.FinishFrame(4);
+  ring.Allocate(100, 1);
+  ring.FinishFrame(6);
+
+  ring.Retire(4);
+  LIB_CHECK(ring.GetPendingFrameCount() == 3);
+  LIB_CHECK(ring.GetUsedSize() == 300);
+
+  ring.Retire(5);
+  LIB_CHECK(ring.GetPendingFrameCount() == 1);
+  LIB_CHECK(ring.GetUsedSize() == 100);
+
+  ring.Retire(3);
+  LIB_CHECK(ring.GetPendingFrameCount() == 1);
+  LIB_CHECK(ring.GetUsedSize() == 100);
+
+  ring.Retire(6);
+  LIB_CHECK(ring.GetPendingFrameCount() == 0);
+  LIB_CHECK(ring.GetUsedSize() == 0);
+}
+
+/**
+* ׂĉA擪(head = tail = 0)g
+*/
+LIB_TEST(RingAllocator_ResetWhenEmpty)
+{
+  FakeFence fence;
+  RingAllocator ring(1024);
+  ring.Allocate(700, 1);
+  const uint64_t fence1 = fence.Signal();
+  ring.FinishFrame(fence1);
+  // ̈gȂt[cĂĂAȂ烊Zbg
+  const uint64_t fence2 = fence.Signal();
+  ring.FinishFrame(fence2);
+
+  fence.Complete(fence1);
+  ring.Retire(fence.completedValue);
+  LIB_CHECK(ring.GetUsedSize() == 0);
+  LIB_CHECK(ring.GetPendingFrameCount() == 1);
+
+  // ZbgĂȂ΁A324oCgɓ炸܂Ԃ̖ʂo
+  LIB_CHECK(ring.Allocate(700, 1) == 0);
+  LIB_CHECK(ring.GetUsedSize() == 700);
+
+  const uint64_t fence3 = fence.Signal();
+  ring.FinishFrame(fence3);
+  fence.Complete(fence3);
+  ring.Retire(fence.completedValue);
+  LIB_CHECK(ring.GetPendingFrameCount() == 0);
+  LIB_CHECK(ring.Allocate(1024, 1) == 0);
+}
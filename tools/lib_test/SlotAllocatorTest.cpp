@@ -0,0 +1,102 @@
+/**
+* @file SlotAllocatorTest.cpp
+*
+* SlotAllocator̃eXg
+*/
+#include "LibTest.h"
+#include "../../src/lib/SlotAllocator.h"
+#include <vector>
+
+using namespace EasyLib::DX12;
+
+/**
+* mۂƉŎgpςA󂫂ȂȂƖȃnhԂ
+*/
+LIB_TEST(SlotAllocator_AllocateFree)
+{
+  SlotAllocator allocator;
+  LIB_CHECK(!allocator.Init(SlotAllocator::maxCapacity + 1));
+  LIB_CHECK(allocator.Init(4));
+  LIB_CHECK(allocator.GetCapacity() == 4);
+
+  std::vector<uint32_t> handles;
+  for (int i = 0; i < 4; ++i) {
+    const uint32_t handle = allocator.Allocate();
+    LIB_CHECK(handle != SlotAllocator::invalidHandle);
+    LIB_CHECK(allocator.IsValid(handle));
+    handles.push_back(handle);
+  }
+  LIB_CHECK(allocator.GetUsedCount() == 4);
+  LIB_CHECK(allocator.Allocate() == SlotAllocator::invalidHandle);
+
+  LIB_CHECK(allocator.Free(handles[1]));
+  LIB_CHECK(allocator.GetUsedCount() == 3);
+  const uint32_t reused = allocator.Allocate();
+  LIB_CHECK(SlotAllocator::GetIndex(reused) == SlotAllocator::GetIndex(handles[1]));
+  LIB_CHECK(SlotAllocator::GetGeneration(reused) == SlotAllocator::GetGeneration(handles[1]) + 1);
+}
+
+/**
+* ς݂̃nhdɉłȂ
+*/
+LIB_TEST(SlotAllocator_DoubleFree)
+{
+  SlotAllocator allocator;
+  allocator.Init(2);
+  const uint32_t a = allocator.Allocate();
+  const uint32_t b = allocator.Allocate();
+  LIB_CHECK(allocator.Free(a));
+  LIB_CHECK(!allocator.Free(a));
+  LIB_CHECK(allocator.GetUsedCount() == 1);
+  LIB_CHECK(!allocator.Free(SlotAllocator::invalidHandle));
+  LIB_CHECK(allocator.IsValid(b));
+
+  // d𖳎̂ŁAXbg󂫃Xg2邱Ƃ͂Ȃ
+  const uint32_t c = allocator.Allocate();
+  LIB_CHECK(c != SlotAllocator::invalidHandle);
+  LIB_CHECK(allocator.Allocate() == SlotAllocator::invalidHandle);
+}
+
+/**
+* XbgėpƁAÂnh𖳌Ɣ肷邱
+*/
+LIB_TEST(SlotAllocator_StaleHandle)
+{
+  SlotAllocator allocator;
+  allocator.Init(1);
+  const uint32_t oldHandle = allocator.Allocate();
+  allocator.Free(oldHandle);
+  const uint32_t newHandle = allocator.Allocate();
+  LIB_CHECK(SlotAllocator::GetIndex(oldHandle) == SlotAllocator::GetIndex(newHandle));
+  LIB_CHECK(!allocator.IsValid(oldHandle));
+  LIB_CHECK(allocator.IsValid(newHandle));
+  LIB_CHECK(!allocator.Free(oldHandle));
+  LIB_CHECK(allocator.IsValid(newHandle));
+
+  // ͈͊ÕXbgԍ
+  LIB_CHECK(!allocator.IsValid(newHandle + 1));
+  LIB_CHECK(!allocator.Free(newHandle + 1));
+}
+
+/**
+* ԍĂA0(ȃnhp)gȂ
+*/
+LIB_TEST(SlotAllocator_GenerationWrapAround)
+{
+  SlotAllocator allocator;
+  allocator.Init(1);
+  const uint32_t first = allocator.Allocate();
+  LIB_CHECK(SlotAllocator::GetGeneration(first) == 1);
+  uint32_t handle = first;
+  bool zeroGeneration = false;
+  for (uint32_t i = 0; i < 65535; ++i) {
+    allocator.Free(handle);
+    handle = allocator.Allocate();
+    zeroGeneration |= SlotAllocator::GetGeneration(handle) == 0 || handle == SlotAllocator::invalidHandle;
+  }
+  LIB_CHECK(!zeroGeneration);
+  // ԍ165535܂ł65535ʂȂ̂ŁA65535ڂ̍ėpōŏ̃nhɖ߂
+  LIB_CHECK(handle == first);
+  LIB_CHECK(allocator.IsValid(handle));
+  LIB_CHECK(allocator.GetUsedCount() == 1);
+}
@@ -0,0 +1,362 @@
+/**
+* @file SoftwareRendererTest.cpp
+*
+* SoftwareRendererDrawCapturẽeXgƃx`}[N
+*/
+#include "LibTest.h"
+#include "../../src/lib/DrawCapture.h"
+#include "../../src/lib/SoftwareRenderer.h"
+#include "../../src/lib/WorkerPool.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace EasyLib;
+using namespace EasyLib::DX12;
+
+namespace /* unnamed */ {
+
+constexpr uint32_t sceneWidth = 160;
+constexpr uint32_t sceneHeight = 96;
+
+uint32_t MakeColor(uint32_t r, uint32_t g, uint32_t b, uint32_t a)
+{
+  return r | (g << 8) | (b << 16) | (a << 24);
+}
+
+/**
+* eXgp̉摜ƕݒ肷
+*
+* 摜1 8x8̎s͗l(oCjATvO̊mFp)
+* 摜2 16x16́AAt@E֕ωOf[V
+* 摜3 4x4̔
+*   'A'(lp)'B'(~)̋tB[h
+*/
+void SetupScene(SoftwareRenderer& renderer, SoftwareFont& font)
+{
+  std::vector<uint32_t> pixels(8 * 8);
+  for (uint32_t y = 0; y < 8; ++y) {
+    for (uint32_t x = 0; x < 8; ++x) {
+      pixels[y * 8 + x] = ((x ^ y) & 1) ? MakeColor(255, 255, 255, 255) : MakeColor(32, 64, 200, 255);
+    }
+  }
+  renderer.SetImage(1, 8, 8, pixels.data());
+
+  pixels.resize(16 * 16);
+  for (uint32_t y = 0; y < 16; ++y) {
+    for (uint32_t x = 0; x < 16; ++x) {
+      pixels[y * 16 + x] = MakeColor(255, y * 16, 0, x * 17);
+    }
+  }
+  renderer.SetImage(2, 16, 16, pixels.data());
+
+  pixels.assign(4 * 4, MakeColor(255, 255, 255, 255));
+  renderer.SetImage(3, 4, 4, pixels.data());
+
+  // tB[h́A֊s0.5AقǑ傫ȂlRɊi[
+  SoftwareImage page;
+  page.width = 32;
+  page.height = 16;
+  page.pixels.resize(page.width * page.height);
+  for (uint32_t y = 0; y < 16; ++y) {
+    for (uint32_t x = 0; x < 16; ++x) {
+      const float cx = static_cast<float>(x) + 0.5f - 8;
+      const float cy = static_cast<float>(y) + 0.5f - 8;
+      const float box = 5 - std::max(fabsf(cx), fabsf(cy));
+      const float circle = 6 - sqrtf(cx * cx + cy * cy);
+      const auto toByte = [](float d) {
+        return static_cast<uint32_t>(std::clamp(0.5f + d / 8, 0.0f, 1.0f) * 255 + 0.5f);
+      };
+      page.pixels[y * 32 + x] = MakeColor(toByte(box), 0, 0, 255);
+      page.pixels[y * 32 + x + 16] = MakeColor(toByte(circle), 0, 0, 255);
+    }
+  }
+  font.pages.push_back(std::move(page));
+  font.fontHeight = 16;
+  font.glyphs.resize('C');
+  for (int i = 0; i < 2; ++i) {
+    SoftwareFont::Glyph& glyph = font.glyphs['A' + i];
+    glyph.valid = true;
+    glyph.x = static_cast<float>(i * 16);
+    glyph.width = glyph.height = 16;
+    glyph.xadvance = 14;
+  }
+  renderer.SetFont(&font);
+}
+
+/**
+* eXgp̕`f[^쐬
+*
+* ]AgAC[Ɛ[xɂבւA4ނ̍@܂߂
+*/
+void MakeScene(std::vector<Sprite>& sprites, std::vector<Text>& texts)
+{
+  sprites.clear();
+  const auto add = [&sprites](TextureHandle texture, float x, float y, float z, float rotation,
+    float sx, float sy, DirectX::XMFLOAT4 color, uint8_t layer, BlendMode blendMode) {
+    sprites.push_back({ texture, { x, y, z }, rotation, { sx, sy }, color, layer, blendMode });
+  };
+  add(1, 80, 48, 0, 0, 160, 96, { 1, 1, 1, 1 }, 0, BlendMode::Opaque);
+  add(1, 40, 40, 0, 0.5f, 40, 24, { 1, 0.5f, 0.5f, 1 }, 1, BlendMode::Multiply);
+  add(2, 44, 44, 0.25f, 0, 48, 48, { 1, 1, 1, 1 }, 1, BlendMode::Multiply); // [x傫̂Őɕ`悳
+  add(2, 100, 30, 0, -0.3f, 36, 20, { 0.5f, 0.5f, 1, 1 }, 2, BlendMode::Addition);
+  add(3, 120, 64, 0, 0, 30, 30, { 0.25f, 0.5f, 0.75f, 1 }, 2, BlendMode::Subtraction);
+  add(3, 150, 90, 0, 0.8f, 40, 8, { 0, 1, 0, 0.5f }, 3, BlendMode::Multiply); // ʊOɂ͂ݏo
+  add(4, 10, 10, 0, 0, 8, 8, { 1, 1, 1, 1 }, 3, BlendMode::Opaque); // 摜̂ȂXvCg
+
+  texts.clear();
+  texts.push_back({ "AB\nBA", { 8, 90 }, { 1, 1 }, { 1, 1, 0.25f, 1 } });
+  texts.push_back({ "BAB", { 90, 94 }, { 1.5f, 0.75f }, { 0, 0, 0, 1 } });
+}
+
+/**
+* PPM(P6)`ŉ摜(At@͏܂Ȃ)
+*/
+bool WritePpm(const std::string& filename, uint32_t width, uint32_t height, const uint32_t* pixels)
+{
+  const std::unique_ptr<FILE, decltype(&fclose)> fp(fopen(filename.c_str(), "wb"), fclose);
+  if (!fp) {
+    return false;
+  }
+  fprintf(fp.get(), "P6\n%u %u\n255\n", width, height);
+  std::vector<uint8_t> rgb(static_cast<size_t>(width) * height * 3);
+  for (size_t i = 0; i < static_cast<size_t>(width) * height; ++i) {
+    rgb[i * 3 + 0] = static_cast<uint8_t>(pixels[i]);
+    rgb[i * 3 + 1] = static_cast<uint8_t>(pixels[i] >> 8);
+    rgb[i * 3 + 2] = static_cast<uint8_t>(pixels[i] >> 16);
+  }
+  return fwrite(rgb.data(), 1, rgb.size(), fp.get()) == rgb.size();
+}
+
+/**
+* PPM(P6)`̉摜ǂݍ
+*/
+bool ReadPpm(const std::string& filename, uint32_t& width, uint32_t& height, std::vector<uint8_t>& rgb)
+{
+  const std::unique_ptr<FILE, decltype(&fclose)> fp(fopen(filename.c_str(), "rb"), fclose);
+  if (!fp) {
+    return false;
+  }
+  unsigned int maxValue = 0;
+  if (fscanf(fp.get(), "P6 %u %u %u", &width, &height, &maxValue) != 3 || maxValue != 255 ||
+    fgetc(fp.get()) == EOF) {
+    return false;
+  }
+  rgb.resize(static_cast<size_t>(width) * height * 3);
+  return fread(rgb.data(), 1, rgb.size(), fp.get()) == rgb.size();
+}
+
+/**
+* `挋ʂ摜Ɣr
+*
+* RpCSIMD̗Lɂۂ߂̈Ⴂ߁Aevf̍2ȉȂ瓯Ƃ݂Ȃ
+* قȂꍇ́A`挋ʂu<O>.actual.ppmvƂčƃtH_ɏ
+*
+* @retval true  摜Ɠ(܂͊摜XV)
+* @retval false 摜ƈقȂA܂͊摜Ȃ
+*/
+bool CompareGolden(const char* name, uint32_t width, uint32_t height, const uint32_t* pixels)
+{
+  const std::string filename = LibTest::GetGoldenDirectory() + "/" + name + ".ppm";
+  if (LibTest::IsUpdateGolden()) {
+    if (!WritePpm(filename, width, height, pixels)) {
+      fprintf(stderr, "ERROR: %sɏ߂܂\n", filename.c_str());
+      return false;
+    }
+    printf("  %sXV܂\n", filename.c_str());
+    return true;
+  }
+
+  uint32_t goldenWidth = 0;
+  uint32_t goldenHeight = 0;
+  std::vector<uint8_t> golden;
+  if (!ReadPpm(filename, goldenWidth, goldenHeight, golden)) {
+    fprintf(stderr, "ERROR: %sǂݍ߂܂\n", filename.c_str());
+    return false;
+  }
+  size_t differentPixelCount = 0;
+  int maxDifference = 0;
+  if (goldenWidth == width && goldenHeight == height) {
+    for (size_t i = 0; i < static_cast<size_t>(width) * height; ++i) {
+      int difference = 0;
+      for (int c = 0; c < 3; ++c) {
+        const int actual = static_cast<int>((pixels[i] >> (c * 8)) & 0xff);
+        difference = std::max(difference, abs(actual - static_cast<int>(golden[i * 3 + c])));
+      }
+      maxDifference = std::max(maxDifference, difference);
+      if (difference > 2) {
+        ++differentPixelCount;
+      }
+    }
+    if (differentPixelCount == 0) {
+      return true;
+    }
+    fprintf(stderr, "%s: %zu pixels differ (max %d)\n", name, differentPixelCount, maxDifference);
+  } else {
+    fprintf(stderr, "%s: size %ux%u, golden %ux%u\n", name, width, height, goldenWidth, goldenHeight);
+  }
+  WritePpm(std::string(name) + ".actual.ppm", width, height, pixels);
+  return false;
+}
+
+} // unnamed namespace
+
+/**
+* `挋ʂ摜ƈv邱
+*/
+LIB_TEST(SoftwareRenderer_Golden)
+{
+  WorkerPool workerPool;
+  workerPool.Init(WorkerPool::GetDefaultThreadCount());
+  SoftwareRenderer renderer;
+  LIB_CHECK(renderer.Initialize(sceneWidth, sceneHeight, &workerPool));
+  SoftwareFont font;
+  SetupScene(renderer, font);
+
+  std::vector<Sprite> sprites;
+  std::vector<Text> texts;
+  MakeScene(sprites, texts);
+  renderer.Clear(MakeColor(0x20, 0x20, 0x20, 0xff));
+  renderer.Draw(sprites.data(), sprites.size(), texts.data(), texts.size());
+
+  const SoftwareRendererStatistics& statistics = renderer.GetStatistics();
+  LIB_CHECK(statistics.spriteCount == sprites.size() - 1);
+  LIB_CHECK(statistics.invalidImageCount == 1);
+  LIB_CHECK(statistics.glyphCount == 7);
+  LIB_CHECK(CompareGolden("software_renderer", renderer.GetWidth(), renderer.GetHeight(), renderer.GetPixels()));
+}
+
+/**
+* ƗpXbh̐ɂ炸A`挋ʂɂȂ邱
+*/
+LIB_TEST(SoftwareRenderer_ThreadCountIndependent)
+{
+  std::vector<Sprite> sprites;
+  std::vector<Text> texts;
+  MakeScene(sprites, texts);
+  std::vector<uint32_t> results[2];
+  const size_t threadCounts[2] = { 1, 4 };
+  for (int i = 0; i < 2; ++i) {
+    WorkerPool workerPool;
+    workerPool.Init(threadCounts[i]);
+    SoftwareRenderer renderer;
+    renderer.Initialize(sceneWidth, sceneHeight, &workerPool);
+    SoftwareFont font;
+    SetupScene(renderer, font);
+    renderer.Clear(0);
+    renderer.Draw(sprites.data(), sprites.size(), texts.data(), texts.size());
+    results[i].assign(renderer.GetPixels(), renderer.GetPixels() + sceneWidth * sceneHeight);
+  }
+  LIB_CHECK(results[0] == results[1]);
+}
+
+/**
+* Lv`t@Cɏ񂾕`f[^Â܂ܓǂݖ߂邱
+*/
+LIB_TEST(DrawCapture_RoundTrip)
+{
+  std::vector<Sprite> sprites;
+  std::vector<Text> texts;
+  MakeScene(sprites, texts);
+
+  const char filename[] = "lib_test_capture.tmp";
+  {
+    DrawCaptureWriter writer;
+    LIB_CHECK(writer.Open(filename, sceneWidth, sceneHeight, [](TextureHandle handle) {
+      return L"texture" + std::to_wstring(handle);
+    }));
+    LIB_CHECK(writer.WriteFrame(sprites.data(), sprites.size(), texts.data(), texts.size()));
+    LIB_CHECK(writer.WriteFrame(sprites.data(), 2, nullptr, 0));
+  }
+
+  DrawCaptureReader reader;
+  LIB_CHECK(reader.Load(filename));
+  remove(filename);
+  LIB_CHECK(reader.GetWidth() == sceneWidth && reader.GetHeight() == sceneHeight);
+  LIB_CHECK(reader.GetFrameCount() == 2);
+
+  std::vector<Sprite> readSprites;
+  std::vector<Text> readTexts;
+  LIB_CHECK(reader.ReadFrame(0, readSprites, readTexts));
+  LIB_CHECK(readSprites.size() == sprites.size());
+  LIB_CHECK(readTexts.size() == texts.size());
+  const auto& names = reader.GetTextureNames();
+  for (size_t i = 0; i < std::min(sprites.size(), readSprites.size()); ++i) {
+    const Sprite& a = sprites[i];
+    const Sprite& b = readSprites[i];
+    LIB_CHECK(b.texture >= 1 && b.texture <= names.size() &&
+      names[b.texture - 1] == L"texture" + std::to_wstring(a.texture));
+    LIB_CHECK(a.position.x == b.position.x && a.position.y == b.position.y && a.position.z == b.position.z);
+    LIB_CHECK(a.rotation == b.rotation && a.scale.x == b.scale.x && a.scale.y == b.scale.y);
+    LIB_CHECK(a.color.x == b.color.x && a.color.y == b.color.y && a.color.z == b.color.z && a.color.w == b.color.w);
+    LIB_CHECK(a.layer == b.layer && a.blendMode == b.blendMode);
+  }
+  for (size_t i = 0; i < std::min(texts.size(), readTexts.size()); ++i) {
+    LIB_CHECK(texts[i].text == readTexts[i].text);
+    LIB_CHECK(texts[i].position.x == readTexts[i].position.x && texts[i].scale.y == readTexts[i].scale.y);
+  }
+
+  LIB_CHECK(reader.ReadFrame(1, readSprites, readTexts));
+  LIB_CHECK(readSprites.size() == 2 && readTexts.empty());
+}
+
+/**
+* 1280x720̉ʂ1XvCg`悷鎞
+*
+* XvCg64x64̉摜0.5-2{Ɋg債A1/4͉]. @̓Q[ƓZ
+*/
+LIB_BENCHMARK(SoftwareRenderer_Benchmark)
+{
+  constexpr uint32_t width = 1280;
+  constexpr uint32_t height = 720;
+  constexpr size_t spriteCount = 10'000;
+  std::vector<uint32_t> pixels(64 * 64);
+  for (uint32_t y = 0; y < 64; ++y) {
+    for (uint32_t x = 0; x < 64; ++x) {
+      pixels[y * 64 + x] = MakeColor(x * 4, y * 4, 128, (x + y) % 3 ? 255 : 0);
+    }
+  }
+  std::mt19937 rand(1);
+  std::uniform_real_distribution<float> px(0, static_cast<float>(width));
+  std::uniform_real_distribution<float> py(0, static_cast<float>(height));
+  std::uniform_real_distribution<float> scale(0.5f, 2);
+  std::vector<Sprite> sprites(spriteCount);
+  for (size_t i = 0; i < spriteCount; ++i) {
+    const float s = scale(rand);
+    sprites[i] = { static_cast<TextureHandle>(i % 8 + 1), { px(rand), py(rand), 100 },
+      i % 4 ? 0.0f : static_cast<float>(i) * 0.01f, { 64 * s, 64 * s }, { 1, 1, 1, 1 }, 0, BlendMode::Multiply };
+  }
+
+  // ĂяoXbh܂߂1, 2, 4XbhƁAn[hEFÃXbhŔׂ
+  const size_t hardwareThreads = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+  std::vector<size_t> concurrencies = { 1, 2, 4 };
+  if (std::find(concurrencies.begin(), concurrencies.end(), hardwareThreads) == concurrencies.end()) {
+    concurrencies.push_back(hardwareThreads);
+  }
+  printf("  hardware threads: %zu\n", hardwareThreads);
+  for (size_t concurrency : concurrencies) {
+    WorkerPool workerPool;
+    workerPool.Init(concurrency - 1);
+    SoftwareRenderer renderer;
+    renderer.Initialize(width, height, &workerPool);
+    for (TextureHandle handle = 1; handle <= 8; ++handle) {
+      renderer.SetImage(handle, 64, 64, pixels.data());
+    }
+    char name[64];
+    snprintf(name, sizeof(name), "SoftwareRenderer %zu thread(s)", workerPool.GetConcurrency());
+    LibTest::Measure(name, 20, spriteCount, [&] {
+      renderer.Clear(MakeColor(0x20, 0x20, 0x20, 0xff));
+      renderer.Draw(sprites.data(), sprites.size(), nullptr, 0);
+    });
+    const SoftwareRendererStatistics& statistics = renderer.GetStatistics();
+    printf("  %llu pixels shaded per frame, frame %.3f ms (bin %.3f ms), %.1f Mpixel/s\n",
+      static_cast<unsigned long long>(statistics.pixelCount), static_cast<double>(statistics.frameNanoseconds) * 1e-6,
+      static_cast<double>(statistics.binNanoseconds) * 1e-6,
+      static_cast<double>(statistics.pixelCount) * 1e3 / static_cast<double>(statistics.frameNanoseconds));
+  }
+}
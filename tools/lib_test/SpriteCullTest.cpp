@@ -0,0 +1,135 @@
+/**
+* @file SpriteCullTest.cpp
+*
+* CullSprites̃eXgƃx`}[N
+*/
+#include "LibTest.h"
+#include "../../src/lib/SpriteCull.h"
+#include <math.h>
+#include <stdio.h>
+#include <random>
+#include <vector>
+
+using namespace EasyLib::DX12;
+
+namespace /* unnamed */ {
+
+/**
+* JO̓(\̂̔zł͂ȂAvfƂ̔zŎ)
+*/
+struct CullInput
+{
+  std::vector<float> centerX, centerY, extentX, extentY;
+
+  void Add(float x, float y, float ex, float ey) {
+    centerX.push_back(x);
+    centerY.push_back(y);
+    extentX.push_back(ex);
+    extentY.push_back(ey);
+  }
+  size_t size() const { return centerX.size(); }
+};
+
+/**
+* ʂ̎͂܂ޔ͈͂ɁA_ɃXvCgzu
+*/
+CullInput MakeRandomInput(size_t count, uint32_t seed)
+{
+  std::mt19937 rand(seed);
+  std::uniform_real_distribution<float> position(-640, 1920);
+  std::uniform_real_distribution<float> extent(0, 64);
+  CullInput input;
+  for (size_t i = 0; i < count; ++i) {
+    const float x = position(rand);
+    const float y = position(rand);
+    input.Add(x, y, extent(rand), extent(rand));
+  }
+  return input;
+}
+
+std::vector<uint32_t> Cull(const CullInput& input, const CullRect& rect, bool scalar)
+{
+  std::vector<uint32_t> visible(input.size());
+  const auto func = scalar ? CullSpritesScalar : CullSprites;
+  const size_t n = func(input.centerX.data(), input.centerY.data(), input.extentX.data(), input.extentY.data(),
+    input.size(), rect, visible.data());
+  visible.resize(n);
+  return visible;
+}
+
+constexpr CullRect screenRect = { 0, 0, 1280, 720 };
+
+} // unnamed namespace
+
+/**
+* `ƏdȂXvCgAԍ̏ɕԂ
+*
+* `ɐڂĂ邾̃XvCg͎菜
+*/
+LIB_TEST(CullSprites_Boundary)
+{
+  CullInput input;
+  input.Add(640, 360, 10, 10);    // 0 
+  input.Add(-10, 360, 10, 10);    // 1 [ɐڂ
+  input.Add(-9, 360, 10, 10);     // 2 [ƏdȂ
+  input.Add(1290, 360, 10, 10);   // 3 E[ɐڂ
+  input.Add(640, -10, 10, 10);    // 4 [ɐڂ
+  input.Add(640, 729, 10, 10);    // 5 [ƏdȂ
+  input.Add(640, 730, 10, 10);    // 6 [ɐڂ
+  input.Add(2000, 2000, 4000, 4000); // 7 ʑŜ𕢂
+  input.Add(640, 360, 0, 0);      // 8 傫0łȂc
+  input.Add(NAN, 360, 10, 10);    // 9 WsȂ菜
+  const std::vector<uint32_t> expected = { 0, 2, 5, 7, 8 };
+  LIB_CHECK(Cull(input, screenRect, false) == expected);
+  LIB_CHECK(Cull(input, screenRect, true) == expected);
+}
+
+/**
+* 4̔{łȂ̒[邱
+*/
+LIB_TEST(CullSprites_Remainder)
+{
+  for (size_t count = 0; count <= 9; ++count) {
+    CullInput input;
+    for (size_t i = 0; i < count; ++i) {
+      // Ԗڂʓɒu
+      input.Add(i % 2 ? -100.0f : 100.0f, 100, 10, 10);
+    }
+    const std::vector<uint32_t> visible = Cull(input, screenRect, false);
+    LIB_CHECK(visible.size() == (count + 1) / 2);
+    for (size_t i = 0; i < visible.size(); ++i) {
+      LIB_CHECK(visible[i] == i * 2);
+    }
+  }
+}
+
+/**
+* SIMDłƔėpł̌ʂv邱
+*/
+LIB_TEST(CullSprites_MatchesScalar)
+{
+  for (uint32_t seed = 1; seed <= 8; ++seed) {
+    const CullInput input = MakeRandomInput(1000 + seed, seed);
+    LIB_CHECK(Cull(input, screenRect, false) == Cull(input, screenRect, true));
+  }
+}
+
+/**
+* 10XvCg̃JO
+*/
+LIB_BENCHMARK(CullSprites_Benchmark)
+{
+  constexpr size_t count = 100'000;
+  const CullInput input = MakeRandomInput(count, 1);
+  std::vector<uint32_t> visible(count);
+  size_t visibleCount = 0;
+  LibTest::Measure("CullSprites", 50, count, [&] {
+    visibleCount = CullSprites(input.centerX.data(), input.centerY.data(), input.extentX.data(),
+      input.extentY.data(), count, screenRect, visible.data());
+  });
+  LibTest::Measure("CullSpritesScalar", 50, count, [&] {
+    visibleCount = CullSpritesScalar(input.centerX.data(), input.centerY.data(), input.extentX.data(),
+      input.extentY.data(), count, screenRect, visible.data());
+  });
+  printf("  %zu / %zu visible\n", visibleCount, count);
+}
@@ -0,0 +1,174 @@
+/**
+* @file SpritePackTest.cpp
+*
+* XvCg̃VF[_pf[^ւ̕ϊ̃eXgƃx`}[N
+*/
+#include "LibTest.h"
+#include "../../src/lib/SpritePack.h"
+#include "../../src/lib/WorkerPool.h"
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace EasyLib;
+using namespace EasyLib::DX12;
+
+namespace /* unnamed */ {
+
+/**
+* XvCgƁAϊɕKvȃeNX`
+*/
+struct SpriteInput
+{
+  std::vector<Sprite> sprites;
+  std::vector<uint32_t> texIDs;
+  std::vector<DirectX::XMFLOAT4> uvRects;
+};
+
+/**
+* ʂ͈̔͂Ƀ_ȃXvCg
+*/
+SpriteInput MakeRandomSprites(size_t count, uint32_t seed)
+{
+  std::mt19937 rand(seed);
+  std::uniform_real_distribution<float> x(-64, 1344);
+  std::uniform_real_distribution<float> y(-64, 784);
+  std::uniform_real_distribution<float> angle(-10, 10);
+  std::uniform_real_distribution<float> scale(0.25f, 4);
+  std::uniform_real_distribution<float> unit(0, 1);
+  std::uniform_int_distribution<uint32_t> texID(0, 1023);
+  SpriteInput input;
+  input.sprites.resize(count);
+  input.texIDs.resize(count);
+  input.uvRects.resize(count);
+  for (size_t i = 0; i < count; ++i) {
+    Sprite& e = input.sprites[i];
+    e.texture = static_cast<TextureHandle>(i + 1);
+    e.position = DirectX::XMFLOAT3(x(rand), y(rand), 100);
+    e.rotation = angle(rand);
+    e.scale = DirectX::XMFLOAT2(64 * scale(rand), 64 * scale(rand));
+    e.color = DirectX::XMFLOAT4(unit(rand), unit(rand), unit(rand), unit(rand));
+    input.texIDs[i] = texID(rand);
+    const float u = unit(rand) * 0.5f;
+    const float v = unit(rand) * 0.5f;
+    input.uvRects[i] = DirectX::XMFLOAT4(u, v, u + 0.0625f, v + 0.0625f);
+  }
+  return input;
+}
+
+/**
+* w肵ϊ֐̌ʂԂ
+*/
+template<typename F>
+std::vector<SpriteInShader> Pack(F func, const SpriteInput& input, const uint32_t* order)
+{
+  std::vector<SpriteInShader> result(input.sprites.size());
+  func(input.sprites.data(), order, input.texIDs.data(), input.uvRects.data(), input.sprites.size(), 720.0f, result.data());
+  return result;
+}
+
+/**
+* ϊʂoCgPʂňv邩ׂ
+*/
+bool IsSame(const std::vector<SpriteInShader>& a, const std::vector<SpriteInShader>& b)
+{
+  return a.size() == b.size() && (a.empty() || memcmp(a.data(), b.data(), sizeof(SpriteInShader) * a.size()) == 0);
+}
+
+} // unnamed namespace
+
+/**
+* xւ̕ϊAł߂ւ̊ۂ߂ɂȂĂ邱
+*/
+LIB_TEST(PackHalf_Values)
+{
+  LIB_CHECK(PackHalf(0.0f) == 0x0000);
+  LIB_CHECK(PackHalf(1.0f) == 0x3c00);
+  LIB_CHECK(PackHalf(-2.0f) == 0xc000);
+  LIB_CHECK(PackHalf(0.5f) == 0x3800);
+  LIB_CHECK(PackHalf(65504.0f) == 0x7bff);
+  LIB_CHECK(PackHalf(1.0f / 3.0f) == 0x3555);
+  LIB_CHECK(PackHalf(1280.0f) == 0x6500);
+  LIB_CHECK(PackHalf(1e6f) == 0x7c00);
+}
+
+/**
+* AVX2łƔėpł̌ʂA[܂߂Ĉv邱
+*/
+LIB_TEST(PackSprites_MatchesScalar)
+{
+  for (size_t count : { 0, 1, 7, 8, 9, 1001 }) {
+    const SpriteInput input = MakeRandomSprites(count, static_cast<uint32_t>(count));
+    LIB_CHECK(IsSame(Pack(PackSprites, input, nullptr), Pack(PackSpritesScalar, input, nullptr)));
+
+    std::vector<uint32_t> order(count);
+    std::iota(order.begin(), order.end(), 0u);
+    std::shuffle(order.begin(), order.end(), std::mt19937(1));
+    LIB_CHECK(IsSame(Pack(PackSprites, input, order.data()), Pack(PackSpritesScalar, input, order.data())));
+  }
+}
+
+/**
+* 10XvCg̕ϊԂƁA1t[̃Abv[h
+*
+* ϊÕVF[_pf[^48oCg(float3 + float + float2 + float4)
+*/
+LIB_BENCHMARK(PackSprites_Benchmark)
+{
+  constexpr size_t count = 100'000;
+  const SpriteInput input = MakeRandomSprites(count, 1);
+  std::vector<uint32_t> order(count);
+  std::iota(order.begin(), order.end(), 0u);
+  std::shuffle(order.begin(), order.end(), std::mt19937(1));
+  std::vector<SpriteInShader> p(count);
+  LibTest::Measure("PackSprites", 50, count, [&] {
+    PackSprites(input.sprites.data(), order.data(), input.texIDs.data(), input.uvRects.data(), count, 720, p.data());
+  });
+  LibTest::Measure("PackSpritesScalar", 50, count, [&] {
+    PackSpritesScalar(input.sprites.data(), order.data(), input.texIDs.data(), input.uvRects.data(), count, 720, p.data());
+  });
+  printf("  upload per frame: %zu bytes (%zu bytes/sprite), was %zu bytes (48 bytes/sprite)\n",
+    sizeof(SpriteInShader) * count, sizeof(SpriteInShader), size_t(48) * count);
+}
+
+/**
+* `NɕPackSpritesAXbhƃXvCgƃ`NςĔׂ
+*
+* SpriteRenderer::minChunkSizemaxChunkCount߂邽߂̌v
+* 1, 2, 4Xbhƃn[hEFÃXbhŁA`N1, 2, 4, 8
+*/
+LIB_BENCHMARK(PackSprites_Chunks)
+{
+  const size_t hardwareThreads = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+  std::vector<size_t> threadCounts = { 1, 2, 4 };
+  if (std::find(threadCounts.begin(), threadCounts.end(), hardwareThreads) == threadCounts.end()) {
+    threadCounts.push_back(hardwareThreads);
+  }
+  printf("  hardware threads: %zu\n", hardwareThreads);
+  const SpriteInput input = MakeRandomSprites(100'000, 1);
+  std::vector<SpriteInShader> p(input.sprites.size());
+  for (size_t threadCount : threadCounts) {
+    WorkerPool pool;
+    pool.Init(threadCount - 1);
+    for (size_t count : { 1024, 4096, 16384, 100'000 }) {
+      for (size_t chunkCount : { 1, 2, 4, 8 }) {
+        const size_t chunkSize = (count + chunkCount - 1) / chunkCount;
+        char name[64];
+        snprintf(name, sizeof(name), "%zu thread(s) %6zu sprites %zu chunk(s)", threadCount, count, chunkCount);
+        LibTest::Measure(name, 50, count, [&] {
+          pool.Run(chunkCount, [&](size_t i) {
+            const size_t start = chunkSize * i;
+            if (start < count) {
+              PackSprites(input.sprites.data(), nullptr, input.texIDs.data(), input.uvRects.data(),
+                std::min(chunkSize, count - start), 720, p.data() + start);
+            }
+          });
+        });
+      }
+    }
+  }
+}
@@ -0,0 +1,164 @@
+/**
+* @file SpriteSortTest.cpp
+*
+* SpriteSorter̃eXgƃx`}[N
+*/
+#include "LibTest.h"
+#include "../../src/lib/SpriteSort.h"
+#include <stdio.h>
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <vector>
+
+using namespace EasyLib::DX12;
+
+namespace /* unnamed */ {
+
+/**
+* XvCg̕
+*/
+struct SortInput
+{
+  std::vector<uint64_t> keys;
+  std::vector<uint32_t> textures; // XvCgƂ̃eNX`ԍ
+};
+
+/**
+* _ȃC[ƃeNX`XvCg̃L[
+*
+* @param sortByTexture falseȂL[ɃeNX`ԍ܂߂Ȃ(eNX`̕בւ𖳌ɂ)
+*/
+SortInput MakeRandomInput(size_t count, uint32_t layerCount, uint32_t textureCount, bool sortByTexture, uint32_t seed)
+{
+  std::mt19937 rand(seed);
+  std::uniform_int_distribution<uint32_t> layer(0, layerCount - 1);
+  std::uniform_int_distribution<uint32_t> texture(0, textureCount - 1);
+  const uint32_t depth = SpriteSortKey::FromDepth(100);
+  SortInput input;
+  input.keys.resize(count);
+  input.textures.resize(count);
+  for (size_t i = 0; i < count; ++i) {
+    input.textures[i] = texture(rand);
+    input.keys[i] = SpriteSortKey::Make(layer(rand), depth, 1, sortByTexture ? input.textures[i] : 0, i);
+  }
+  return input;
+}
+
+/**
+* `揇ɕׂƂ̃eNX`̐؂ւ񐔂𐔂
+*/
+size_t CountTextureChanges(const std::vector<uint32_t>& textures, const uint32_t* order, size_t count)
+{
+  size_t changes = 0;
+  uint32_t current = UINT32_MAX;
+  for (size_t i = 0; i < count; ++i) {
+    const uint32_t t = textures[order[i]];
+    if (t != current) {
+      ++changes;
+      current = t;
+    }
+  }
+  return changes;
+}
+
+/**
+* std::sortŃL[̏ɕׂԍԂ(rp)
+*/
+void SortByStd(const std::vector<uint64_t>& keys, std::vector<uint32_t>& order)
+{
+  order.resize(keys.size());
+  std::iota(order.begin(), order.end(), 0u);
+  std::sort(order.begin(), order.end(), [&keys](uint32_t a, uint32_t b) { return keys[a] < keys[b]; });
+}
+
+} // unnamed namespace
+
+/**
+* std::sortƓɂȂ邱
+*/
+LIB_TEST(SpriteSorter_MatchesStdSort)
+{
+  for (size_t count : { 0, 1, 2, 255, 256, 1000, 70000 }) {
+    const SortInput input = MakeRandomInput(count, 4, 32, true, static_cast<uint32_t>(count));
+    SpriteSorter sorter;
+    sorter.Sort(input.keys.data(), count);
+    std::vector<uint32_t> expected;
+    SortByStd(input.keys, expected);
+    LIB_CHECK(sorter.GetCount() == count);
+    LIB_CHECK(std::equal(expected.begin(), expected.end(), sorter.GetOrder()));
+  }
+}
+
+/**
+* L[XvCg͓͏ۂ
+*
+* ͏20bitŊۂ߂̂ŁA𒴂͕בւ̈萫ŏ܂
+*/
+LIB_TEST(SpriteSorter_Stable)
+{
+  constexpr size_t count = (1 << SpriteSortKey::sequenceBits) + 100;
+  std::vector<uint64_t> keys(count);
+  for (size_t i = 0; i < count; ++i) {
+    keys[i] = SpriteSortKey::Make(static_cast<uint32_t>(i % 2), 0, 0, 0, i);
+  }
+  SpriteSorter sorter;
+  sorter.Sort(keys.data(), count);
+  const uint32_t* order = sorter.GetOrder();
+  bool ordered = true;
+  for (size_t i = 1; i < count; ++i) {
+    if (keys[order[i - 1]] == keys[order[i]] && order[i - 1] > order[i]) {
+      ordered = false;
+    }
+  }
+  LIB_CHECK(ordered);
+}
+
+/**
+* eNX`ɕׂƁAeNX`̐؂ւ̓C[Ƃ̃eNX`ȉɂȂ邱
+*/
+LIB_TEST(SpriteSorter_TextureChanges)
+{
+  const SortInput input = MakeRandomInput(10000, 4, 32, true, 1);
+  SpriteSorter sorter;
+  sorter.Sort(input.keys.data(), input.keys.size());
+  LIB_CHECK(CountTextureChanges(input.textures, sorter.GetOrder(), sorter.GetCount()) <= 4 * 32);
+}
+
+/**
+* \[gstd::sort̔r
+*/
+LIB_BENCHMARK(SpriteSorter_Benchmark)
+{
+  for (size_t count : { 10'000, 100'000, 1'000'000 }) {
+    const SortInput input = MakeRandomInput(count, 4, 32, true, 1);
+    SpriteSorter sorter;
+    std::vector<uint32_t> order;
+    char name[64];
+    snprintf(name, sizeof(name), "SpriteSorter %zu", count);
+    LibTest::Measure(name, 20, count, [&] { sorter.Sort(input.keys.data(), count); });
+    snprintf(name, sizeof(name), "std::sort %zu", count);
+    LibTest::Measure(name, 20, count, [&] { SortByStd(input.keys, order); });
+    printf("  radix passes: %u\n", sorter.GetPassCount());
+  }
+}
+
+/**
+* eNX`̕בւŌA`揇ł̃eNX`̐؂ւ
+*
+* 4C[A32eNX`_ɍʂŔׂ
+*/
+LIB_BENCHMARK(SpriteSorter_TextureSort)
+{
+  for (size_t count : { 10'000, 100'000, 1'000'000 }) {
+    SpriteSorter sorter;
+    const SortInput unsorted = MakeRandomInput(count, 4, 32, false, 1);
+    sorter.Sort(unsorted.keys.data(), count);
+    const size_t before = CountTextureChanges(unsorted.textures, sorter.GetOrder(), count);
+    const SortInput sorted = MakeRandomInput(count, 4, 32, true, 1);
+    sorter.Sort(sorted.keys.data(), count);
+    const size_t after = CountTextureChanges(sorted.textures, sorter.GetOrder(), count);
+    printf("  %7zu sprites: %7zu texture changes without texture sort, %3zu with\n",
+      count, before, after);
+  }
+}
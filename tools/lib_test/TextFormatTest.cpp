@@ -0,0 +1,146 @@
+/**
+* @file TextFormatTest.cpp
+*
+* FormatText̃eXgƃx`}[N
+*/
+#include "LibTest.h"
+#include "../../src/lib/TextFormat.h"
+#include <stdio.h>
+#include <string.h>
+#include <limits.h>
+#include <string>
+#include <vector>
+
+using namespace EasyLib;
+
+namespace /* unnamed */ {
+
+/**
+* FormatTexťʂsnprintfƈv邩ׂ
+*/
+template<typename... Args>
+bool MatchesPrintf(TextFormatString<std::type_identity_t<Args>...> format, const Args&... args)
+{
+  const TextArg list[] = { TextArg(args)..., TextArg() };
+  char actual[256];
+  char expected[256];
+  const size_t length = FormatText(actual, sizeof(actual), format.Get(), list, sizeof...(Args));
+  const int expectedLength = snprintf(expected, sizeof(expected), format.Get(), args...);
+  if (length != static_cast<size_t>(expectedLength) || strcmp(actual, expected) != 0) {
+    fprintf(stderr, "  \"%s\": \"%s\" != \"%s\"\n", format.Get(), actual, expected);
+    return false;
+  }
+  return true;
+}
+
+/**
+* FormatTexťʂ𕶎ŕԂ
+*/
+template<typename... Args>
+std::string Format(TextFormatString<std::type_identity_t<Args>...> format, const Args&... args)
+{
+  const TextArg list[] = { TextArg(args)..., TextArg() };
+  char buffer[256];
+  const size_t length = FormatText(buffer, sizeof(buffer), format.Get(), list, sizeof...(Args));
+  return std::string(buffer, length);
+}
+
+} // unnamed namespace
+
+/**
+* ̕ϊprintfƈv邱
+*/
+LIB_TEST(FormatText_Integer)
+{
+  LIB_CHECK(MatchesPrintf("SCORE:%d", 0));
+  LIB_CHECK(MatchesPrintf("SCORE:%d", 123456));
+  LIB_CHECK(MatchesPrintf("%d", INT_MIN));
+  LIB_CHECK(MatchesPrintf("%lld", LLONG_MIN));
+  LIB_CHECK(MatchesPrintf("[%5d][%-5d][%05d][%+d][% d]", 42, 42, -42, 42, 42));
+  LIB_CHECK(MatchesPrintf("[%.3d][%8.3d][%.0d]", 7, -7, 0));
+  LIB_CHECK(MatchesPrintf("[%u][%x][%X][%o]", 4000000000u, 0xbeefu, 0xbeefu, 8u));
+  LIB_CHECK(MatchesPrintf("[%#x][%#o][%#X]", 255u, 8u, 0u));
+  LIB_CHECK(MatchesPrintf("[%u][%x]", -1, -1));
+  LIB_CHECK(MatchesPrintf("[%c][%3c][%-3c]", 'A', 'B', 'C'));
+  LIB_CHECK(MatchesPrintf("100%% [%s][%8s][%-8s][%.2s]", "abc", "abc", "abc", "abc"));
+}
+
+/**
+* Œ菬_`̕ϊprintfƈv邱
+*/
+LIB_TEST(FormatText_Fixed)
+{
+  LIB_CHECK(MatchesPrintf("%f", 3.14159));
+  LIB_CHECK(MatchesPrintf("[%.2f][%.0f][%8.3f][%-8.1f][%08.2f]", 2.71828, 9.7, -1.5, 0.26, -3.14159));
+  LIB_CHECK(MatchesPrintf("[%+.1f][% .1f][%#.0f]", 1.26, 1.26, 3.0));
+  LIB_CHECK(MatchesPrintf("%.3f", 123456789.987654));
+  LIB_CHECK(MatchesPrintf("%.1f", -0.04));
+  LIB_CHECK(MatchesPrintf("%f", 1e20));
+  LIB_CHECK(MatchesPrintf("[%e][%g]", 12345.678, 0.0001234));
+}
+
+/**
+* ϊw肪Ȃl1ȂǍɐl\邱
+*/
+LIB_TEST(FormatText_TrailingNumber)
+{
+  LIB_CHECK(Format("SCORE:", 120) == "SCORE:120");
+  LIB_CHECK(Format("HP ", -5) == "HP -5");
+  LIB_CHECK(Format("COIN x", 3u) == "COIN x3");
+  LIB_CHECK(Format("SCORE:", 120) == Format("SCORE:%d", 120));
+}
+
+/**
+* ݐ悪Ȃΐ؂l߂邱
+*/
+LIB_TEST(FormatText_Truncate)
+{
+  const TextArg args[] = { TextArg(123456) };
+  char buffer[8];
+  LIB_CHECK(FormatText(buffer, sizeof(buffer), "SCORE:%d", args, 1) == 7);
+  LIB_CHECK(strcmp(buffer, "SCORE:1") == 0);
+}
+
+/**
+* 1000̐l𖈃t[\ꍇ̕ϊ
+*/
+LIB_BENCHMARK(FormatText_Counters)
+{
+  constexpr size_t count = 1000;
+  std::vector<char> buffer(64 * count);
+  int score = 0;
+  LibTest::Measure("snprintf(\"SCORE:%d\")", 200, count, [&] {
+    for (size_t i = 0; i < count; ++i) {
+      snprintf(&buffer[i * 64], 64, "SCORE:%d", score + static_cast<int>(i) * 37);
+    }
+    ++score;
+  });
+  LibTest::Measure("FormatText(\"SCORE:%d\")", 200, count, [&] {
+    for (size_t i = 0; i < count; ++i) {
+      const TextArg args[] = { TextArg(score + static_cast<int>(i) * 37) };
+      FormatText(&buffer[i * 64], 64, "SCORE:%d", args, 1);
+    }
+    ++score;
+  });
+  LibTest::Measure("FormatText(\"SCORE:\", n)", 200, count, [&] {
+    for (size_t i = 0; i < count; ++i) {
+      const TextArg args[] = { TextArg(score + static_cast<int>(i) * 37) };
+      FormatText(&buffer[i * 64], 64, "SCORE:", args, 1);
+    }
+    ++score;
+  });
+  double time = 0;
+  LibTest::Measure("snprintf(\"TIME:%.2f\")", 200, count, [&] {
+    for (size_t i = 0; i < count; ++i) {
+      snprintf(&buffer[i * 64], 64, "TIME:%.2f", time + static_cast<double>(i) * 0.37);
+    }
+    time += 1.0 / 60;
+  });
+  LibTest::Measure("FormatText(\"TIME:%.2f\")", 200, count, [&] {
+    for (size_t i = 0; i < count; ++i) {
+      const TextArg args[] = { TextArg(time + static_cast<double>(i) * 0.37) };
+      FormatText(&buffer[i * 64], 64, "TIME:%.2f", args, 1);
+    }
+    time += 1.0 / 60;
+  });
+}
@@ -0,0 +1,208 @@
+/**
+* @file TextLayoutTest.cpp
+*
+* TextLayout̃eXg
+*/
+#include "LibTest.h"
+#include "../../src/lib/TextLayout.h"
+#include <string.h>
+#include <string>
+#include <vector>
+
+using namespace EasyLib::DX12;
+
+namespace /* unnamed */ {
+
+/**
+* eXgp̃tHg
+*
+* ASCII͑̕蕝10A{͑̕蕝20As̊Ԋu16
+*/
+struct TestFont
+{
+  GlyphTable glyphTable;
+  TextLayout layout;
+
+  TestFont() {
+    std::vector<uint32_t> codePoints;
+    std::vector<float> advances(1, 0.0f);
+    for (uint32_t c = 0x20; c < 0x7f; ++c) {
+      codePoints.push_back(c);
+      advances.push_back(10);
+    }
+    for (uint32_t c : { 0x3042u, 0x3044u, 0x3046u, 0x3048u, 0x304au, 0x3001u, 0x65e5u, 0x672cu }) { // A{
+      codePoints.push_back(c);
+      advances.push_back(20);
+    }
+    glyphTable.Build(codePoints.data(), codePoints.size());
+    layout.SetFont(&glyphTable, std::move(advances), 16, 0);
+  }
+
+  // ʂۑɔzu
+  TextLayoutResult Compute(const char* text, float maxWidth) const {
+    TextLayoutResult result;
+    layout.Compute(text, strlen(text), { 1, 1 }, maxWidth, result);
+    return result;
+  }
+};
+
+/**
+* s̕o
+*/
+std::vector<std::string> GetLines(const char* text, const TextLayoutResult& result)
+{
+  std::vector<std::string> lines;
+  for (const TextLine& e : result.lines) {
+    lines.emplace_back(text + e.begin, text + e.end);
+  }
+  return lines;
+}
+
+/**
+* s̕o
+*/
+std::vector<float> GetWidths(const TextLayoutResult& result)
+{
+  std::vector<float> widths;
+  for (const TextLine& e : result.lines) {
+    widths.push_back(e.width);
+  }
+  return widths;
+}
+
+} // unnamed namespace
+
+/**
+* 󔒂̌Ő܂ԂAs̋󔒂𕝂Ɋ܂߂Ȃ. słs邱
+*/
+LIB_TEST(TextLayout_WordWrap)
+{
+  const TestFont font;
+  const char text[] = "aaa bbb  ccc";
+  const TextLayoutResult result = font.Compute(text, 75);
+  LIB_CHECK(GetLines(text, result) == std::vector<std::string>({ "aaa bbb", "ccc" }));
+  LIB_CHECK(GetWidths(result) == std::vector<float>({ 70, 30 }));
+  LIB_CHECK(result.size.x == 70 && result.size.y == 32 && result.lineHeight == 16);
+
+  // ő啝0Ȃ܂ԂȂ
+  const TextLayoutResult single = font.Compute(text, 0);
+  LIB_CHECK(GetLines(text, single) == std::vector<std::string>({ text }));
+  LIB_CHECK(single.size.x == 120);
+
+  const char lines[] = "ab\n\ncd ";
+  const TextLayoutResult newline = font.Compute(lines, 0);
+  LIB_CHECK(GetLines(lines, newline) == std::vector<std::string>({ "ab", "", "cd" }));
+  LIB_CHECK(GetWidths(newline) == std::vector<float>({ 20, 0, 20 }));
+  LIB_CHECK(newline.size.y == 48);
+}
+
+/**
+* ő啝蒷ṔAő啝Ɏ܂ƂŒP̓rŐ܂Ԃ
+*/
+LIB_TEST(TextLayout_LongWord)
+{
+  const TestFont font;
+  const char text[] = "abcdefghij xy";
+  const TextLayoutResult result = font.Compute(text, 35);
+  LIB_CHECK(GetLines(text, result) == std::vector<std::string>({ "abc", "def", "ghi", "j", "xy" }));
+  LIB_CHECK(GetWidths(result) == std::vector<float>({ 30, 30, 30, 10, 20 }));
+  LIB_CHECK(result.size.x == 30);
+
+  // ő啝1苷ĂA1s1͒u
+  const TextLayoutResult narrow = font.Compute("abc", 5);
+  LIB_CHECK(GetLines("abc", narrow) == std::vector<std::string>({ "a", "b", "c" }));
+}
+
+/**
+* ɍ킹āAsƂɕɉɂȂ邱
+*/
+LIB_TEST(TextLayout_Align)
+{
+  const TestFont font;
+  const char text[] = "ab\nabcd";
+  const TextLayoutResult result = font.Compute(text, 0);
+  LIB_CHECK(result.lines.size() == 2);
+  const TextLine& a = result.lines[0];
+  const TextLine& b = result.lines[1];
+  LIB_CHECK(GetAlignOffset(a, TextAlign::Left) == 0 && GetAlignOffset(b, TextAlign::Left) == 0);
+  LIB_CHECK(GetAlignOffset(a, TextAlign::Center) == -10 && GetAlignOffset(b, TextAlign::Center) == -20);
+  LIB_CHECK(GetAlignOffset(a, TextAlign::Right) == -20 && GetAlignOffset(b, TextAlign::Right) == -40);
+
+  // s̋󔒂͑ɉeȂ
+  const TextLayoutResult trailing = font.Compute("ab  ", 0);
+  LIB_CHECK(GetAlignOffset(trailing.lines[0], TextAlign::Right) == -20);
+}
+
+/**
+* {͋󔒂ȂĂ̑OŐ܂Ԃ
+*/
+LIB_TEST(TextLayout_CjkBreak)
+{
+  const TestFont font;
+  const char* text = reinterpret_cast<const char*>(u8"");
+  const TextLayoutResult result = font.Compute(text, 50);
+  LIB_CHECK(GetLines(text, result) == std::vector<std::string>({
+    reinterpret_cast<const char*>(u8""), reinterpret_cast<const char*>(u8""),
+    reinterpret_cast<const char*>(u8"") }));
+  LIB_CHECK(GetWidths(result) == std::vector<float>({ 40, 40, 20 }));
+  LIB_CHECK(result.lines[1].begin == 6 && result.lines[1].end == 12); // oCgP
+
+  // pƓ{̋ڂł܂Ԃ. p̒P̓rł͐܂ԂȂ
+  const char* mixed = reinterpret_cast<const char*>(u8"ab{");
+  const TextLayoutResult mixedResult = font.Compute(mixed, 45);
+  LIB_CHECK(GetLines(mixed, mixedResult) == std::vector<std::string>({
+    reinterpret_cast<const char*>(u8"ab"), reinterpret_cast<const char*>(u8"{") }));
+  const TextLayoutResult mixedNarrow = font.Compute(mixed, 35);
+  LIB_CHECK(GetLines(mixed, mixedNarrow) == std::vector<std::string>({
+    "ab", reinterpret_cast<const char*>(u8""), reinterpret_cast<const char*>(u8"{") }));
+}
+
+/**
+* Ag嗦Aő啝̂ƂۑʂgAgȂȂʂj邱
+*/
+LIB_TEST(TextLayout_Cache)
+{
+  TestFont font;
+  TextLayout& layout = font.layout;
+  const char text[] = "SCORE 100";
+  const TextLayoutResult& first = layout.Layout(text, strlen(text), { 1, 1 }, 0);
+  const TextLayoutResult& second = layout.Layout(text, strlen(text), { 1, 1 }, 0);
+  LIB_CHECK(&first == &second);
+  LIB_CHECK(second.size.x == 90);
+  TextLayoutStatistics s = layout.TakeStatistics();
+  LIB_CHECK(s.hitCount == 1 && s.missCount == 1 && s.cachedCount == 1);
+
+  // g嗦Aő啝A̒ႦΕʂ̌ʂɂȂ
+  LIB_CHECK(layout.Layout(text, strlen(text), { 2, 1 }, 0).size.x == 180);
+  LIB_CHECK(layout.Layout(text, strlen(text), { 1, 1 }, 60).lines.size() == 2);
+  LIB_CHECK(layout.Layout(text, 5, { 1, 1 }, 0).size.x == 50);
+  s = layout.TakeStatistics();
+  LIB_CHECK(s.hitCount == 0 && s.missCount == 3 && s.cachedCount == 4);
+
+  // EvictUnusedĂԂтɐオi݁AkeepCount̊ԎgȂʂj
+  layout.EvictUnused(2);
+  layout.Layout(text, strlen(text), { 1, 1 }, 0); // ̌ʂg
+  layout.EvictUnused(2);
+  s = layout.TakeStatistics();
+  LIB_CHECK(s.hitCount == 1 && s.cachedCount == 4);
+  layout.EvictUnused(2);
+  LIB_CHECK(layout.TakeStatistics().cachedCount == 1);
+  layout.Layout(text, strlen(text), { 1, 1 }, 0);
+  s = layout.TakeStatistics();
+  LIB_CHECK(s.hitCount == 1 && s.missCount == 0);
+
+  // ۑ̈悪tłAۑȂŐzu
+  for (int i = 0; i < 600; ++i) {
+    const std::string number = std::to_string(i);
+    layout.Layout(number.data(), number.size(), { 1, 1 }, 0);
+  }
+  const TextLayoutResult& uncached = layout.Layout("overflow", 8, { 1, 1 }, 0);
+  LIB_CHECK(uncached.size.x == 80);
+  s = layout.TakeStatistics();
+  LIB_CHECK(s.cachedCount == 512 && s.missCount == 601);
+
+  // tHgςƕۑʂ͔j
+  layout.SetFont(&font.glyphTable, std::vector<float>(200, 5.0f), 8, 0);
+  LIB_CHECK(layout.TakeStatistics().cachedCount == 0);
+  LIB_CHECK(layout.Layout(text, strlen(text), { 1, 1 }, 0).size.x == 45);
+}
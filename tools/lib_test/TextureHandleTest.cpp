@@ -0,0 +1,98 @@
+/**
+* @file TextureHandleTest.cpp
+*
+* XvCgeNX`nhŎƂɂʂ̃x`}[N
+*/
+#include "LibTest.h"
+#include "../../src/lib/DrawData.h"
+#include "../../src/lib/SlotAllocator.h"
+#include "../../src/lib/WorkerPool.h"
+#include <stdio.h>
+#include <memory>
+#include <vector>
+
+using namespace EasyLib::DX12;
+
+namespace /* unnamed */ {
+
+/**
+* eNX`shared_ptrŎẴXvCg
+*/
+struct SharedPtrSprite
+{
+  std::shared_ptr<int> texture;
+  DirectX::XMFLOAT3 position;
+  float rotation;
+  DirectX::XMFLOAT2 scale;
+  DirectX::XMFLOAT4 color;
+};
+
+constexpr size_t drawCount = 50'000; // 1t[draw_imagẻ
+constexpr size_t textureCount = 32;
+
+} // unnamed namespace
+
+/**
+* 1t[draw_image(XvCg̒ǉ)A`掞̃eNX`rAupdate()̎
+*
+* shared_ptrł́AǉƏ̂тɎQƃJEg𑝌
+* nhł́A`掞Ƀnh̐ԍ
+*/
+LIB_BENCHMARK(TextureHandle_DrawImage)
+{
+  // Q[ƓƗpXbhԂő
+  // (XbhxĂȂƁAshared_ptr̎QƃJEgatomicɂȂn)
+  EasyLib::WorkerPool pool;
+  pool.Init(1);
+
+  std::vector<std::shared_ptr<int>> textures;
+  for (size_t i = 0; i < textureCount; ++i) {
+    textures.push_back(std::make_shared<int>(static_cast<int>(i)));
+  }
+  std::vector<SharedPtrSprite> sharedPtrSprites;
+  sharedPtrSprites.reserve(drawCount);
+  size_t changes = 0;
+  LibTest::Measure("shared_ptr<Texture>", 100, drawCount, [&] {
+    for (size_t i = 0; i < drawCount; ++i) {
+      SharedPtrSprite sprite;
+      sprite.texture = textures[i % textureCount];
+      sprite.position = DirectX::XMFLOAT3(static_cast<float>(i % 1280), 360, 100);
+      sprite.rotation = 0;
+      sprite.scale = DirectX::XMFLOAT2(1, 1);
+      sprite.color = DirectX::XMFLOAT4(1, 1, 1, 1);
+      sharedPtrSprites.push_back(sprite);
+    }
+    changes = 0;
+    for (size_t i = 1; i < sharedPtrSprites.size(); ++i) {
+      changes += sharedPtrSprites[i].texture != sharedPtrSprites[i - 1].texture;
+    }
+    sharedPtrSprites.clear();
+  });
+
+  SlotAllocator slots;
+  slots.Init(1024);
+  std::vector<TextureHandle> handles;
+  for (size_t i = 0; i < textureCount; ++i) {
+    handles.push_back(slots.Allocate());
+  }
+  std::vector<Sprite> sprites;
+  sprites.reserve(drawCount);
+  LibTest::Measure("TextureHandle", 100, drawCount, [&] {
+    for (size_t i = 0; i < drawCount; ++i) {
+      Sprite sprite;
+      sprite.texture = handles[i % textureCount];
+      sprite.position = DirectX::XMFLOAT3(static_cast<float>(i % 1280), 360, 100);
+      sprite.rotation = 0;
+      sprite.scale = DirectX::XMFLOAT2(1, 1);
+      sprite.color = DirectX::XMFLOAT4(1, 1, 1, 1);
+      sprites.push_back(sprite);
+    }
+    changes = 0;
+    for (size_t i = 1; i < sprites.size(); ++i) {
+      changes += slots.IsValid(sprites[i].texture) && sprites[i].texture != sprites[i - 1].texture;
+    }
+    sprites.clear();
+  });
+  printf("  %zu texture changes per frame, sizeof: shared_ptr sprite %zu bytes, handle sprite %zu bytes\n",
+    changes, sizeof(SharedPtrSprite), sizeof(Sprite));
+}
@@ -0,0 +1,272 @@
+/**
+* @file TilemapTest.cpp
+*
+* TilemapƁA`ÑVF[_pf[^ւ̕ϊ̃eXgƃx`}[N
+*/
+#include "LibTest.h"
+#include "../../src/lib/SpritePack.h"
+#include <stdio.h>
+#include <algorithm>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+using namespace EasyLib;
+using namespace EasyLib::DX12;
+
+namespace /* unnamed */ {
+
+/**
+* nʂƔwi̊u^C}bv
+*/
+void MakeTerrain(Tilemap& tilemap, uint32_t width, std::vector<TileImageInShader>& images)
+{
+  tilemap.Init(width, 24, 32, 32);
+  images.assign(1, TileImageInShader());
+  for (uint32_t i = 0; i < 3; ++i) {
+    const uint16_t tile = tilemap.AddTileImage(i + 1);
+    images.resize(tile + 1);
+    images[tile] = { static_cast<uint16_t>(i + 1), { 0, 0, 65535, 65535 }, true };
+  }
+  tilemap.Fill(0, 20, width, 4, 1);
+  tilemap.Fill(0, 19, width, 1, 2);
+  std::mt19937 rand(1);
+  for (uint32_t x = 0; x < width; ++x) {
+    if (rand() % 8 == 0) {
+      tilemap.SetTile(x, 18, 3);
+    }
+  }
+}
+
+constexpr float viewWidth = 1280;
+constexpr float viewHeight = 720;
+
+/**
+* GetVisibleChunkš
+*/
+struct ChunkRange
+{
+  int firstX, firstY, lastX, lastY;
+  bool operator==(const ChunkRange& other) const {
+    return firstX == other.firstX && firstY == other.firstY && lastX == other.lastX && lastY == other.lastY;
+  }
+};
+
+ChunkRange GetVisibleChunks(const Tilemap& tilemap, float scrollX, float scrollY)
+{
+  ChunkRange r;
+  tilemap.GetVisibleChunks(scrollX, scrollY, viewWidth, viewHeight, r.firstX, r.firstY, r.lastX, r.lastY);
+  return r;
+}
+
+/**
+* SpriteRenderer::PrepareTilemapsƓAʂɓ`N̂XVԍς̂ϊ
+*
+* @return ϊ`N̐
+*/
+size_t RepackVisibleChunks(const Tilemap& tilemap, float scrollX, const std::vector<TileImageInShader>& images,
+  std::vector<uint32_t>& versions, std::vector<std::vector<SpriteInShader>>& data)
+{
+  const ChunkRange r = GetVisibleChunks(tilemap, scrollX, 0);
+  const uint32_t countX = tilemap.GetChunkCountX();
+  versions.resize(static_cast<size_t>(countX) * tilemap.GetChunkCountY(), 0);
+  data.resize(versions.size());
+  size_t repackCount = 0;
+  for (int cy = r.firstY; cy <= r.lastY; ++cy) {
+    for (int cx = r.firstX; cx <= r.lastX; ++cx) {
+      const size_t key = static_cast<size_t>(cy) * countX + static_cast<size_t>(cx);
+      const uint32_t version = tilemap.GetChunkVersion(cx, cy);
+      if (versions[key] == version) {
+        continue;
+      }
+      versions[key] = version;
+      data[key].resize(tilemap.GetChunkTileCount(cx, cy));
+      data[key].resize(PackTilemapChunk(tilemap, cx, cy, images.data(), images.size(), data[key].data()));
+      ++repackCount;
+    }
+  }
+  return repackCount;
+}
+
+} // unnamed namespace
+
+/**
+* ̃^CƉ摜̂Ȃ^Cĕϊ邱
+*/
+LIB_TEST(PackTilemapChunk_SkipEmpty)
+{
+  Tilemap tilemap;
+  std::vector<TileImageInShader> images;
+  MakeTerrain(tilemap, Tilemap::chunkSize, images);
+  std::vector<SpriteInShader> p(Tilemap::chunkSize * Tilemap::chunkSize);
+  const uint32_t count = PackTilemapChunk(tilemap, 0, 0, images.data(), images.size(), p.data());
+  LIB_CHECK(count == tilemap.GetChunkTileCount(0, 0));
+  images[1].valid = false;
+  LIB_CHECK(PackTilemapChunk(tilemap, 0, 0, images.data(), images.size(), p.data()) == count - Tilemap::chunkSize * 4);
+}
+
+/**
+* Y̓}bv͈̔͂ɐA}bv̊OĂΔ͈͂ɂȂ邱
+*/
+LIB_TEST(Tilemap_VisibleChunksClampY)
+{
+  Tilemap tilemap;
+  tilemap.Init(100, 40, 32, 32); // `N1024x1024sNZŁA4x2
+  LIB_CHECK(tilemap.GetChunkCountX() == 4 && tilemap.GetChunkCountY() == 2);
+
+  LIB_CHECK(GetVisibleChunks(tilemap, 0, 0) == ChunkRange({ 0, 0, 1, 0 }));
+  LIB_CHECK(GetVisibleChunks(tilemap, 0, 500) == ChunkRange({ 0, 0, 1, 1 }));
+  LIB_CHECK(GetVisibleChunks(tilemap, 0, 1500) == ChunkRange({ 0, 1, 1, 1 })); // [̓`N-1܂
+  LIB_CHECK(GetVisibleChunks(tilemap, 0, -500) == ChunkRange({ 0, 0, 1, 0 }));  // [0
+
+  const ChunkRange above = GetVisibleChunks(tilemap, 0, -2000);
+  LIB_CHECK(above.firstY > above.lastY);
+  const ChunkRange below = GetVisibleChunks(tilemap, 0, 5000);
+  LIB_CHECK(below.firstY > below.lastY);
+}
+
+/**
+* X́AJԂȂꍇ̓}bv͈̔͂ɐAJԂꍇ͔͈͊Õ`NԍԂ
+* ̃XN[ʒúA`N̋EɌĐ؂艺
+*/
+LIB_TEST(Tilemap_VisibleChunksWrapX)
+{
+  Tilemap tilemap;
+  tilemap.Init(100, 40, 32, 32);
+
+  LIB_CHECK(!tilemap.GetWrapX());
+  LIB_CHECK(GetVisibleChunks(tilemap, -500, 0) == ChunkRange({ 0, 0, 0, 0 }));
+  LIB_CHECK(GetVisibleChunks(tilemap, 3500, 0) == ChunkRange({ 3, 0, 3, 0 }));
+  const ChunkRange left = GetVisibleChunks(tilemap, -5000, 0);
+  LIB_CHECK(left.firstX > left.lastX);
+  const ChunkRange right = GetVisibleChunks(tilemap, 5000, 0);
+  LIB_CHECK(right.firstX > right.lastX);
+
+  tilemap.SetWrapX(true);
+  LIB_CHECK(GetVisibleChunks(tilemap, -500, 0) == ChunkRange({ -1, 0, 0, 0 }));
+  LIB_CHECK(GetVisibleChunks(tilemap, -1024, 0) == ChunkRange({ -1, 0, 0, 0 }));
+  LIB_CHECK(GetVisibleChunks(tilemap, -1025, 0) == ChunkRange({ -2, 0, 0, 0 }));
+  LIB_CHECK(GetVisibleChunks(tilemap, 3500, 0) == ChunkRange({ 3, 0, 4, 0 }));
+  LIB_CHECK(GetVisibleChunks(tilemap, -5000, 0) == ChunkRange({ -5, 0, -4, 0 }));
+}
+
+/**
+* SetTile͒lςƂ̃`N̍XVԍi߁Ã`Nϊ邱
+*/
+LIB_TEST(Tilemap_SetTileRepack)
+{
+  Tilemap tilemap;
+  std::vector<TileImageInShader> images;
+  MakeTerrain(tilemap, 100, images);
+  std::vector<uint32_t> versions;
+  std::vector<std::vector<SpriteInShader>> data;
+  const size_t visibleCount = 2; // 1280sNZ̉ʂ1024sNZ̃`N2
+  LIB_CHECK(RepackVisibleChunks(tilemap, 0, images, versions, data) == visibleCount);
+  LIB_CHECK(RepackVisibleChunks(tilemap, 0, images, versions, data) == 0);
+
+  const uint32_t before = tilemap.GetChunkVersion(1, 0);
+  const uint32_t other = tilemap.GetChunkVersion(0, 0);
+  const size_t tileCount = data[1].size();
+  tilemap.SetTile(40, 5, 3);
+  LIB_CHECK(tilemap.GetChunkVersion(1, 0) != before);
+  LIB_CHECK(tilemap.GetChunkVersion(0, 0) == other);
+  LIB_CHECK(RepackVisibleChunks(tilemap, 0, images, versions, data) == 1);
+  LIB_CHECK(data[1].size() == tileCount + 1);
+
+  // l̐ݒƔ͈͊O̐ݒł͍XVԍ͕ςȂ
+  const uint32_t after = tilemap.GetChunkVersion(1, 0);
+  tilemap.SetTile(40, 5, 3);
+  tilemap.SetTile(1000, 5, 3);
+  LIB_CHECK(tilemap.GetChunkVersion(1, 0) == after);
+  LIB_CHECK(RepackVisibleChunks(tilemap, 0, images, versions, data) == 0);
+
+  // 摜̒ǉׂ͂Ẵ`Nϊ
+  tilemap.AddTileImage(4);
+  LIB_CHECK(RepackVisibleChunks(tilemap, 0, images, versions, data) == visibleCount);
+}
+
+/**
+* 4096^C̃^C}bv10sNZXN[Ƃ́A1t[̎
+*
+* `N: SpriteRenderer::PrepareTilemapsƓAʂɓ`Nϊĕۑ
+* XvCg: ^C𖈃t[draw_imageŕ`ꍇ(SpritePackSpritesŕϊ)
+*/
+LIB_BENCHMARK(Tilemap_Scroll)
+{
+  constexpr uint32_t mapWidth = 4096;
+  constexpr int frameCount = 600;
+  constexpr float scrollSpeed = 10;
+  Tilemap tilemap;
+  std::vector<TileImageInShader> images;
+  MakeTerrain(tilemap, mapWidth, images);
+
+  size_t packedChunkCount = 0;
+  LibTest::Measure("Tilemap chunks (per 600 frames)", 5, frameCount, [&] {
+    std::unordered_map<uint32_t, std::vector<SpriteInShader>> chunks;
+    packedChunkCount = 0;
+    for (int frame = 0; frame < frameCount; ++frame) {
+      int firstX, firstY, lastX, lastY;
+      tilemap.GetVisibleChunks(static_cast<float>(frame) * scrollSpeed, 0, viewWidth, viewHeight,
+        firstX, firstY, lastX, lastY);
+      const uint32_t countX = tilemap.GetChunkCountX();
+      for (int cy = firstY; cy <= lastY; ++cy) {
+        for (int cx = firstX; cx <= lastX; ++cx) {
+          const uint32_t key = static_cast<uint32_t>(cy) * countX + static_cast<uint32_t>(cx);
+          if (chunks.count(key)) {
+            continue;
+          }
+          std::vector<SpriteInShader>& p = chunks[key];
+          p.resize(tilemap.GetChunkTileCount(cx, cy));
+          p.resize(PackTilemapChunk(tilemap, cx, cy, images.data(), images.size(), p.data()));
+          ++packedChunkCount;
+        }
+      }
+      // ʂ̍1`Nȏ㗣ꂽ͔̂j
+      for (auto itr = chunks.begin(); itr != chunks.end();) {
+        if (static_cast<int>(itr->first % countX) < firstX - 1) {
+          itr = chunks.erase(itr);
+        } else {
+          ++itr;
+        }
+      }
+    }
+  });
+
+  size_t spriteCount = 0;
+  LibTest::Measure("draw_image per tile (per 600 frames)", 5, frameCount, [&] {
+    std::vector<Sprite> sprites;
+    std::vector<uint32_t> texIDs;
+    std::vector<DirectX::XMFLOAT4> uvRects;
+    std::vector<SpriteInShader> p;
+    spriteCount = 0;
+    for (int frame = 0; frame < frameCount; ++frame) {
+      const float scrollX = static_cast<float>(frame) * scrollSpeed;
+      const uint32_t first = static_cast<uint32_t>(scrollX / tilemap.GetTileWidth());
+      const uint32_t last = std::min(mapWidth - 1, static_cast<uint32_t>((scrollX + viewWidth) / tilemap.GetTileWidth()));
+      sprites.clear();
+      texIDs.clear();
+      uvRects.clear();
+      for (uint32_t y = 0; y < tilemap.GetHeight(); ++y) {
+        for (uint32_t x = first; x <= last; ++x) {
+          const uint16_t tile = tilemap.GetTile(x, y);
+          if (tile == Tilemap::emptyTile) {
+            continue;
+          }
+          Sprite sprite = {};
+          sprite.texture = tile;
+          sprite.position = DirectX::XMFLOAT3((static_cast<float>(x) + 0.5f) * 32 - scrollX, (static_cast<float>(y) + 0.5f) * 32, 100);
+          sprite.scale = DirectX::XMFLOAT2(32, 32);
+          sprite.color = DirectX::XMFLOAT4(1, 1, 1, 1);
+          sprites.push_back(sprite);
+          texIDs.push_back(images[tile].texID);
+          uvRects.push_back(DirectX::XMFLOAT4(0, 0, 1, 1));
+        }
+      }
+      p.resize(sprites.size());
+      PackSprites(sprites.data(), nullptr, texIDs.data(), uvRects.data(), sprites.size(), viewHeight, p.data());
+      spriteCount += sprites.size();
+    }
+  });
+  printf("  chunks: %zu chunk packs in %d frames; sprites: %zu tiles packed in %d frames\n",
+    packedChunkCount, frameCount, spriteCount, frameCount);
+}
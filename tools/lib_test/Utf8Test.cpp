@@ -0,0 +1,186 @@
+/**
+* @file Utf8Test.cpp
+*
+* UTF-8̃̕eXgƃx`}[N
+*/
+#include "LibTest.h"
+#include "../../src/lib/Utf8.h"
+#include <locale.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace EasyLib;
+
+namespace /* unnamed */ {
+
+/**
+* 1(rp)
+*/
+std::u32string DecodeEach(const std::string& text)
+{
+  std::u32string result;
+  const char* p = text.data();
+  const char* const end = p + text.size();
+  while (p < end) {
+    result.push_back(DecodeUtf8(p, end));
+  }
+  return result;
+}
+
+/**
+* ܂Ƃ߂ĕ
+*/
+std::u32string DecodeAll(const std::string& text)
+{
+  std::u32string result(text.size(), 0);
+  result.resize(DecodeUtf8(text.data(), text.size(), result.data()));
+  return result;
+}
+
+/**
+* Q[ŕ\镶͂͂A{ASCII̍
+*/
+std::string MakeGameText(size_t minLength)
+{
+  const char8_t* const lines[] = {
+    u8"",
+    u8"PRESS ENTER KEY",
+    u8"Xy[XL[ŃWvIT{eɓƃQ[I[o[",
+    u8"GAME OVER",
+    u8"SCORE:12345",
+    u8"nCXRAXVI@vemhɋC悤B",
+  };
+  std::string text;
+  while (text.size() < minLength) {
+    for (const char8_t* line : lines) {
+      text += reinterpret_cast<const char*>(line);
+      text += '\n';
+    }
+  }
+  return text;
+}
+
+} // unnamed namespace
+
+/**
+* 1̕Ƃ܂Ƃ߂Ă̌̕ʂv邱
+*/
+LIB_TEST(Utf8_DecodeMatchesEach)
+{
+  const std::u32string expected = { 'A', 0x3042, 0x6f22, 0x1f600, ' ', 0xff5e };
+  const std::string text = "A\xe3\x81\x82\xe6\xbc\xa2\xf0\x9f\x98\x80 \xef\xbd\x9e"; // A(U+1F600) `
+  LIB_CHECK(DecodeEach(text) == expected);
+  LIB_CHECK(DecodeAll(text) == expected);
+
+  const std::string game = MakeGameText(4096);
+  LIB_CHECK(DecodeAll(game) == DecodeEach(game));
+}
+
+/**
+* sȃoCgreplacementCharacterɂȂ邱
+*/
+LIB_TEST(Utf8_Invalid)
+{
+  const char* const invalid[] = {
+    "\x80",             // 擪ɂȂpoCg
+    "\xc0\xaf",         // 璷ȕ\
+    "\xe0\x80\xaf",     // 璷ȕ\
+    "\xed\xa0\x80",     // TQ[g
+    "\xf4\x90\x80\x80", // U+10FFFF𒴂
+    "\xe3\x81",         // rŏI
+    "\xff",
+  };
+  for (const char* s : invalid) {
+    const std::u32string decoded = DecodeAll(s);
+    LIB_CHECK(!decoded.empty() && decoded[0] == replacementCharacter);
+    LIB_CHECK(decoded == DecodeEach(s));
+  }
+}
+
+/**
+* _ȃoCgłA1̕Ƃ܂Ƃ߂Ă̌̕ʂv邱
+*/
+LIB_TEST(Utf8_RandomBytes)
+{
+  std::mt19937 rand(1);
+  bool same = true;
+  for (int i = 0; i < 1000; ++i) {
+    std::string text(rand() % 64, 0);
+    for (char& c : text) {
+      c = static_cast<char>(rand() % 3 ? rand() % 0x80 : rand());
+    }
+    same &= DecodeAll(text) == DecodeEach(text);
+  }
+  LIB_CHECK(same);
+}
+
+/**
+* ASCII̒16oCgPʂ̋E܂łAݐ͈̔͂𒴂Ȃ
+*/
+LIB_TEST(Utf8_AsciiRunBoundaries)
+{
+  bool same = true;
+  bool inside = true;
+  for (size_t n = 0; n <= 48; ++n) {
+    const std::string text = std::string(n, 'a') + "\xe3\x81\x82" + std::string(n % 17, 'b') + "\xe6\xbc\xa2";
+    std::u32string out(text.size() + 1, U'#'); // Ō̗vf͔͈͊Oւ݂̏𒲂ׂ邽
+    const size_t count = DecodeUtf8(text.data(), text.size(), out.data());
+    inside &= out[text.size()] == U'#';
+    out.resize(count);
+    same &= out == DecodeEach(text);
+  }
+  LIB_CHECK(same);
+  LIB_CHECK(inside);
+}
+
+/**
+* ASCIIԂ
+*/
+LIB_TEST(Utf8_CountAsciiRun)
+{
+  const std::string text = "SCORE:12345 and more ascii text \xe3\x81\x82";
+  LIB_CHECK(CountAsciiRun(text.data(), text.size()) == text.size() - 3);
+  LIB_CHECK(CountAsciiRun(text.data(), 5) == 5);
+  LIB_CHECK(CountAsciiRun("\xe3\x81\x82", 3) == 0);
+}
+
+/**
+* Q[͂͂̕1MB̕̕x(ns/item 1oCg̎)
+*
+* mbstowcs̓P[Ɉˑ̂ŁAUTF-8̃P[ݒłꍇr
+*/
+LIB_BENCHMARK(Utf8_Decode)
+{
+  const std::string text = MakeGameText(1 << 20);
+  std::u32string out(text.size(), 0);
+  size_t count = 0;
+  LibTest::Measure("DecodeUtf8 (bulk)", 50, text.size(), [&] {
+    count = DecodeUtf8(text.data(), text.size(), out.data());
+  });
+  LibTest::Measure("DecodeUtf8 (per character)", 50, text.size(), [&] {
+    const char* p = text.data();
+    const char* const end = p + text.size();
+    char32_t* q = out.data();
+    while (p < end) {
+      *q++ = DecodeUtf8(p, end);
+    }
+  });
+  const std::string ascii(1 << 20, 'A');
+  LibTest::Measure("DecodeUtf8 (ASCII only)", 50, ascii.size(), [&] {
+    DecodeUtf8(ascii.data(), ascii.size(), out.data());
+  });
+
+  if (setlocale(LC_CTYPE, "C.UTF-8") || setlocale(LC_CTYPE, ".UTF-8") || setlocale(LC_CTYPE, "en_US.UTF-8")) {
+    std::vector<wchar_t> wide(text.size() + 1);
+    LibTest::Measure("mbstowcs", 50, text.size(), [&] {
+      mbstowcs(wide.data(), text.c_str(), wide.size());
+    });
+    setlocale(LC_CTYPE, "C");
+  } else {
+    printf("  mbstowcs: no UTF-8 locale\n");
+  }
+  printf("  %zu bytes, %zu characters\n", text.size(), count);
+}
@@ -0,0 +1,173 @@
+/**
+* @file lib_test.cpp
+*
+* D3D12ɈˑȂCũeXgƃx`}[N
+*
+* g:
+*   lib_test [test] [-g <摜tH_>] [-r <\[XtH_>] [--update-golden] [O]
+*     eXgs. Ow肷ƁAOɂ̕܂ނ̂s
+*     -g              摜r̊摜utH_(ȗ golden)
+*     -r              Q[̉摜tHgutH_(ȗ ../../res)
+*     --update-golden 摜݂̌ʂŏ㏑
+*   lib_test bench [-r <\[XtH_>] [O]
+*     x`}[Ns
+*/
+#include "LibTest.h"
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+#include <vector>
+#if defined(__unix__)
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace LibTest {
+
+namespace /* unnamed */ {
+
+/**
+* o^ꂽeXg܂̓x`}[N
+*/
+struct Entry
+{
+  const char* name;
+  Function func;
+};
+
+std::vector<Entry>& GetEntries(bool isBenchmark)
+{
+  static std::vector<Entry> tests;
+  static std::vector<Entry> benchmarks;
+  return isBenchmark ? benchmarks : tests;
+}
+
+size_t failureCount = 0;
+std::string goldenDirectory = "golden";
+bool updateGolden = false;
+std::string resourceDirectory = "../../res";
+
+} // unnamed namespace
+
+Registrar::Registrar(bool isBenchmark, const char* name, Function func)
+{
+  GetEntries(isBenchmark).push_back({ name, func });
+}
+
+void ReportFailure(const char* file, int line, const char* expression)
+{
+  fprintf(stderr, "%s(%d): FAILED: %s\n", file, line, expression);
+  ++failureCount;
+}
+
+const std::string& GetGoldenDirectory()
+{
+  return goldenDirectory;
+}
+
+bool IsUpdateGolden()
+{
+  return updateGolden;
+}
+
+const std::string& GetResourceDirectory()
+{
+  return resourceDirectory;
+}
+
+uint64_t Now()
+{
+  return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+    std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+void PrintMeasure(const char* name, uint64_t firstNanoseconds, uint64_t bestNanoseconds, size_t count)
+{
+  printf("  %-40s first %9.3f ms, best %9.3f ms", name,
+    static_cast<double>(firstNanoseconds) * 1e-6, static_cast<double>(bestNanoseconds) * 1e-6);
+  if (count > 0) {
+    printf(" (%.2f ns/item)", static_cast<double>(bestNanoseconds) / static_cast<double>(count));
+  }
+  printf("\n");
+}
+
+/**
+* t@COS̃t@CLbVǂo
+*
+* N(܂xǂ܂ĂȂ)̓ǂݍݎԂ𑪂邽߂Ɏg
+*
+* @retval true  ǂo
+* @retval false ǂoȂ(̊ł͖Ή)
+*/
+bool DropFileCache(const char* filename)
+{
+#if defined(__unix__)
+  const int fd = open(filename, O_RDONLY);
+  if (fd < 0) {
+    return false;
+  }
+  fdatasync(fd); // ΂̃t@ĆAoĂłȂƒǂoȂ
+  const bool result = posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED) == 0;
+  close(fd);
+  return result;
+#else
+  (void)filename;
+  return false;
+#endif
+}
+
+} // namespace LibTest
+
+namespace /* unnamed */ {
+
+void PrintUsage()
+{
+  printf("usage: lib_test [test] [-g <golden dir>] [-r <resource dir>] [--update-golden] [name]\n");
+  printf("       lib_test bench [-r <resource dir>] [name]\n");
+}
+
+} // unnamed namespace
+
+/**
+* Gg[|Cg
+*/
+int main(int argc, char** argv)
+{
+  bool isBenchmark = false;
+  const char* filter = nullptr;
+  for (int i = 1; i < argc; ++i) {
+    if (strcmp(argv[i], "test") == 0) {
+      isBenchmark = false;
+    } else if (strcmp(argv[i], "bench") == 0) {
+      isBenchmark = true;
+    } else if (strcmp(argv[i], "-g") == 0 && i + 1 < argc) {
+      LibTest::goldenDirectory = argv[++i];
+    } else if (strcmp(argv[i], "-r") == 0 && i + 1 < argc) {
+      LibTest::resourceDirectory = argv[++i];
+    } else if (strcmp(argv[i], "--update-golden") == 0) {
+      LibTest::updateGolden = true;
+    } else if (argv[i][0] == '-') {
+      PrintUsage();
+      return 1;
+    } else {
+      filter = argv[i];
+    }
+  }
+
+  size_t runCount = 0;
+  for (const LibTest::Entry& e : LibTest::GetEntries(isBenchmark)) {
+    if (filter && !strstr(e.name, filter)) {
+      continue;
+    }
+    printf("%s\n", e.name);
+    fflush(stdout);
+    const size_t failureCount = LibTest::failureCount;
+    e.func();
+    if (!isBenchmark && LibTest::failureCount != failureCount) {
+      printf("  failed\n");
+    }
+    ++runCount;
+  }
+  printf("%zu %s, %zu failures\n", runCount, isBenchmark ? "benchmarks" : "tests", LibTest::failureCount);
+  return LibTest::failureCount == 0 ? 0 : 1;
+}